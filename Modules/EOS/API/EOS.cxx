@@ -26,6 +26,13 @@
 #include "EOS/Src/EOS_PerfectGas/EOS_PerfectGas.hxx"
 #include "EOS/Src/EOS_StiffenedGas/EOS_StiffenedGas.hxx"
 #include "EOS_Std_Error_Handler.hxx"
+#include "EOS_Index.hxx"
+#include "EOS_Fields.hxx"
+#include "EOS_FieldView.hxx"
+#include <algorithm>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 //PLUGIN INSERT CATHARE
 #ifdef WITH_PLUGIN_CATHARE
@@ -131,81 +138,30 @@ namespace NEPTUNE
    // }
 
 // Determine   in return, the class associated with(method_str, ref_str) from index.eos  :  fluid_model_class
+// (index.eos is read once, see EOS_Index)
 const char* EOS::INDEX(const char* const method_str, const char* const ref_str)
 {
-  char method_str_maj[50], ref_str_maj[50] ;
-  char method_str_iem[50], ref_str_iem[50] ;
-  char *cpt_method, *cpt_ref ;
-  char *cpt0, *cpt, *cpt2, *cpt3 ;
-
-  static const int longmax = 1000 ;
-  static const char pref_eos[5] = "EOS_" ;
-  char line_indeos[longmax] ;
-
-  // uppercase : method_str_maj, ref_str_maj
-  strcpy(method_str_maj,method_str) ;
-  cpt = method_str_maj ;
-  while ((*cpt = toupper(*cpt)))  cpt++ ;
-
-  strcpy(ref_str_maj,ref_str) ;
-  cpt = ref_str_maj ;
-  while ((*cpt = toupper(*cpt)))  cpt++ ;
-
-  // pointer  cpt_method, cpt_ref
-  cpt0 = method_str_maj ;
-  cpt  = strstr(method_str_maj,pref_eos) ;
-  if (cpt0 == cpt)
-     cpt_method = method_str_maj + strlen(pref_eos) ;
-  else
-     cpt_method = method_str_maj ;
-  cpt_ref = ref_str_maj ;
-
-
-  // index.eos file :   name : index_file_name   desc : index_file_desc
-  AString index_file_name;
-  get_index_file(index_file_name);
-  std::ifstream index_file_desc(index_file_name.aschar());
-  if (!index_file_desc)
-     { cerr << index_file_name.aschar() << " file not found !"<< endl;
-       strcpy(fluid_model_class,"Class Not Found : index.eos file not found ") ;
-       return fluid_model_class ;
-     }
-
-  // read in index.eos file : method_str_iem, ref_str_iem, fluid_model_class
-  while(index_file_desc)
-     { index_file_desc.getline(line_indeos,longmax) ;
-       if (index_file_desc.eof()) break ;
-
-       cpt = line_indeos ;
-       char * save_cpt;
-       int numw = 0 ;
-       while ( (cpt2 = strtok_r(cpt," ", &save_cpt)) )
-          { numw++ ;
-            if (numw == 1)
-               { strcpy(method_str_iem,cpt2) ;  // read and uppercase
-                 cpt3 = method_str_iem ;
-                 while ((*cpt3 = toupper(*cpt3)))  cpt3++ ;
-               }
-            else if (numw == 2)                 // read and uppercase
-               { strcpy(ref_str_iem,cpt2) ;
-                 cpt3 = ref_str_iem ;
-                 while ((*cpt3 = toupper(*cpt3)))  cpt3++ ;
-               }
-            else if (numw == 3)
-               strcpy(fluid_model_class,cpt2) ;
-            cpt = NULL ;
-          }
-
-       if ((strcmp(cpt_method,method_str_iem) == 0) && (strcmp(cpt_ref,ref_str_iem) == 0)) 
-          { index_file_desc.close() ;
-            return fluid_model_class ;
+  if (iret_eos_data_dir) exit(1) ;
+  EOS_Index_Entry entry ;
+  switch (EOS_Index::find(method_str, ref_str, entry))
+     { case 0 :
+          strncpy(fluid_model_class, entry.fluid_model_class.c_str(), sizeof(fluid_model_class)-1) ;
+          fluid_model_class[sizeof(fluid_model_class)-1] = 0 ;
+          break ;
+       case 2 :
+          { AString index_file_name ;
+            get_index_file(index_file_name) ;
+            cerr << index_file_name.aschar() << " file not found !"<< endl;
+            strcpy(fluid_model_class,"Class Not Found : index.eos file not found ") ;
           }
+          break ;
+       default :
+          // method_str, ref_str   not found
+          cerr << " M.T. '" << method_str << "' and E.E. '"  << ref_str << "' not found !"<< endl;
+          strcpy(fluid_model_class,"Class Not Found : M.T. and E.E not found") ;
+          break ;
      }
-
-   // method_str, ref_str   not found
-   cerr << " M.T. '" << method_str << "' and E.E. '"  << ref_str << "' not found !"<< endl;
-   strcpy(fluid_model_class,"Class Not Found : M.T. and E.E not found") ;
-   return fluid_model_class ;
+  return fluid_model_class ;
 }
 
 
@@ -235,122 +191,59 @@ const char* EOS::INDEX(const char* const method_str, const char* const ref_str)
    //
    int EOS::index_data(const char *const tmname_in, const char *const fename_in)
    {
-     char tmname_in_maj[50], fename_in_maj[50] ;
-     char tmname_read[50], fename_read[50] ;
-     char *cpt_tmname_in, *cpt_fename_in ;
-     char *cpt0, *cpt, *cpt2, *cpt3 ;
-
-     static const int longmax = 1000 ;
      static const char pref_eos[5] = "EOS_" ;
-     char line_indeos[longmax] ;
-     char mot[100] ;
-
-     // uppercase : tmname_in_maj, fename_in_maj
-     strcpy(tmname_in_maj,tmname_in) ;
-     cpt = tmname_in_maj ;
-     while ((*cpt = toupper(*cpt)))  cpt++ ;
-
-     strcpy(fename_in_maj,fename_in) ;
-     cpt = fename_in_maj ;
-     while ((*cpt = toupper(*cpt)))  cpt++ ;
-
-     // pointer  cpt_tmname_in, cpt_fename_in
-     cpt0 = tmname_in_maj ;
-     cpt  = strstr(tmname_in_maj,pref_eos) ;
-     if (cpt0 == cpt)
-        cpt_tmname_in = tmname_in_maj + strlen(pref_eos) ;
-     else
-        cpt_tmname_in = tmname_in_maj ;
-     cpt_fename_in = fename_in_maj ;
-
 
-     // index.eos file :   name : index_file_name   desc : index_file_desc
-     AString index_file_name;
-     get_index_file(index_file_name);
-     std::ifstream index_file_desc(index_file_name.aschar());
-     if (!index_file_desc)
-        { cerr << index_file_name.aschar() << " file not found !"<< endl;
+     if (iret_eos_data_dir) exit(1) ;
+     EOS_Index_Entry entry ;
+     int iret = EOS_Index::find(tmname_in, fename_in, entry) ;
+     if (iret == 2)
+        { AString index_file_name ;
+          get_index_file(index_file_name) ;
+          cerr << index_file_name.aschar() << " file not found !"<< endl;
           strcpy(fluid_model_class,"Class Not Found : index.eos file not found ") ;
           return 2 ;
         }
+     else if (iret == 1)
+        { // tmname_in, fename_in   not found
+          cerr << " T.M. '" << tmname_in << "' and F.E. '"  << fename_in << "' not found !"<< endl;
+          return 1 ;
+        }
 
-     // read in index.eos file : tmname_read, fename_read, fluid_model_class
-     while(index_file_desc)
-        { index_file_desc.getline(line_indeos,longmax) ;
-          if (index_file_desc.eof()) break ;
-   
-          cpt = line_indeos ;
-          int numw = 0 ;
-          int nb_args  = 0 ;
-          int num_args = 0 ;
-          char * save_cpt;
-          while ( (cpt2 = strtok_r(cpt," ", &save_cpt)) )
-             { numw++ ;
-               if (numw == 1)                        // Thermodynamic Model Name
-                  { strcpy(tmname_read,cpt2) ;       // read tmname_read
-                    therm_model = tmname_read ;      // Thermodynamic Model Name
-                    cpt3 = tmname_read ;             // uppercase
-                    while ((*cpt3 = toupper(*cpt3)))  cpt3++ ;
-                  }
-               else if (numw == 2)                   // Fluid Equation Name
-                  { strcpy(fename_read,cpt2) ;       // read fename_read
-                    fluid_equa = fename_read ;       // Fluid Equation Name
-                    cpt3 = fename_read ;             // uppercase
-                    while ((*cpt3 = toupper(*cpt3)))  cpt3++ ;
-                  }
-               else if (numw == 3)                   // Class Name
-                  strcpy(fluid_model_class,cpt2) ;
-               else if (numw == 6)
-                  { nb_args  = atoi(cpt2) ;
-                    fluid_model_args.resize(nb_args) ;
-                  }
-               else if (num_args < nb_args)
-                  { strcpy(mot,cpt2) ;
-                    fluid_model_args[num_args] = AString(mot) ;
-                    num_args++ ;
-                  }
-               cpt = NULL ;
-             }
-   
-          if ((strcmp(cpt_tmname_in,tmname_read) == 0) && (strcmp(cpt_fename_in,fename_read) == 0)) 
-             { index_file_desc.close() ;
-               // EOS Thermodynamic Model Name
-               eos_therm_model  = pref_eos ;
-               eos_therm_model += therm_model ;
-               // Thermodynamic Model Data Directory
-               if (iret_eos_data_dir) return 3 ;
-               tm_data_dir  = eos_data_dir ;
-               tm_data_dir += "/"          ;
-               tm_data_dir += eos_therm_model ;
-               // T.M. version : tm_version
-               // from  tminfo_file  file reading
-               if (strcmp(eos_therm_model.c_str(),"EOS_Refprop+") == 0)
-                  { string tminfo_file = tm_data_dir ;
-                    tminfo_file += "/info.tm" ;
-                    std::ifstream index_file_desc(tminfo_file.c_str());
-                    if (!index_file_desc) 
-                       { cerr << tminfo_file.c_str() << " file not found !"<< endl;
-                         strcpy(fluid_model_class,"Class Not Found : T.M. info. file not found ") ;
-                         return 3 ;
-                       }
-                    index_file_desc.close() ;
-                  }
-               else
-                  tm_version = "scripi-shell amodifier sauf Refprop" ;
-                 
-               // provisoire
-               m_fluid    = "afaire" ;
-               m_phase    = "afaire" ;
-               #
-               return 0 ;
+     therm_model = entry.therm_model ;  // Thermodynamic Model Name
+     fluid_equa  = entry.fluid_equa ;   // Fluid Equation Name
+     strncpy(fluid_model_class, entry.fluid_model_class.c_str(), sizeof(fluid_model_class)-1) ;
+     fluid_model_class[sizeof(fluid_model_class)-1] = 0 ;
+     int nb_args = (int) entry.args.size() ;
+     fluid_model_args.resize(nb_args) ;
+     for (int i=0; i<nb_args; i++)
+        fluid_model_args[i] = AString(entry.args[i].c_str()) ;
+
+     // EOS Thermodynamic Model Name
+     eos_therm_model  = pref_eos ;
+     eos_therm_model += therm_model ;
+     // Thermodynamic Model Data Directory
+     tm_data_dir  = eos_data_dir ;
+     tm_data_dir += "/"          ;
+     tm_data_dir += eos_therm_model ;
+     // T.M. version : tm_version
+     // from  tminfo_file  file reading
+     if (strcmp(eos_therm_model.c_str(),"EOS_Refprop+") == 0)
+        { string tminfo_file = tm_data_dir ;
+          tminfo_file += "/info.tm" ;
+          string tminfo ;
+          if (!EOS_Index::data_file(tminfo_file, tminfo))
+             { cerr << tminfo_file.c_str() << " file not found !"<< endl;
+               strcpy(fluid_model_class,"Class Not Found : T.M. info. file not found ") ;
+               return 3 ;
              }
-
-
         }
-   
-      // tmname_in, fename_in   not found
-      cerr << " T.M. '" << tmname_in << "' and F.E. '"  << fename_in << "' not found !"<< endl;
-      return 1 ;
+     else
+        tm_version = "scripi-shell amodifier sauf Refprop" ;
+
+     // provisoire
+     m_fluid    = "afaire" ;
+     m_phase    = "afaire" ;
+     return 0 ;
    }
 
    // Get Thermodynamic Model Name
@@ -454,6 +347,129 @@ const char* EOS::INDEX(const char* const method_str, const char* const ref_str)
           }
      }
 
+  // - --- Field computes by chunks (see set_parallel_chunk) --- -
+
+  int EOS::nb_chunks(int n) const
+  {
+#ifdef _OPENMP
+    if (   parallel_chunk <= 0 || n <= parallel_chunk
+        || omp_in_parallel() || omp_get_max_threads() < 2
+        || !fluid_model_obj.is_thread_safe())
+       return 0 ;
+    return (n + parallel_chunk - 1) / parallel_chunk ;
+#else
+    (void) n ;
+    return 0 ;
+#endif
+  }
+
+  // compute_chunk(begin, size) on the chunks of n points, dynamic schedule.
+  // The chunks only write their own points : no reduction in the loop,
+  // the caller handles the whole error field afterwards.
+  template <class Compute_Chunk>
+  static void for_chunks(int n, int chunk, int nb, const Compute_Chunk& compute_chunk)
+  {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (int c=0; c<nb; c++)
+       { int begin = c*chunk ;
+         compute_chunk(begin, std::min(chunk, n - begin)) ;
+       }
+  }
+
+  static void sub_fields(const EOS_Fields &f, int begin, int n, EOS_Fields &sub)
+  { for (int i=0; i<f.size(); i++)
+       sub[i] = f[i].sub(begin, n) ;
+  }
+
+  void EOS::compute_chunks(const EOS_Fields &input, EOS_Field &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { EOS_Fields in(input.size()) ;
+         sub_fields(input, begin, sz, in) ;
+         EOS_Field sr = r.sub(begin, sz) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(in, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_Fields &input, EOS_Fields &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { EOS_Fields in(input.size()), sr(r.size()) ;
+         sub_fields(input, begin, sz, in) ;
+         sub_fields(r, begin, sz, sr) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(in, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_Field &p, const EOS_Field &h, EOS_Field &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { const EOS_Field sp = p.sub(begin, sz) ;
+         const EOS_Field sh = h.sub(begin, sz) ;
+         EOS_Field sr = r.sub(begin, sz) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(sp, sh, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_Field &p, const EOS_Field &h, EOS_Fields &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { const EOS_Field sp = p.sub(begin, sz) ;
+         const EOS_Field sh = h.sub(begin, sz) ;
+         EOS_Fields sr(r.size()) ;
+         sub_fields(r, begin, sz, sr) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(sp, sh, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_Field &p, EOS_Fields &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { const EOS_Field sp = p.sub(begin, sz) ;
+         EOS_Fields sr(r.size()) ;
+         sub_fields(r, begin, sz, sr) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(sp, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_Field &p, EOS_Field &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { const EOS_Field sp = p.sub(begin, sz) ;
+         EOS_Field sr = r.sub(begin, sz) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(sp, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_FieldView &p, const EOS_FieldView &h, EOS_FieldView &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { const EOS_FieldView sp = p.sub(begin, sz) ;
+         const EOS_FieldView sh = h.sub(begin, sz) ;
+         EOS_FieldView sr = r.sub(begin, sz) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(sp, sh, sr, serr) ;
+       }) ;
+  }
+
+  void EOS::compute_chunks(const EOS_FieldView &p, EOS_FieldView &r, EOS_Error_Field &errfield) const
+  { const int n = errfield.size() ;
+    for_chunks(n, parallel_chunk, nb_chunks(n), [&](int begin, int sz)
+       { const EOS_FieldView sp = p.sub(begin, sz) ;
+         EOS_FieldView sr = r.sub(begin, sz) ;
+         EOS_Error_Field serr = errfield.sub(begin, sz) ;
+         fluid_model_obj.compute(sp, sr, serr) ;
+       }) ;
+  }
+
   vector<string> EOS::is_implemented(const char *pprop1, const char *pprop2,
                                      const vector<string> list_prop, double vprop1, double vprop2)
      { vector<string> list_propv ;
@@ -39,6 +39,7 @@ namespace NEPTUNE
 {
   class EOS             ;
   class EOS_Field       ;
+  class EOS_FieldView   ;
   class EOS_Error_Field ;
   class EOS_Fields      ;
   class EOS_Fluid       ;
@@ -118,6 +119,10 @@ namespace NEPTUNE
                       const EOS_Field &h,                              
                       EOS_Fields &r, 
                       EOS_Error_Field &errfield) const ;
+    //! property number (token) of a property name : to be resolved once
+    //! and passed to the overloads taking a property_number, which then
+    //! do no name look-up
+    static EOS_Property property_number(const char *const property_name) ;
     EOS_Error compute(const char *const property_name,
                       double p, 
                       double h, 
@@ -140,6 +145,13 @@ namespace NEPTUNE
     EOS_Error compute(const EOS_Field &p, 
                       EOS_Field &output, 
                       EOS_Error_Field &errfield) const ;
+    EOS_Error compute(const EOS_FieldView &p, 
+                      const EOS_FieldView &h, 
+                      EOS_FieldView &r, 
+                      EOS_Error_Field &errfield) const ;
+    EOS_Error compute(const EOS_FieldView &p, 
+                      EOS_FieldView &output, 
+                      EOS_Error_Field &errfield) const ;
     EOS_Error compute_Ph(const char* const property_name, 
                       double in1, double in2, double& out) const;
     EOS_Error compute_Ph(const char* const property_name,
@@ -330,6 +342,10 @@ namespace NEPTUNE
     EOS_Error compute_cp_v_sat_p(double p, double &r) const;
 
     EOS_Error compute_p_sat_T(double T, double &r) const;
+    //! see EOS_Fluid::newton_p_sat_T (warm start, iteration count)
+    EOS_Error newton_p_sat_T(double T, double &r, double p_start, int &nb_iter) const;
+    //! see EOS_Fluid::init_p_sat_T_guess
+    EOS_Error init_p_sat_T_guess(double pmin, double pmax, int n=32);
     EOS_Error compute_rho_l_sat_T(double T, double &r) const;
     EOS_Error compute_rho_v_sat_T(double T, double &r) const;
     EOS_Error compute_h_l_sat_T(double T, double &r) const;
@@ -1194,6 +1210,17 @@ namespace NEPTUNE
 
     static int test() ;
 
+    //! Field computes on OpenMP threads : the fields are cut in chunks of
+    //! chunk_size points, given dynamically to the threads (the cost of a
+    //! point varies, e.g. one or two phases). Each point writes its own
+    //! error code, the error handler sees the whole field after the join :
+    //! same results as a serial compute. 0 (default) : serial.
+    //! Serial anyway inside a parallel region, for a field of at most
+    //! chunk_size points, or if the fluid is not thread safe
+    //! (EOS_Fluid::is_thread_safe).
+    void set_parallel_chunk(int chunk_size) ;
+    int  get_parallel_chunk() const ;
+
     //! Specify a new error handler. The error handler must be initialized.
     //! Il will be duplicated and stored in the EOS object so the caller
     //! can destroy it's own instance of the handler.
@@ -1244,6 +1271,18 @@ namespace NEPTUNE
     string m_phase         = "" ;  // Phase Name
     
     EOS_Fluid &fluid_model_obj ;
+    //! see set_parallel_chunk
+    int parallel_chunk = 0 ;
+    //! number of chunks of a field compute of n points, 0 if serial
+    int nb_chunks(int n) const ;
+    void compute_chunks(const EOS_Fields &input, EOS_Field &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_Fields &input, EOS_Fields &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_Field &p, const EOS_Field &h, EOS_Field &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_Field &p, const EOS_Field &h, EOS_Fields &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_Field &p, EOS_Fields &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_Field &p, EOS_Field &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_FieldView &p, const EOS_FieldView &h, EOS_FieldView &r, EOS_Error_Field &errfield) const ;
+    void compute_chunks(const EOS_FieldView &p, EOS_FieldView &r, EOS_Error_Field &errfield) const ;
     //! Pointer to the error_handler (The EOS object owns the handler:
     //!  err_handler is destroyed when the EOS object dies).
     //! The pointer must never be null.
@@ -31,10 +31,18 @@ namespace NEPTUNE
   {
   public: 
     EOS_Error_Field();
+    //! view on the codes of the field (no copy)
     EOS_Error_Field(const EOS_Error_Field&);
+    //! takes the codes of the field, left empty
+    EOS_Error_Field(EOS_Error_Field&&);
+    //! copies the codes (as ArrOfInt)
+    EOS_Error_Field& operator= (const EOS_Error_Field&);
+    EOS_Error_Field& operator= (EOS_Error_Field&&);
     //! x_ptr=new int(n);
     //! EOS_Error_Field(n, x_ptr);
     EOS_Error_Field( int nsz, int* ptr);
+    //! same, library codes also taken from lib_ptr (no allocation)
+    EOS_Error_Field( int nsz, int* ptr, int* lib_ptr);
     //! ArrOfInt x(n);
     //! EOS_Error_Field(x);
     EOS_Error_Field(ArrOfInt&);
@@ -49,6 +57,8 @@ namespace NEPTUNE
     //! see the Language documentation ...
     virtual const Type_Info& get_Type_Info () const;
     int size() const;
+    //! view on n codes from begin (no copy)
+    EOS_Error_Field sub(int begin, int n);
     const EOS_Error_Field & operator= (EOS_Internal_Error err);
     void               set_worst_error(const EOS_Error_Field & field);
     EOS_Internal_Error find_worst_error() const;
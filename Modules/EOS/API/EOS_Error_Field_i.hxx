@@ -27,6 +27,12 @@ namespace NEPTUNE
   {
   }
 
+  inline  EOS_Error_Field::
+  EOS_Error_Field( int nsz, int* ptr, int* lib_ptr) :
+    data(nsz, ptr), library_codes(nsz, lib_ptr)
+  {
+  }
+
   inline const EOS_Internal_Error EOS_Error_Field::
   operator [] (int i) const
   {
@@ -52,5 +58,13 @@ namespace NEPTUNE
     assert(data.size() == library_codes.size());
     return data.size();
   }
+
+  inline EOS_Error_Field EOS_Error_Field::
+  sub(int begin, int n)
+  {
+    assert(begin >= 0 && n >= 0 && begin + n <= size());
+    return EOS_Error_Field(n, (int*) data.get_ptr() + begin,
+                           (int*) library_codes.get_ptr() + begin);
+  }
 }
 #endif
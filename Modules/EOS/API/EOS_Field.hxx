@@ -32,7 +32,10 @@ namespace NEPTUNE
   class EOS_Field : public UObject
   { public: 
        EOS_Field() ;
+       //! view on the data of the field (no copy)
        EOS_Field(const EOS_Field&) ;
+       //! takes the data of the field, left empty
+       EOS_Field(EOS_Field&&) ;
        //! x_ptr=new double(n);
        //! EOS_Field("Pressure", "P", n, x_ptr);
        EOS_Field(const char* const property_title, 
@@ -51,7 +54,12 @@ namespace NEPTUNE
        EOS_Field(const char* const property_title, 
                  const char* const property_name,
                  int property_number, ArrOfDouble&);
+       //! shares the data of the field (attach)
        EOS_Field& operator = (const EOS_Field&);
+       //! takes the data of the field, which gets the previous ones
+       EOS_Field& operator = (EOS_Field&&);
+       //! init and reset_data_ptr copy the values into the data of the field
+       //! (no alias on the given array : see the constructors for that)
        int init(const char* const property_title, 
                 const char* const property_name,
                 ArrOfDouble&);       
@@ -90,6 +98,8 @@ namespace NEPTUNE
        //! see the Language documentation ...
        virtual const Type_Info& get_Type_Info () const;
        int size() const;
+       //! view on n points from begin (no copy)
+       EOS_Field sub(int begin, int n) const ;
 
     protected :
        ArrOfDouble data ;
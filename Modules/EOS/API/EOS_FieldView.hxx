@@ -0,0 +1,60 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+
+
+#ifndef EOS_FIELDVIEW_H
+#define EOS_FIELDVIEW_H
+
+#include "EOS_properties.hxx"
+
+namespace NEPTUNE
+{
+  class EOS_Field ;
+
+  //! A lightweight view on a field for the EOS module
+  //! (pointer, size, property number, stride)
+  //! Not a UObject : no registration in the Objects list, no virtual
+  //! method. The view never owns its data and never touches the reference
+  //! count of an EOS_Field : sub() ranges of a shared field can be given
+  //! to threads without copy, as long as the field outlives them.
+  class EOS_FieldView
+  { public:
+       EOS_FieldView() ;
+       //! EOS_FieldView(NEPTUNE::p, n, x_ptr);
+       EOS_FieldView(int property_number, int nsz, double* ptr, int stride=1) ;
+       //! view on the data of an EOS_Field
+       explicit EOS_FieldView(const EOS_Field&) ;
+       const int&     get_property_number() const ;
+       EOS_Property   get_property()        const ;
+       const double& operator [] (int) const ;
+       double& operator [] (int) ;
+       double* get_ptr()    const ;
+       int     get_stride() const ;
+       int     size()       const ;
+       //! n points from begin, up to the end when n < 0
+       EOS_FieldView sub(int begin, int n=-1) const ;
+
+    private:
+       double* data ;
+       int     nsz ;
+       int     property_number ;
+       int     stride ;
+  };
+}
+#include "EOS/API/EOS_FieldView_i.hxx"
+#endif
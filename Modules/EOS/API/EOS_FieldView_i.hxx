@@ -0,0 +1,84 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+
+
+#ifndef EOS_FIELDVIEW_I_H
+#define EOS_FIELDVIEW_I_H
+
+#include "EOS/API/EOS_Field.hxx"
+#include <assert.h>
+
+namespace NEPTUNE
+{
+  inline EOS_FieldView::EOS_FieldView() :
+    data(0), nsz(0), property_number(-1), stride(1)
+  {
+  }
+
+  inline EOS_FieldView::EOS_FieldView(int prop_numb, int n, double* ptr, int strd) :
+    data(ptr), nsz(n), property_number(prop_numb), stride(strd)
+  {
+  }
+
+  // an EOS_Field output is written through its data, as EOS_Field::operator= does
+  inline EOS_FieldView::EOS_FieldView(const EOS_Field& f) :
+    data((double*) f.get_data().get_ptr()),
+    nsz(f.size()),
+    property_number(f.get_property_number()),
+    stride(1)
+  {
+  }
+
+  inline const int& EOS_FieldView::get_property_number() const
+  { return property_number ;
+  }
+
+  inline EOS_Property EOS_FieldView::get_property() const
+  { return property_number ;
+  }
+
+  inline const double& EOS_FieldView::operator [] (int i) const
+  { assert(i >= 0 && i < nsz) ;
+    return data[i*stride] ;
+  }
+
+  inline double& EOS_FieldView::operator [] (int i)
+  { assert(i >= 0 && i < nsz) ;
+    return data[i*stride] ;
+  }
+
+  inline double* EOS_FieldView::get_ptr() const
+  { return data ;
+  }
+
+  inline int EOS_FieldView::get_stride() const
+  { return stride ;
+  }
+
+  inline int EOS_FieldView::size() const
+  { return nsz ;
+  }
+
+  inline EOS_FieldView EOS_FieldView::sub(int begin, int n) const
+  { assert(begin >= 0 && begin <= nsz) ;
+    if (n < 0) n = nsz - begin ;
+    assert(begin + n <= nsz) ;
+    return EOS_FieldView(property_number, n, data + begin*stride, stride) ;
+  }
+}
+#endif
@@ -65,5 +65,12 @@ namespace NEPTUNE
   inline  int EOS_Field::size() const
   { return data.size() ;
   }
+
+  // an EOS_Field output is written through its data, as EOS_Field::operator= does
+  inline EOS_Field EOS_Field::sub(int begin, int n) const
+  { assert(begin >= 0 && n >= 0 && begin + n <= size()) ;
+    return EOS_Field(property_title.aschar(), property_name.aschar(), property_number,
+                     n, (double*) data.get_ptr() + begin) ;
+  }
 }
 #endif
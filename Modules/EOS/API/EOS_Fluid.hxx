@@ -35,6 +35,7 @@ namespace NEPTUNE
 {
   class EOS ;
   class EOS_Field ;
+  class EOS_FieldView ;
   class EOS_Error_Field ;
   class EOS_Fields; 
   //! Abstract root class for all fluids recognised bye EOS
@@ -84,6 +85,13 @@ namespace NEPTUNE
     virtual double get_prxm2();
     //!  provisional for EOS_Mixing
     virtual double get_prxdv();
+    //! true if field computes may run concurrently on disjoint parts
+    //! of the fields (no shared state), see EOS::set_parallel_chunk
+    virtual bool is_thread_safe() const ;
+    //! true if compute(p, h, EOS_Fields&) may share h(p,T) and T(p,h)
+    //! between the outputs ; false in a fluid that overrides the
+    //! single-field compute and still reaches EOS_Fluid::compute(p, h, r)
+    virtual bool fuses_fields() const ;
     //  provisional for EOS_Mixing
     //! the main "Fields" method!
     //! the EOS_Error returned value is a "global" error
@@ -120,6 +128,15 @@ namespace NEPTUNE
     virtual EOS_Error compute(const EOS_Field& p,
                               EOS_Field& output, 
                               EOS_Error_Field& errfield) const;
+    //! same as the "Field" methods above on EOS_FieldView
+    //! (no temporary UObject, see EOS_FieldView)
+    virtual EOS_Error compute(const EOS_FieldView& p, 
+                              const EOS_FieldView& h, 
+                              EOS_FieldView& r, 
+                              EOS_Error_Field& errfield) const;
+    virtual EOS_Error compute(const EOS_FieldView& p,
+                              EOS_FieldView& output, 
+                              EOS_Error_Field& errfield) const;
     EOS_Internal_Error compute(const char* const property_name,
                                double p, 
                                double h, 
@@ -1192,6 +1209,17 @@ namespace NEPTUNE
     virtual EOS_Internal_Error compute_d2_cp_v_sat_d_T_d_T_T(double T, double& r, double c_0,
                    double c_1=0, double c_2=0, double c_3=0, double c_4=0) const;
 
+    //! Newton solver on T_sat(p) behind the default compute_p_sat_T
+    //! reentrant : no state kept between calls
+    //! p_start > 0 : initial guess (e.g. previous result for the same cell)
+    //! otherwise the guess of init_p_sat_T_guess, or 1 bar
+    //! nb_iter : number of Newton iterations done
+    EOS_Internal_Error newton_p_sat_T(double T, double& p, double p_start, int& nb_iter) const;
+    //! samples T_sat(p) on n points in [pmin, pmax] and builds the cubic
+    //! (Hermite) guess ln p(T) used by newton_p_sat_T ; call at init,
+    //! before any concurrent compute
+    EOS_Internal_Error init_p_sat_T_guess(double pmin, double pmax, int n=32);
+
     //! list of all properties (for a given fluid) for which compute_* functions are implemented
     vector<string> is_implemented(const char* pprop1, const char* pprop2, 
                                   const vector<typrop> list_prop, double vprop1, double vprop2) ;
@@ -1204,8 +1232,16 @@ namespace NEPTUNE
  
   protected:
     EOS_Fluid();
+    //! several fields r(p,h) or r(p,T) evaluated together, shared
+    //! intermediates (h(p,T), T(p,h)) computed once
+    EOS_Error compute_fused(const EOS_Field& p,
+                            const EOS_Field& x,
+                            EOS_Fields& r,
+                            EOS_Error_Field& errfield) const;
   private: 
     static int type_Id;
+    //! guess for newton_p_sat_T : T_k, ln p_k, d ln p/dT at the nodes
+    vector<double> guess_T, guess_lnp, guess_dlnp;
   };
 }
 #include "EOS/API/EOS_Fluid_i.hxx"
@@ -37,6 +37,14 @@ namespace NEPTUNE
   }
 
 
+  inline bool EOS_Fluid::is_thread_safe() const
+  { return false ;
+  }
+
+  inline bool EOS_Fluid::fuses_fields() const
+  { return true ;
+  }
+
   // provisional for EOS_Mixing 
   inline double EOS_Fluid::get_prxr()
   { cerr << "Not allowed for non EOS_PerfectGas EOS !" << endl;
@@ -0,0 +1,146 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+
+
+#include "EOS_Index.hxx"
+#include "EOS/API/EOS_Config.hxx"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+using std::string ;
+#include "EOS/API/EOS_eosdatadir.hxx"
+
+namespace
+{
+  // registry state, guarded by index_mutex
+  std::mutex index_mutex ;
+  string index_dir ;                  // eos_data_dir when index.eos was read
+  int index_status = -1 ;             // -1 : not read, 0 : read, 2 : not found
+  std::unordered_map<string, NEPTUNE::EOS_Index_Entry> index_entries ;
+  std::unordered_map<string, string> data_files ;
+
+  string upper(const string& s)
+  { string r(s) ;
+    for (size_t i=0; i<r.size(); i++)  r[i] = (char) toupper((unsigned char) r[i]) ;
+    return r ;
+  }
+
+  // key of (model, equation) : uppercase, model without the "EOS_" prefix
+  string index_key(const string& tmname, const string& fename)
+  { string tm = upper(tmname) ;
+    if (tm.compare(0, 4, "EOS_") == 0)  tm.erase(0, 4) ;
+    return tm + ' ' + upper(fename) ;
+  }
+
+  // forget everything if eos_data_dir has changed (index_mutex held)
+  void check_dir()
+  { if (index_status != -1 && index_dir != eos_data_dir)
+       { index_status = -1 ;
+         index_entries.clear() ;
+         data_files.clear() ;
+       }
+  }
+
+  // read index.eos (index_mutex held)
+  void read_index()
+  { index_dir = eos_data_dir ;
+    string index_file_name = eos_data_dir + "/index.eos" ;
+    std::ifstream index_file_desc(index_file_name.c_str()) ;
+    if (!index_file_desc)
+       { index_status = 2 ;
+         return ;
+       }
+    index_status = 0 ;
+
+    // fields separated by blanks : model equation class fluid version nb_args args...
+    // (as before, a last line without end of line is ignored)
+    string line ;
+    while (std::getline(index_file_desc, line))
+       { if (index_file_desc.eof()) break ;
+         std::vector<string> words ;
+         size_t pos = 0 ;
+         while (pos < line.size())
+            { size_t beg = line.find_first_not_of(' ', pos) ;
+              if (beg == string::npos) break ;
+              size_t end = line.find(' ', beg) ;
+              if (end == string::npos) end = line.size() ;
+              words.push_back(line.substr(beg, end-beg)) ;
+              pos = end ;
+            }
+         if (words.size() < 3) continue ;
+
+         NEPTUNE::EOS_Index_Entry entry ;
+         entry.therm_model       = words[0] ;
+         entry.fluid_equa        = words[1] ;
+         entry.fluid_model_class = words[2] ;
+         if (words.size() > 5)
+            { int nb_args = atoi(words[5].c_str()) ;
+              for (int i=0; i<nb_args && 6+i<(int)words.size(); i++)
+                 entry.args.push_back(words[6+i]) ;
+              entry.args.resize(nb_args < 0 ? 0 : nb_args) ;
+            }
+         // first line wins
+         index_entries.emplace(index_key(words[0], words[1]), entry) ;
+       }
+  }
+}
+
+namespace NEPTUNE
+{
+  int EOS_Index::find(const char* const tmname, const char* const fename,
+                      EOS_Index_Entry& entry)
+  { std::lock_guard<std::mutex> lock(index_mutex) ;
+    check_dir() ;
+    if (index_status == -1)  read_index() ;
+    if (index_status == 2)   return 2 ;
+
+    auto it = index_entries.find(index_key(tmname, fename)) ;
+    if (it == index_entries.end())  return 1 ;
+    entry = it->second ;
+    return 0 ;
+  }
+
+  int EOS_Index::data_file(const string& path, string& content)
+  { std::lock_guard<std::mutex> lock(index_mutex) ;
+    check_dir() ;
+    auto it = data_files.find(path) ;
+    if (it != data_files.end())
+       { content = it->second ;
+         return 1 ;
+       }
+
+    std::ifstream file(path.c_str()) ;
+    if (!file)  return 0 ;
+    std::ostringstream buf ;
+    buf << file.rdbuf() ;
+    content = buf.str() ;
+    data_files.emplace(path, content) ;
+    return 1 ;
+  }
+
+  void EOS_Index::invalidate()
+  { std::lock_guard<std::mutex> lock(index_mutex) ;
+    index_status = -1 ;
+    index_entries.clear() ;
+    data_files.clear() ;
+  }
+}
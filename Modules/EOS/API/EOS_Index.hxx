@@ -0,0 +1,56 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+
+#ifndef EOS_Index_HH
+#define EOS_Index_HH
+
+#include <string>
+#include <vector>
+
+namespace NEPTUNE
+{
+  //! One line of index.eos
+  struct EOS_Index_Entry
+  { std::string therm_model ;             //!< Thermodynamic Model Name (as written)
+    std::string fluid_equa ;              //!< Fluid Equation Name (as written)
+    std::string fluid_model_class ;       //!< class name
+    std::vector<std::string> args ;       //!< supplementary arguments
+  } ;
+
+  //! Process-wide registry of the EOS data directory
+  //!
+  //! index.eos is parsed once, at first use, into a hash map keyed by the
+  //! uppercased (model without "EOS_", equation) pair. Data files read
+  //! through data_file() are kept in memory. Everything is read again if
+  //! eos_data_dir has changed since, or after invalidate().
+  //! All the methods are thread-safe.
+  class EOS_Index
+  {
+  public:
+    //! look for (model, equation) in index.eos
+    //! return 0 if found, 1 if not found, 2 if index.eos can not be read
+    static int find(const char* const tmname, const char* const fename,
+                    EOS_Index_Entry& entry) ;
+    //! content of the file path, read once
+    //! return 0 if the file can not be read
+    static int data_file(const std::string& path, std::string& content) ;
+    //! forget index.eos and the data files
+    static void invalidate() ;
+  } ;
+}
+#endif
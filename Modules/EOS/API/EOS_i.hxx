@@ -26,6 +26,7 @@
 #include "Language/API/Object_i.hxx"
 #include "EOS_Fluid.hxx"
 #include "EOS_Field.hxx"
+#include "EOS_FieldView.hxx"
 #include "EOS_Fields.hxx"
 #include "EOS_Error_Field.hxx"
 #include "EOS_Error_Handler.hxx"
@@ -137,28 +138,40 @@ namespace NEPTUNE
                                 const EOS_Field& h, 
                                 EOS_Field& r, 
                                 EOS_Error_Field& errfield) const
-  { fluid_model_obj.compute(p, h, r, errfield) ;
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(p, h, r, errfield) ;
+    else
+       fluid_model_obj.compute(p, h, r, errfield) ;
     RETURN_ERROR_FIELD(errfield, &p, &h, &r) ;
   }
 
   inline EOS_Error EOS::compute(const EOS_Fields& input, 
                                 EOS_Field& r, 
                                 EOS_Error_Field& errfield) const
-  { fluid_model_obj.compute(input, r, errfield) ;
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(input, r, errfield) ;
+    else
+       fluid_model_obj.compute(input, r, errfield) ;
     RETURN_ERROR_FIELD(errfield, &input, NULL, &r) ;
   }
 
   inline EOS_Error EOS::compute(const EOS_Fields& input, 
                                 EOS_Fields& r, 
                                 EOS_Error_Field& errfield) const
-  { fluid_model_obj.compute(input, r, errfield) ;
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(input, r, errfield) ;
+    else
+       fluid_model_obj.compute(input, r, errfield) ;
     RETURN_ERROR_FIELD(errfield, &input, NULL, &r) ;
   }
 
   inline EOS_Error EOS::compute(const EOS_Field& p, 
                                 EOS_Fields& r, 
                                 EOS_Error_Field& errfield) const
-  { fluid_model_obj.compute(p, r, errfield) ;
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(p, r, errfield) ;
+    else
+       fluid_model_obj.compute(p, r, errfield) ;
     RETURN_ERROR_FIELD(errfield, &p, NULL, &r) ;
   }
 
@@ -166,15 +179,47 @@ namespace NEPTUNE
                                 const EOS_Field& h, 
                                 EOS_Fields& r, 
                                 EOS_Error_Field& errfield) const
-  { fluid_model_obj.compute(p, h, r, errfield) ;
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(p, h, r, errfield) ;
+    else
+       fluid_model_obj.compute(p, h, r, errfield) ;
     RETURN_ERROR_FIELD(errfield, &p, &h, &r) ;
   }
 
   inline EOS_Error EOS::compute(const EOS_Field& p, 
                                 EOS_Field& r, 
                                 EOS_Error_Field& errfield) const
-  { fluid_model_obj.compute(p, r, errfield);
-    RETURN_ERROR_FIELD(errfield, &p, NULL, &r);
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(p, r, errfield) ;
+    else
+       fluid_model_obj.compute(p, r, errfield) ;
+    RETURN_ERROR_FIELD(errfield, &p, NULL, &r) ;
+  }
+
+  // an EOS_FieldView is not an UObject : the error handler does not get the arguments
+  inline EOS_Error EOS::compute(const EOS_FieldView& p, 
+                                const EOS_FieldView& h, 
+                                EOS_FieldView& r, 
+                                EOS_Error_Field& errfield) const
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(p, h, r, errfield) ;
+    else
+       fluid_model_obj.compute(p, h, r, errfield) ;
+    RETURN_ERROR_FIELD(errfield, NULL, NULL, NULL) ;
+  }
+
+  inline EOS_Error EOS::compute(const EOS_FieldView& p, 
+                                EOS_FieldView& r, 
+                                EOS_Error_Field& errfield) const
+  { if (nb_chunks(errfield.size()) > 0)
+       compute_chunks(p, r, errfield) ;
+    else
+       fluid_model_obj.compute(p, r, errfield) ;
+    RETURN_ERROR_FIELD(errfield, NULL, NULL, NULL) ;
+  }
+
+  inline EOS_Property EOS::property_number(const char* const property_name)
+  { return gen_property_number(property_name) ;
   }
 
   inline EOS_Error EOS::compute(const char* const property_name,
@@ -1059,6 +1104,15 @@ namespace NEPTUNE
     RETURN_ERROR(err, T, 0, r) ;
   }
 
+  inline EOS_Error EOS::newton_p_sat_T(double T, double& r, double p_start, int& nb_iter) const
+  { EOS_Internal_Error err = fluid_model_obj.newton_p_sat_T(T, r, p_start, nb_iter) ;
+    RETURN_ERROR(err, T, 0, r) ;
+  }
+
+  inline EOS_Error EOS::init_p_sat_T_guess(double pmin, double pmax, int n)
+  { return fluid_model_obj.init_p_sat_T_guess(pmin, pmax, n).generic_error() ;
+  }
+
   inline EOS_Error EOS::compute_rho_l_sat_T(double T, double& r) const
   { EOS_Internal_Error err = fluid_model_obj.compute_rho_l_sat_T(T, r) ;
     RETURN_ERROR(err, T, 0, r) ;
@@ -4073,6 +4127,14 @@ namespace NEPTUNE
     RETURN_ERROR(err, T, 0, r);
   }
 
+  inline void EOS::set_parallel_chunk(int chunk_size)
+  { parallel_chunk = chunk_size ;
+  }
+
+  inline int EOS::get_parallel_chunk() const
+  { return parallel_chunk ;
+  }
+
   // fluid() is used in mixing which is a nested EOS object
   inline EOS_Fluid & EOS::fluid() const
   {
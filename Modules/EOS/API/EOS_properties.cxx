@@ -0,0 +1,269 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+
+// Property name -> property number, in O(1).
+// The nam2num_*prop lists compare the name with each reference name in
+// turn (eostp_strcmp). Here the name is converted once like eostp_strcmp
+// does (lowercase, alphanumerical characters only) and looked up in a hash
+// table of the reference names, built at the first call. The value stored
+// for a reference name is the result of the lists themselves : same
+// numbers as before. A name which is not a reference name (abbreviation,
+// unknown, too long) goes on with the lists.
+
+#include "EOS/API/EOS_properties.hxx"
+#include <cstring>
+
+namespace
+{
+  using namespace NEPTUNE ;
+
+  // reference names of the lists of the *_properties_i.hxx files
+  // (a name missing here is still found by the lists, only slower ;
+  // test EOSPropertyNames : Tests/check_property_names.cmake)
+  const char* const reference_names[] =
+  {
+    // therm_properties_i.hxx
+    "p", "h", "t", "rho", "u", "s", "mu", "lambda", "cp", "cv", "sigma", "w",
+    "g", "f", "pr", "beta", "gamma", "dtdph", "dtdhp", "drhodph", "drhodhp",
+    "drhodtp", "drhodpt", "dudph", "dudhp", "dsdph", "dsdhp", "dmudph",
+    "dmudhp", "dlambdadph", "dlambdadhp", "dcpdph", "dcpdhp", "dcvdph",
+    "dcvdhp", "dsigmadph", "dsigmadhp", "dwdph", "dwdhp", "dgdph", "dgdhp",
+    "dfdph", "dfdhp", "dprdph", "dprdhp", "dbetadph", "dbetadhp", "dgammadph",
+    "dgammadhp", "dudtp", "dsdtp", "dsdpt", "dmudtp", "dmudpt", "dlambdadpt",
+    "dlambdadtp", "dcpdtp", "dcpdpt", "dcvdtp", "dcvdpt", "dsigmadtp",
+    "dwdtp", "dwdpt", "dgdtp", "dfdtp", "dprdtp", "dbetadtp", "dgammadtp",
+    "dhdtp", "dhdpt", "dhdsp", "dhdps",
+    // satur_properties_i.hxx
+    "psat", "tsat", "rholsat", "rhovsat", "hlsat", "hvsat", "cplsat",
+    "cpvsat", "drholsatdp", "drhovsatdp", "dhlsatdp", "dhvsatdp", "dcplsatdp",
+    "dcpvsatdp", "dtsatdp", "d2tsatdpdp",
+    // splim_properties_i.hxx
+    "plim", "hllim", "hvlim",
+    // camix_properties_i.hxx
+    "c0", "c1", "c2", "c3", "c4", "p0", "p1", "p2", "p3", "p4", "h0", "h1",
+    "h2", "h3", "h4", "t0", "rho0", "u0", "s0", "mu0", "lambda0", "cp0",
+    "sigma0", "w0", "g0", "f0", "pr0", "beta0", "gamma0", "tsat0", "rholsat0",
+    "rhovsat0", "hlsat0", "hvsat0", "cplsat0", "cpvsat0", "dncv", "rnc",
+    "mnc", "xnc", "xvap", "prgr", "dtdc0ph", "dt0dc0ph", "dtdc1ph",
+    "dt0dc1ph", "dtdc2ph", "dt0dc2ph", "dtdc3ph", "dt0dc3ph", "dtdc4ph",
+    "dt0dc4ph", "dtdp0h", "dtdh0p", "dt0dph", "dt0dhp", "dt0dp0h", "dt0dh0p",
+    "drhodc0ph", "drho0dc0ph", "drhodc1ph", "drho0dc1ph", "drhodc2ph",
+    "drho0dc2ph", "drhodc3ph", "drho0dc3ph", "drhodc4ph", "drho0dc4ph",
+    "drhodp0h", "drhodh0p", "drho0dph", "drho0dhp", "drho0dp0h", "drho0dh0p",
+    "dudc0ph", "du0dc0ph", "dudc1ph", "du0dc1ph", "dudc2ph", "du0dc2ph",
+    "dudc3ph", "du0dc3ph", "dudc4ph", "du0dc4ph", "dudp0h", "dudh0p",
+    "du0dph", "du0dhp", "du0dp0h", "du0dh0p", "dsdc0ph", "ds0dc0ph",
+    "dsdc1ph", "ds0dc1ph", "dsdc2ph", "ds0dc2ph", "dsdc3ph", "ds0dc3ph",
+    "dsdc4ph", "ds0dc4ph", "dsdp0h", "dsdh0p", "ds0dph", "ds0dhp", "ds0dp0h",
+    "ds0dh0p", "dmudc0ph", "dmu0dc0ph", "dmudc1ph", "dmu0dc1ph", "dmudc2ph",
+    "dmu0dc2ph", "dmudc3ph", "dmu0dc3ph", "dmudc4ph", "dmu0dc4ph", "dmudp0h",
+    "dmudh0p", "dmu0dph", "dmu0dhp", "dmu0dp0h", "dmu0dh0p", "dlambdadc0ph",
+    "dlambda0dc0ph", "dlambdadc1ph", "dlambda0dc1ph", "dlambdadc2ph",
+    "dlambda0dc2ph", "dlambdadc3ph", "dlambda0dc3ph", "dlambdadc4ph",
+    "dlambda0dc4ph", "dlambdadp0h", "dlambdadh0p", "dlambda0dph",
+    "dlambda0dhp", "dlambda0dp0h", "dlambda0dh0p", "dcpdc0ph", "dcp0dc0ph",
+    "dcpdc1ph", "dcp0dc1ph", "dcpdc2ph", "dcp0dc2ph", "dcpdc3ph", "dcp0dc3ph",
+    "dcpdc4ph", "dcp0dc4ph", "dcpdp0h", "dcpdh0p", "dcp0dph", "dcp0dhp",
+    "dcp0dp0h", "dcp0dh0p", "dsigmadc0ph", "dsigma0dc0ph", "dsigmadc1ph",
+    "dsigma0dc1ph", "dsigmadc2ph", "dsigma0dc2ph", "dsigmadc3ph",
+    "dsigma0dc3ph", "dsigmadc4ph", "dsigma0dc4ph", "dsigmadp0h", "dsigmadh0p",
+    "dsigma0dph", "dsigma0dhp", "dsigma0dp0h", "dsigma0dh0p", "dwdc0ph",
+    "dw0dc0ph", "dwdc1ph", "dw0dc1ph", "dwdc2ph", "dw0dc2ph", "dwdc3ph",
+    "dw0dc3ph", "dwdc4ph", "dw0dc4ph", "dwdp0h", "dwdh0p", "dw0dph", "dw0dhp",
+    "dw0dp0h", "dw0dh0p", "dgdc0ph", "dg0dc0ph", "dgdc1ph", "dg0dc1ph",
+    "dgdc2ph", "dg0dc2ph", "dgdc3ph", "dg0dc3ph", "dgdc4ph", "dg0dc4ph",
+    "dgdp0h", "dgdh0p", "dg0dph", "dg0dhp", "dg0dp0h", "dg0dh0p", "dfdc0ph",
+    "df0dc0ph", "dfdc1ph", "df0dc1ph", "dfdc2ph", "df0dc2ph", "dfdc3ph",
+    "df0dc3ph", "dfdc4ph", "df0dc4ph", "dfdp0h", "dfdh0p", "df0dph", "df0dhp",
+    "df0dp0h", "df0dh0p", "dprdc0ph", "dpr0dc0ph", "dprdc1ph", "dpr0dc1ph",
+    "dprdc2ph", "dpr0dc2ph", "dprdc3ph", "dpr0dc3ph", "dprdc4ph", "dpr0dc4ph",
+    "dprdp0h", "dprdh0p", "dpr0dph", "dpr0dhp", "dpr0dp0h", "dpr0dh0p",
+    "dbetadc0ph", "dbeta0dc0ph", "dbetadc1ph", "dbeta0dc1ph", "dbetadc2ph",
+    "dbeta0dc2ph", "dbetadc3ph", "dbeta0dc3ph", "dbetadc4ph", "dbeta0dc4ph",
+    "dbetadp0h", "dbetadh0p", "dbeta0dph", "dbeta0dhp", "dbeta0dp0h",
+    "dbeta0dh0p", "dgammadc0ph", "dgamma0dc0ph", "dgammadc1ph",
+    "dgamma0dc1ph", "dgammadc2ph", "dgamma0dc2ph", "dgammadc3ph",
+    "dgamma0dc3ph", "dgammadc4ph", "dgamma0dc4ph", "dgammadp0h", "dgammadh0p",
+    "dgamma0dph", "dgamma0dhp", "dgamma0dp0h", "dgamma0dh0p", "drholsatdc0ph",
+    "drholsat0dc0ph", "drholsatdc1ph", "drholsat0dc1ph", "drholsatdc2ph",
+    "drholsat0dc2ph", "drholsatdc3ph", "drholsat0dc3ph", "drholsatdc4ph",
+    "drholsat0dc4ph", "drholsatdp0h", "drholsatdh0p", "drholsat0dph",
+    "drholsat0dhp", "drholsat0dp0h", "drholsat0dh0p", "drhovsatdc0ph",
+    "drhovsat0dc0ph", "drhovsatdc1ph", "drhovsat0dc1ph", "drhovsatdc2ph",
+    "drhovsat0dc2ph", "drhovsatdc3ph", "drhovsat0dc3ph", "drhovsatdc4ph",
+    "drhovsat0dc4ph", "drhovsatdp0h", "drhovsatdh0p", "drhovsat0dph",
+    "drhovsat0dhp", "drhovsat0dp0h", "drhovsat0dh0p", "dhlsatdc0ph",
+    "dhlsat0dc0ph", "dhlsatdc1ph", "dhlsat0dc1ph", "dhlsatdc2ph",
+    "dhlsat0dc2ph", "dhlsatdc3ph", "dhlsat0dc3ph", "dhlsatdc4ph",
+    "dhlsat0dc4ph", "dhlsatdp0h", "dhlsatdh0p", "dhlsat0dph", "dhlsat0dhp",
+    "dhlsat0dp0h", "dhlsat0dh0p", "dhvsatdc0ph", "dhvsat0dc0ph",
+    "dhvsatdc1ph", "dhvsat0dc1ph", "dhvsatdc2ph", "dhvsat0dc2ph",
+    "dhvsatdc3ph", "dhvsat0dc3ph", "dhvsatdc4ph", "dhvsat0dc4ph",
+    "dhvsatdp0h", "dhvsatdh0p", "dhvsat0dph", "dhvsat0dhp", "dhvsat0dp0h",
+    "dhvsat0dh0p", "dcplsatdc0ph", "dcplsat0dc0ph", "dcplsatdc1ph",
+    "dcplsat0dc1ph", "dcplsatdc2ph", "dcplsat0dc2ph", "dcplsatdc3ph",
+    "dcplsat0dc3ph", "dcplsatdc4ph", "dcplsat0dc4ph", "dcplsatdp0h",
+    "dcplsatdh0p", "dcplsat0dph", "dcplsat0dhp", "dcplsat0dp0h",
+    "dcplsat0dh0p", "dcpvsatdc0ph", "dcpvsat0dc0ph", "dcpvsatdc1ph",
+    "dcpvsat0dc1ph", "dcpvsatdc2ph", "dcpvsat0dc2ph", "dcpvsatdc3ph",
+    "dcpvsat0dc3ph", "dcpvsatdc4ph", "dcpvsat0dc4ph", "dcpvsatdp0h",
+    "dcpvsatdh0p", "dcpvsat0dph", "dcpvsat0dhp", "dcpvsat0dp0h",
+    "dcpvsat0dh0p", "dtsatdc0ph", "dtsat0dc0ph", "dtsatdc1ph", "dtsat0dc1ph",
+    "dtsatdc2ph", "dtsat0dc2ph", "dtsatdc3ph", "dtsat0dc3ph", "dtsatdc4ph",
+    "dtsat0dc4ph", "dtsatdp0h", "dtsatdh0p", "dtsat0dph", "dtsat0dhp",
+    "dtsat0dp0h", "dtsat0dh0p", "dp0dph", "dp0dhp", "dp0dc0ph", "dp0dc1ph",
+    "dp0dc2ph", "dp0dc3ph", "dp0dc4ph", "dh0dph", "dh0dhp", "dh0dc0ph",
+    "dh0dc1ph", "dh0dc2ph", "dh0dc3ph", "dh0dc4ph", "dhdc1pt", "dhdc2pt",
+    "dhdc3pt", "dhdc4pt", "ddncvdph", "ddncvdhp", "drncdc0ph", "drncdc1ph",
+    "drncdc2ph", "drncdc3ph", "drncdc4ph", "dmncdc0ph", "dmncdc1ph",
+    "dmncdc2ph", "dmncdc3ph", "dmncdc4ph", "ddncvdc0ph", "ddncvdc1ph",
+    "ddncvdc2ph", "ddncvdc3ph", "ddncvdc4ph", "dmu0dtp", "dlambda0dtp",
+    "d2tsat0dp0dp0",
+    // c2iap_properties_i.hxx
+    "epstl", "hlspsc", "hlsvsc", "epstg", "hvspsc", "hvsvsc", "depstldph",
+    "depstldhp", "dhlspscdph", "dhlspscdhp", "dhlsvscdph", "dhlsvscdhp0",
+    "dhlsvscdhp", "dhlsvscdc1ph", "dhlsvscdc2ph", "dhlsvscdc3ph",
+    "dhlsvscdc4ph", "depstgdph", "depstgdhp", "depstgdc1ph", "depstgdc2ph",
+    "depstgdc3ph", "depstgdc4ph", "dhvspscdph", "dhvspscdhp", "dhvspscdc1ph",
+    "dhvspscdc2ph", "dhvspscdc3ph", "dhvspscdc4ph", "dhvsvscdph",
+    "dhvsvscdhp", "dhvsvscdc1ph", "dhvsvscdc2ph", "dhvsvscdc3ph",
+    "dhvsvscdc4ph",
+  } ;
+  const int nb_reference_names = sizeof(reference_names) / sizeof(reference_names[0]) ;
+
+  struct property_entry
+  { const char* name ;
+    EOS_thermprop therm ;
+    EOS_saturprop satur ;
+    EOS_splimprop splim ;
+    EOS_camixprop camix ;
+    EOS_c2iapprop c2iap ;
+  } ;
+
+  // open addressing, at most one quarter full
+  const int table_size = 2048 ;
+
+  // name converted as in eostp_strcmp, false if longer than PROPNAME_MSIZE
+  inline bool convert_name(const char* name, char* conv)
+  { int n = 0 ;
+    for (; *name; name++)
+       { short c = (short) *name ;
+         if ((po1_almaj <= c) && (c <= po2_almaj))
+            c = (short) (dec_alpha + c) ;
+         else if (!(((po1_almin <= c) && (c <= po2_almin)) || ((po1_numer <= c) && (c <= po2_numer))))
+            continue ;
+         if (n == PROPNAME_MSIZE-1)  return false ;
+         conv[n++] = (char) c ;
+       }
+    conv[n] = '\0' ;
+    return true ;
+  }
+
+  // FNV-1a
+  inline unsigned int hash_name(const char* name)
+  { unsigned int hs = 2166136261u ;
+    for (; *name; name++)
+       hs = (hs ^ (unsigned char) *name) * 16777619u ;
+    return hs ;
+  }
+
+  class property_table
+  { public :
+      property_table() : entries()
+      { for (int i=0; i<nb_reference_names; i++)
+           { const char* name = reference_names[i] ;
+             unsigned int k = hash_name(name) & (table_size-1) ;
+             while (entries[k].name && strcmp(entries[k].name, name))
+                k = (k+1) & (table_size-1) ;
+             property_entry& e = entries[k] ;
+             e.name  = name ;
+             e.therm = scan_thermprop(name) ;
+             e.satur = scan_saturprop(name) ;
+             e.splim = scan_splimprop(name) ;
+             e.camix = scan_camixprop(name) ;
+             e.c2iap = scan_c2iapprop(name) ;
+           }
+      }
+      const property_entry* find(const char* name) const
+      { char conv[PROPNAME_MSIZE] ;
+        if (!convert_name(name, conv))  return 0 ;
+        unsigned int k = hash_name(conv) & (table_size-1) ;
+        while (entries[k].name)
+           { if (strcmp(entries[k].name, conv) == 0)  return &entries[k] ;
+             k = (k+1) & (table_size-1) ;
+           }
+        return 0 ;
+      }
+    private :
+      property_entry entries[table_size] ;
+  } ;
+
+  // built once, thread safe initialization
+  inline const property_entry* find_property(const char* name)
+  { static const property_table table ;
+    return table.find(name) ;
+  }
+}
+
+namespace NEPTUNE
+{
+  EOS_thermprop nam2num_thermprop(const char* const name)
+  { const property_entry* e = find_property(name) ;
+    return e ? e->therm : scan_thermprop(name) ;
+  }
+
+  EOS_saturprop nam2num_saturprop(const char* const name)
+  { const property_entry* e = find_property(name) ;
+    return e ? e->satur : scan_saturprop(name) ;
+  }
+
+  EOS_splimprop nam2num_splimprop(const char* const name)
+  { const property_entry* e = find_property(name) ;
+    return e ? e->splim : scan_splimprop(name) ;
+  }
+
+  EOS_camixprop nam2num_camixprop(const char* const name)
+  { const property_entry* e = find_property(name) ;
+    return e ? e->camix : scan_camixprop(name) ;
+  }
+
+  EOS_c2iapprop nam2num_c2iapprop(const char* const name)
+  { const property_entry* e = find_property(name) ;
+    return e ? e->c2iap : scan_c2iapprop(name) ;
+  }
+
+  EOS_Property gen_property_number(const char* namep)
+  { const property_entry* e = find_property(namep) ;
+    if (e == 0)
+       { EOS_thermprop tprop = scan_thermprop(namep) ;
+         if (tprop != NotATProperty) return static_cast<EOS_Property>(tprop) ;
+         EOS_saturprop satprop = scan_saturprop(namep) ;
+         if (satprop != NotASatProperty) return static_cast<EOS_Property>(satprop) ;
+         EOS_splimprop splimprop = scan_splimprop(namep) ;
+         if (splimprop != NotASplimProperty) return static_cast<EOS_Property>(splimprop) ;
+         EOS_camixprop camixprop = scan_camixprop(namep) ;
+         if (camixprop != NotACamixProperty) return static_cast<EOS_Property>(camixprop) ;
+         return static_cast<EOS_Property>(scan_c2iapprop(namep)) ;
+       }
+    if (e->therm != NotATProperty)      return static_cast<EOS_Property>(e->therm) ;
+    if (e->satur != NotASatProperty)    return static_cast<EOS_Property>(e->satur) ;
+    if (e->splim != NotASplimProperty)  return static_cast<EOS_Property>(e->splim) ;
+    if (e->camix != NotACamixProperty)  return static_cast<EOS_Property>(e->camix) ;
+    return static_cast<EOS_Property>(e->c2iap) ;
+  }
+}
@@ -41,23 +41,9 @@ namespace NEPTUNE
 
   typedef int EOS_Property;
 
-  inline EOS_Property gen_property_number(const char* namep) 
-  {
-    EOS_thermprop tprop = nam2num_thermprop(namep) ;
-    if (tprop != NotATProperty) return static_cast<EOS_Property>(tprop) ;
-  
-    EOS_saturprop _satprop = nam2num_saturprop(namep) ;
-    if (_satprop != NotASatProperty) return static_cast<EOS_Property>(_satprop) ;
-  
-    EOS_splimprop _splimprop = nam2num_splimprop(namep) ;
-    if (_splimprop != NotASplimProperty) return static_cast<EOS_Property>(_splimprop) ;
-  
-    EOS_camixprop _camixprop = nam2num_camixprop(namep) ;
-    if (_camixprop != NotACamixProperty) return static_cast<EOS_Property>(_camixprop) ;
-  
-    EOS_c2iapprop _c2iapprop = nam2num_c2iapprop(namep) ;
-    return static_cast<EOS_Property>(_c2iapprop) ;
-  }
+  //! property number of a name, any category : one look-up in the hash
+  //! table of the names (EOS_properties.cxx) instead of the strcmp lists
+  EOS_Property gen_property_number(const char* namep) ;
 }
 
 
@@ -124,7 +124,10 @@ namespace NEPTUNE
     };
     
    
+  //! property number of a name, O(1) (table in EOS_properties.cxx)
   EOS_c2iapprop nam2num_c2iapprop(const char* const name)   ;
+  //! same, scanning the list of the names
+  EOS_c2iapprop scan_c2iapprop(const char* const name)   ;
   EOS_c2iapprop nam2num_dc2iapprop(const char* const name)  ;
 
 }
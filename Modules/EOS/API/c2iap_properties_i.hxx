@@ -21,7 +21,7 @@
 
 namespace NEPTUNE
 {
-  inline EOS_c2iapprop nam2num_c2iapprop(const char* const name)
+  inline EOS_c2iapprop scan_c2iapprop(const char* const name)
   { if (eostp_strcmp(name,"epstl")    == 0)  return epstl  ;
     if (eostp_strcmp(name,"hlspsc")   == 0)  return hlspsc ;
     if (eostp_strcmp(name,"hlsvsc")   == 0)  return hlsvsc ;
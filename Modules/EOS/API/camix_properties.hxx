@@ -884,7 +884,10 @@ namespace NEPTUNE
     };
     
    
+  //! property number of a name, O(1) (table in EOS_properties.cxx)
   EOS_camixprop nam2num_camixprop(const char* const name)   ;
+  //! same, scanning the list of the names
+  EOS_camixprop scan_camixprop(const char* const name)   ;
   EOS_camixprop nam2num_dcamixprop(const char* const name)  ;
   EOS_camixprop nam2num_d2camixprop(const char* const name) ;
 
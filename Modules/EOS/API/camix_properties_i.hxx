@@ -21,7 +21,7 @@
 
 namespace NEPTUNE
 {
-  inline EOS_camixprop nam2num_camixprop(const char* const name)
+  inline EOS_camixprop scan_camixprop(const char* const name)
   { if (eostp_strcmp(name,"c0")                     == 0)  return c_0                    ;
     if (eostp_strcmp(name,"c1")                     == 0)  return c_1                    ;
     if (eostp_strcmp(name,"c2")                     == 0)  return c_2                    ;
@@ -82,7 +82,10 @@ namespace NEPTUNE
       EOS_TSATPROPDER2 = d2_T_sat_d_p_d_p
     };
   
+  //! property number of a name, O(1) (table in EOS_properties.cxx)
   EOS_saturprop nam2num_saturprop(const char* const name)   ;
+  //! same, scanning the list of the names
+  EOS_saturprop scan_saturprop(const char* const name)   ;
   EOS_saturprop nam2num_dsaturprop(const char* const name)  ;
   EOS_saturprop nam2num_d2saturprop(const char* const name) ;
 
@@ -21,7 +21,7 @@
 
 namespace NEPTUNE
 {
-  inline EOS_saturprop nam2num_saturprop(const char* const name)
+  inline EOS_saturprop scan_saturprop(const char* const name)
   { if (eostp_strcmp(name,"psat")       == 0)  return p_sat            ;
     if (eostp_strcmp(name,"tsat")       == 0)  return T_sat            ;
     if (eostp_strcmp(name,"rholsat")    == 0)  return rho_l_sat        ;
@@ -49,7 +49,10 @@ namespace NEPTUNE
     { EOS_TLIMPROP = p_lim 
     };
 
+  //! property number of a name, O(1) (table in EOS_properties.cxx)
   EOS_splimprop nam2num_splimprop(const char* const name) ;
+  //! same, scanning the list of the names
+  EOS_splimprop scan_splimprop(const char* const name) ;
 
 }
 #include "EOS/API/splim_properties_i.hxx"
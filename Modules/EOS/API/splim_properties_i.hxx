@@ -21,7 +21,7 @@
 
 namespace NEPTUNE
 {
-  inline EOS_splimprop nam2num_splimprop(const char* const name)
+  inline EOS_splimprop scan_splimprop(const char* const name)
   { if (eostp_strcmp(name,"plim")  == 0)  return p_lim   ;
     if (eostp_strcmp(name,"hllim") == 0)  return h_l_lim ;
     if (eostp_strcmp(name,"hvlim") == 0)  return h_v_lim ;
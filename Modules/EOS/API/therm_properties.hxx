@@ -191,7 +191,10 @@ namespace NEPTUNE
       EOS_TPROPDER =  d_T_d_p_h
     };
 
+  //! property number of a name, O(1) (table in EOS_properties.cxx)
   EOS_thermprop nam2num_thermprop(const char* const name)  ;
+  //! same, scanning the list of the names
+  EOS_thermprop scan_thermprop(const char* const name)  ;
   EOS_thermprop nam2num_dthermprop(const char* const name) ;
 
 }
@@ -21,7 +21,7 @@
 
 namespace NEPTUNE
 {
-  inline EOS_thermprop nam2num_thermprop(const char* const name)
+  inline EOS_thermprop scan_thermprop(const char* const name)
   { if (eostp_strcmp(name,"p")          == 0)  return p              ;
     if (eostp_strcmp(name,"h")          == 0)  return h              ;
     if (eostp_strcmp(name,"t")          == 0)  return T              ;
@@ -1,5 +1,97 @@
 #include "EOS_py.hxx"
 #include <stdexcept>
+#include <memory>
+#include <climits>
+#include <cstring>
+
+namespace {
+
+// Vue sur le tableau d'un objet Python, relâchée en fin de portée
+class Buffer {
+public:
+    Buffer() : held(false) {}
+    ~Buffer() { if (held) PyBuffer_Release(&view); }
+
+    // type : 'd' (float64) ou 'i' (int32)
+    void get(PyObject* obj, bool writable, char type, const std::string& what) {
+        int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+        if (writable) flags |= PyBUF_WRITABLE;
+        if (PyObject_GetBuffer(obj, &view, flags) != 0) {
+            PyErr_Clear();
+            throw std::invalid_argument(what + ": C-contiguous" + (writable ? " writable" : "") + " array expected");
+        }
+        held = true;
+        const char* f = view.format ? view.format : "B";
+        size_t l = strlen(f);
+        const int one = 1;
+        const char native = *(const char*)&one ? '<' : '>';
+        bool ok = (l == 1 || (l == 2 && (f[0] == '@' || f[0] == '=' || f[0] == native)))
+               && view.itemsize == (Py_ssize_t)(type == 'd' ? sizeof(double) : sizeof(int))
+               && (f[l-1] == type || (type == 'i' && f[l-1] == 'l'));
+        if (!ok)
+            throw std::invalid_argument(what + (type == 'd' ? ": float64 array expected" : ": int32 array expected"));
+    }
+
+    Py_ssize_t size() const { return view.len / view.itemsize; }
+
+    Py_buffer view;
+
+private:
+    bool held;
+    Buffer(const Buffer&);
+    Buffer& operator=(const Buffer&);
+};
+
+// Relâche le GIL le temps du calcul, y compris en cas d'exception
+class Without_GIL {
+public:
+    Without_GIL() : state(PyEval_SaveThread()) {}
+    ~Without_GIL() { PyEval_RestoreThread(state); }
+private:
+    PyThreadState* state;
+};
+
+// Sorties : un tableau (nb_prop, n) ou une séquence de nb_prop tableaux de n valeurs
+void get_outputs(PyObject* out, int nb_prop, Py_ssize_t n,
+                 std::unique_ptr<Buffer[]>& bufs, std::vector<double*>& ptr) {
+    ptr.resize(nb_prop);
+    if (PyObject_CheckBuffer(out)) {
+        bufs.reset(new Buffer[1]);
+        bufs[0].get(out, true, 'd', "out");
+        const Py_buffer& v = bufs[0].view;
+        bool ok = (v.ndim == 2 && v.shape[0] == nb_prop && v.shape[1] == n)
+               || (v.ndim == 1 && nb_prop == 1 && v.shape[0] == n);
+        if (!ok)
+            throw std::invalid_argument("out: shape (len(str_out), n) expected");
+        for (int i = 0; i < nb_prop; i++)
+            ptr[i] = (double*)v.buf + i * n;
+        return;
+    }
+    if (!PySequence_Check(out) || PySequence_Size(out) != nb_prop) {
+        PyErr_Clear();
+        throw std::invalid_argument("out: array or sequence of len(str_out) arrays expected");
+    }
+    bufs.reset(new Buffer[nb_prop]);
+    for (int i = 0; i < nb_prop; i++) {
+        PyObject* item = PySequence_GetItem(out, i);
+        if (!item) {
+            PyErr_Clear();
+            throw std::invalid_argument("out: array or sequence of len(str_out) arrays expected");
+        }
+        try {
+            bufs[i].get(item, true, 'd', "out[" + std::to_string(i) + "]");
+        } catch (...) {
+            Py_DECREF(item);
+            throw;
+        }
+        Py_DECREF(item);   // la vue garde sa propre référence
+        if (bufs[i].size() != n)
+            throw std::invalid_argument("out[" + std::to_string(i) + "]: size differs from the inputs");
+        ptr[i] = (double*)bufs[i].view.buf;
+    }
+}
+
+}
 
 EOS_py::EOS_py(const std::string& meth, const std::string& ref) {
     liquid = new NEPTUNE::EOS(meth.c_str(), ref.c_str());
@@ -9,6 +101,15 @@ EOS_py::~EOS_py() {
     delete liquid;
 }
 
+// verrou pris seulement pour un fluide non réentrant ; il est toujours
+// relâché avant de reprendre le GIL, pas d'interblocage avec compute()
+std::unique_lock<std::mutex> EOS_py::compute_lock() {
+    std::unique_lock<std::mutex> lock(compute_mutex, std::defer_lock);
+    if (!liquid->fluid().is_thread_safe())
+        lock.lock();
+    return lock;
+}
+
 std::vector<std::vector<double>> EOS_py::compute(
     std::string str_P,
     std::string str_H,
@@ -38,7 +139,11 @@ std::vector<std::vector<double>> EOS_py::compute(
     NEPTUNE::EOS_Error_Field eos_error_field(nb_calc, &error[0]);
 
     // Calcul
-    NEPTUNE::EOS_Error worst = liquid->compute(inputP, inputH, outputs, eos_error_field);
+    NEPTUNE::EOS_Error worst;
+    {
+        std::unique_lock<std::mutex> lock = compute_lock();
+        worst = liquid->compute(inputP, inputH, outputs, eos_error_field);
+    }
     if (worst != NEPTUNE::EOS_Error::good) {
         throw std::runtime_error("Bad computation: Worst_error = " + std::to_string(worst));
     }
@@ -80,7 +185,11 @@ std::vector<std::vector<double>> EOS_py::compute_sat(
     NEPTUNE::EOS_Error_Field eos_error_field(nb_calc, &error[0]);
 
     // Calcul
-    NEPTUNE::EOS_Error worst = liquid->compute(inputP, outputs, eos_error_field);
+    NEPTUNE::EOS_Error worst;
+    {
+        std::unique_lock<std::mutex> lock = compute_lock();
+        worst = liquid->compute(inputP, outputs, eos_error_field);
+    }
     if (worst != NEPTUNE::EOS_Error::good) {
         throw std::runtime_error("Bad computation: Worst_error = " + std::to_string(worst));
     }
@@ -96,3 +205,92 @@ std::vector<std::vector<double>> EOS_py::compute_sat(
     return result;
 }
 
+int EOS_py::compute_arrays(
+    const std::string& str_P,
+    const std::string& str_H,
+    PyObject* tab_P,
+    PyObject* tab_H,
+    const std::vector<std::string>& str_out,
+    PyObject* out,
+    PyObject* err
+) {
+    Buffer bP, bH, berr;
+    bP.get(tab_P, false, 'd', "tab_P");
+    bH.get(tab_H, false, 'd', "tab_H");
+    berr.get(err, true, 'i', "err");
+    Py_ssize_t n = bP.size();
+    if (bH.size() != n || berr.size() != n)
+        throw std::invalid_argument("tab_P, tab_H, err: sizes differ");
+    if (n > INT_MAX)
+        throw std::invalid_argument("tab_P: too many values");
+    int nb_calc = (int)n;
+    int nb_prop = str_out.size();
+
+    std::unique_ptr<Buffer[]> bout;
+    std::vector<double*> ptr_out;
+    get_outputs(out, nb_prop, n, bout, ptr_out);
+
+    // Entrées : les tableaux ne sont que lus
+    NEPTUNE::EOS_Field inputP("Input 1", str_P.c_str(), nb_calc, (double*)bP.view.buf);
+    NEPTUNE::EOS_Field inputH("Input 2", str_H.c_str(), nb_calc, (double*)bH.view.buf);
+
+    // Sorties : vues sur les tableaux de l'appelant (init copierait les valeurs)
+    NEPTUNE::EOS_Fields outputs(nb_prop);
+    for (int i = 0; i < nb_prop; i++)
+        outputs[i] = NEPTUNE::EOS_Field(str_out[i].c_str(), str_out[i].c_str(), nb_calc, ptr_out[i]);
+
+    // Champ erreur
+    NEPTUNE::EOS_Error_Field eos_error_field(nb_calc, (int*)berr.view.buf);
+
+    // Calcul
+    NEPTUNE::EOS_Error worst;
+    {
+        Without_GIL nogil;
+        std::unique_lock<std::mutex> lock = compute_lock();
+        worst = liquid->compute(inputP, inputH, outputs, eos_error_field);
+    }
+    return worst;
+}
+
+int EOS_py::compute_sat_arrays(
+    const std::string& str_P,
+    PyObject* tab_P,
+    const std::vector<std::string>& str_out,
+    PyObject* out,
+    PyObject* err
+) {
+    Buffer bP, berr;
+    bP.get(tab_P, false, 'd', "tab_P");
+    berr.get(err, true, 'i', "err");
+    Py_ssize_t n = bP.size();
+    if (berr.size() != n)
+        throw std::invalid_argument("tab_P, err: sizes differ");
+    if (n > INT_MAX)
+        throw std::invalid_argument("tab_P: too many values");
+    int nb_calc = (int)n;
+    int nb_prop = str_out.size();
+
+    std::unique_ptr<Buffer[]> bout;
+    std::vector<double*> ptr_out;
+    get_outputs(out, nb_prop, n, bout, ptr_out);
+
+    // Entrées : le tableau n'est que lu
+    NEPTUNE::EOS_Field inputP("Input 1", str_P.c_str(), nb_calc, (double*)bP.view.buf);
+
+    // Sorties : vues sur les tableaux de l'appelant (init copierait les valeurs)
+    NEPTUNE::EOS_Fields outputs(nb_prop);
+    for (int i = 0; i < nb_prop; i++)
+        outputs[i] = NEPTUNE::EOS_Field(str_out[i].c_str(), str_out[i].c_str(), nb_calc, ptr_out[i]);
+
+    // Champ erreur
+    NEPTUNE::EOS_Error_Field eos_error_field(nb_calc, (int*)berr.view.buf);
+
+    // Calcul
+    NEPTUNE::EOS_Error worst;
+    {
+        Without_GIL nogil;
+        std::unique_lock<std::mutex> lock = compute_lock();
+        worst = liquid->compute(inputP, outputs, eos_error_field);
+    }
+    return worst;
+}
@@ -1,10 +1,19 @@
 #ifndef EOS_PY_HXX
 #define EOS_PY_HXX
 
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
 #include <vector>
 #include <string>
+#include <mutex>
 #include "EOS/API/EOS.hxx"
 
+// Threads : compute_arrays / compute_sat_arrays relâchent le GIL pendant le
+// calcul, plusieurs threads Python peuvent donc calculer en même temps.
+// Sur un même objet EOS_py, les calculs sont sérialisés par un mutex quand
+// le fluide n'est pas réentrant (EOS_Fluid::is_thread_safe() faux :
+// Ipp, Refprop, Cathare2...), et concurrents sinon. Des objets EOS_py
+// différents ne partagent rien au-delà de ce que partage leur fluide.
 class EOS_py {
 public:
     EOS_py(const std::string& meth, const std::string& ref);
@@ -24,8 +33,36 @@ public:
         std::vector<std::string> str_out
     );
 
+    // Variantes sans copie : les tableaux de l'appelant (numpy ou tout objet
+    // supportant le buffer protocol, C-contigus) sont utilisés directement
+    // comme champs EOS et le calcul s'exécute sans le GIL.
+    //   tab_P, tab_H : float64, n valeurs
+    //   out          : float64 (nb_prop, n) ou sequence de nb_prop tableaux de n valeurs
+    //   err          : int32, n valeurs, recoit les codes d'erreur
+    // Retourne l'erreur la plus grave (EOS_Error), sans lever d'exception.
+    int compute_arrays(
+        const std::string& str_P,
+        const std::string& str_H,
+        PyObject* tab_P,
+        PyObject* tab_H,
+        const std::vector<std::string>& str_out,
+        PyObject* out,
+        PyObject* err
+    );
+
+    int compute_sat_arrays(
+        const std::string& str_P,
+        PyObject* tab_P,
+        const std::vector<std::string>& str_out,
+        PyObject* out,
+        PyObject* err
+    );
+
 private:
     NEPTUNE::EOS* liquid;
+    //! sérialise les calculs si le fluide n'est pas réentrant
+    std::mutex compute_mutex;
+    std::unique_lock<std::mutex> compute_lock();
 };
 
 #endif
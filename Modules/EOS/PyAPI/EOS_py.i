@@ -7,6 +7,18 @@
 /* Support automatique pour std::string et std::vector */
 %include "std_string.i"
 %include "std_vector.i"
+%include "exception.i"
+
+/* Exceptions C++ -> exceptions Python (ValueError pour les tableaux mal formés) */
+%exception {
+    try {
+        $action
+    } catch (const std::invalid_argument& e) {
+        SWIG_exception(SWIG_ValueError, e.what());
+    } catch (const std::exception& e) {
+        SWIG_exception(SWIG_RuntimeError, e.what());
+    }
+}
 
 namespace std {
     %template(DoubleVector) vector<double>;
@@ -14,5 +26,10 @@ namespace std {
     %template(DoubleVectorVector) vector<vector<double>>;
 }
 
+/* compute_arrays / compute_sat_arrays : les PyObject* (tableaux numpy) sont
+   passés tels quels, sans conversion ni copie, par exemple :
+     out = numpy.empty((len(props), n)) ; err = numpy.zeros(n, dtype=numpy.int32)
+     worst = eos.compute_arrays("P", "h", p, h, props, out, err)              */
+
 /* Inclure la classe à exposer */
 %include "EOS_py.hxx"
\ No newline at end of file
@@ -28,12 +28,11 @@ extern "C"
 
 namespace CATHARE2
 {
-  bool CATHARE2::in_erpile = false          ;
+  thread_local bool CATHARE2::in_erpile = false ;
   const double CATHARE2::tabsk = 273.15e0   ;
-  TH_space CATHARE2::typ_ths = TH_space::no ;
 
   CATHARE2::CATHARE2(NEPTUNE::EOS_Fluid* fld, domain ph, int c2ref) :
-      nincon(0), un(1.e0), zero(0.e0), epspp(1.e3),
+      nincon(0), typ_ths(TH_space::no), un(1.e0), zero(0.e0), epspp(1.e3),
       fluid(fld), phase(ph), 
       fldm(-1.e0),
       tc(-1.e0), hc(-1.e0), 
@@ -138,971 +137,971 @@ namespace CATHARE2
     switch(f.get_property_number())
        { // Thermodynamic Properties 
          case NEPTUNE::p:
-            lp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lp, f);
             break;
          case NEPTUNE::h:
             if (mode == liquid) 
                { if (typ_ths == TH_space::PT)
-                    lhlpt.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lhlpt, f);
                  else
-                    lhl.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lhl, f);
                }
             else if (mode == vapor) 
                {  if (nincon == 0 && typ_ths == TH_space::PT)
-                     lhvpt.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lhvpt, f);
                   else
-                     { lhl.set_ptr(nsca, f.get_data().get_ptr()); // epstl l/v
-                       lhg.set_ptr(nsca, f.get_data().get_ptr());
+                     { map_ptr(lhl, f); // epstl l/v
+                       map_ptr(lhg, f);
                      }
                }
-            else if (mode == unknown) lh.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lh, f);
             else return 0;
             break;
          case NEPTUNE::T:
-            if (mode == liquid) ltl.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltg.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lt.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltl, f);
+            else if (mode == vapor) map_ptr(ltg, f);
+            else if (mode == unknown) map_ptr(lt, f);
             else return 0;
             break;
          case NEPTUNE::rho:
             if (mode == liquid) 
                { if (typ_ths == TH_space::PT)
-                    lrlpt.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lrlpt, f);
                  else
-                    lrl.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lrl, f);
                }
             else if (mode == vapor)
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                   lrvpt.set_ptr(nsca, f.get_data().get_ptr());
+                   map_ptr(lrvpt, f);
                  else
-                   lrg.set_ptr(nsca, f.get_data().get_ptr());
+                   map_ptr(lrg, f);
                }
-            else if (mode == unknown) lr.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lr, f);
             else return 0;
             break;
          case NEPTUNE::cp:
             if (mode == liquid) 
                 { if (typ_ths == TH_space::PT)
-                     lcplpt.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lcplpt, f);
                   else
-                     lcpl.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lcpl, f);
                 }
             else if (mode == vapor) 
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                    lcpvpt.set_ptr(nsca, f.get_data().get_ptr()) ;
+                    map_ptr(lcpvpt, f) ;
                  else
-                    lcpg.set_ptr(nsca, f.get_data().get_ptr()) ;
+                    map_ptr(lcpg, f) ;
                }
-            else if (mode == unknown) lcp.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lcp, f);
             else return 0;
             break;
          case NEPTUNE::beta:
-            if (mode == liquid) lbetal.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lbetal.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lbetal, f);
+            else if (mode == unknown) map_ptr(lbetal, f);
             else return 0;
             break;
          case NEPTUNE::lambda:
-            if (mode == liquid) ltlal.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltlag.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lla.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltlal, f);
+            else if (mode == vapor) map_ptr(ltlag, f);
+            else if (mode == unknown) map_ptr(lla, f);
             else return 0;
             break;
          case NEPTUNE::mu:
-            if (mode == liquid) ltmul.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltmug.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lmu.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltmul, f);
+            else if (mode == vapor) map_ptr(ltmug, f);
+            else if (mode == unknown) map_ptr(lmu, f);
             else return 0;
             break;
          case NEPTUNE::sigma:
-            if (mode == vapor) lsi.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lsi.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == vapor) map_ptr(lsi, f);
+            else if (mode == unknown) map_ptr(lsi, f);
             break;
          case NEPTUNE::gamma:
-            lkiseng.set_ptr(nsca, f.get_data().get_ptr()); break;
+            map_ptr(lkiseng, f); break;
          case NEPTUNE::pr:
-            if (mode == vapor) lprandg.set_ptr(nsca, f.get_data().get_ptr());
-            if (mode == unknown) lprandg.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == vapor) map_ptr(lprandg, f);
+            if (mode == unknown) map_ptr(lprandg, f);
             else return 0;
             break;
          // First Derivatives
          case NEPTUNE::d_T_d_p_h:
-            if (mode == liquid) ltl1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltg1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lt1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltl1, f);
+            else if (mode == vapor) map_ptr(ltg1, f);
+            else if (mode == unknown) map_ptr(lt1, f);
             else return 0;
             break;
          case NEPTUNE::d_T_d_h_p:
-            if (mode == liquid) ltl2.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltg3.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lt2.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltl2, f);
+            else if (mode == vapor) map_ptr(ltg3, f);
+            else if (mode == unknown) map_ptr(lt2, f);
             else return 0;
             break;
          case NEPTUNE::d_h_d_T_p:
             if (mode == liquid) 
                { if (typ_ths == TH_space::PT)
-                   lhl2pt.set_ptr(nsca, f.get_data().get_ptr());
+                   map_ptr(lhl2pt, f);
                  else
-                   lhl2.set_ptr(nsca, f.get_data().get_ptr());
+                   map_ptr(lhl2, f);
                 }
             else if (mode == vapor) 
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                    lcpvpt.set_ptr(nsca, f.get_data().get_ptr()) ;
+                    map_ptr(lcpvpt, f) ;
                  else
-                    lcpg.set_ptr(nsca, f.get_data().get_ptr()) ;
+                    map_ptr(lcpg, f) ;
                }
             else return 0;
             break;
          case NEPTUNE::d_h_d_p_T:
             if (mode == liquid) 
                 { if (typ_ths == TH_space::PT)
-                     lhl1pt.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lhl1pt, f);
                   else
-                     lhl1.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lhl1, f);
                 }
             else if (mode == vapor) 
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                    lhv1pt.set_ptr(nsca, f.get_data().get_ptr()); 
+                    map_ptr(lhv1pt, f); 
                  else
-                    lhg1.set_ptr(nsca, f.get_data().get_ptr()); 
+                    map_ptr(lhg1, f); 
                }
             else return 0;
             break;
          case NEPTUNE::d_rho_d_p_h:
-            if (mode == liquid) lrl1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lrl1, f);
             else if (mode == vapor)
                { if (nincon == 0) 
-                    lrvpv.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lrvpv, f);
                  else
-                    lrg1.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lrg1, f);
                }
-            else if (mode == unknown) lr1.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lr1, f);
             else return 0;
             break;
          case NEPTUNE::d_rho_d_h_p:
-            if (mode == liquid) lrl2.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lrl2, f);
             else if (mode == vapor)
                   { if (nincon == 0) 
-                       lrvhv.set_ptr(nsca, f.get_data().get_ptr());
+                       map_ptr(lrvhv, f);
                     else
-                       lrg3.set_ptr(nsca, f.get_data().get_ptr());
+                       map_ptr(lrg3, f);
                   }
-            else if (mode == unknown) lr2.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lr2, f);
             else return 0;
             break;
          case NEPTUNE::d_rho_d_p_T:
-            if      (mode == liquid) lrl1pt.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) lrv1pt.set_ptr(nsca, f.get_data().get_ptr());
+            if      (mode == liquid) map_ptr(lrl1pt, f);
+            else if (mode == vapor) map_ptr(lrv1pt, f);
             else return 0;
             break;
          case NEPTUNE::d_rho_d_T_p:
-            if      (mode == liquid) lrl2pt.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor)  lrv3pt.set_ptr(nsca, f.get_data().get_ptr());
+            if      (mode == liquid) map_ptr(lrl2pt, f);
+            else if (mode == vapor)  map_ptr(lrv3pt, f);
             break;
          case NEPTUNE::d_cp_d_p_h:
-            if (mode == liquid) lcpl1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lcpl1, f);
             else if (mode == vapor) 
                { if (nincon == 0)
-                     lcpvpv.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lcpvpv, f);
                  else
-                     lcpg1.set_ptr(nsca, f.get_data().get_ptr());
+                     map_ptr(lcpg1, f);
                }
-            else if (mode == unknown) lcp1.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lcp1, f);
             break;
          case NEPTUNE::d_cp_d_h_p:
-            if (mode == liquid) lcpl2.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lcpl2, f);
             else if (mode == vapor)
                { if (nincon == 0)
-                    lcpvhv.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lcpvhv, f);
                  else
-                    lcpg3.set_ptr(nsca, f.get_data().get_ptr());
+                    map_ptr(lcpg3, f);
                }
-            else if (mode == unknown) lcp2.set_ptr(nsca, f.get_data().get_ptr());
+            else if (mode == unknown) map_ptr(lcp2, f);
             else return 0;
             break;
          case NEPTUNE::d_beta_d_p_h:
-            if (mode == liquid) lbetal1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lbetal1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lbetal1, f);
+            else if (mode == unknown) map_ptr(lbetal1, f);
             else return 0;
             break;
          case NEPTUNE::d_beta_d_h_p:
-            if (mode == liquid) lbetal2.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lbetal2.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(lbetal2, f);
+            else if (mode == unknown) map_ptr(lbetal2, f);
             else return 0;
             break;
          case NEPTUNE::d_lambda_d_p_h:
-            if (mode == liquid) ltlal1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltlag1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lla1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltlal1, f);
+            else if (mode == vapor) map_ptr(ltlag1, f);
+            else if (mode == unknown) map_ptr(lla1, f);
             else return 0;
             break;
          case NEPTUNE::d_lambda_d_h_p:
-            if (mode == liquid) ltlal2.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltlag3.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lla2.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltlal2, f);
+            else if (mode == vapor) map_ptr(ltlag3, f);
+            else if (mode == unknown) map_ptr(lla2, f);
             else return 0;
             break;
          case NEPTUNE::d_lambda_d_T_p:
-            if (mode == vapor) llagtg.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) llagtg.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == vapor) map_ptr(llagtg, f);
+            else if (mode == unknown) map_ptr(llagtg, f);
             else return 0;
             break;
          case NEPTUNE::d_mu_d_p_h:
-            if (mode == liquid) ltmul1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltmug1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lmu1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltmul1, f);
+            else if (mode == vapor) map_ptr(ltmug1, f);
+            else if (mode == unknown) map_ptr(lmu1, f);
             else return 0;
             break;
          case NEPTUNE::d_mu_d_h_p:
-            if (mode == liquid) ltmul2.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor) ltmug3.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lmu2.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == liquid) map_ptr(ltmul2, f);
+            else if (mode == vapor) map_ptr(ltmug3, f);
+            else if (mode == unknown) map_ptr(lmu2, f);
             else return 0;
             break;
          case NEPTUNE::d_mu_d_T_p:
-            if (mode == vapor) lmugtg.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == vapor) map_ptr(lmugtg, f);
             else return 0;
             break;
          case NEPTUNE::d_sigma_d_p_h:
-            if (mode == vapor) lsi1.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lsi1.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == vapor) map_ptr(lsi1, f);
+            else if (mode == unknown) map_ptr(lsi1, f);
             else return 0;
             break;
          case NEPTUNE::d_sigma_d_h_p:
-            if (mode == vapor) lsi3.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lsi3.set_ptr(nsca, f.get_data().get_ptr());
+            if (mode == vapor) map_ptr(lsi3, f);
+            else if (mode == unknown) map_ptr(lsi3, f);
             else return 0;
             break;
          case NEPTUNE::d_cp_d_p_T:
-            if      (mode == liquid)  lcpl1pt.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor)   lcpvpvpt.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == unknown) lcpl1pt.set_ptr(nsca,  f.get_data().get_ptr());
+            if      (mode == liquid)  map_ptr(lcpl1pt, f);
+            else if (mode == vapor)   map_ptr(lcpvpvpt, f);
+            else if (mode == unknown) map_ptr(lcpl1pt, f);
             else return 0;
             break;
          case NEPTUNE::d_cp_d_T_p:
-            if      (mode == liquid)  lcpl2pt.set_ptr(nsca, f.get_data().get_ptr());
-            else if (mode == vapor)   lcpgtgpt.set_ptr(nsca,  f.get_data().get_ptr());
-            else if (mode == unknown) lcpgtg.set_ptr(nsca,  f.get_data().get_ptr());
+            if      (mode == liquid)  map_ptr(lcpl2pt, f);
+            else if (mode == vapor)   map_ptr(lcpgtgpt, f);
+            else if (mode == unknown) map_ptr(lcpgtg, f);
             else return 0;
             break;
             
          // Saturation of Thermodynamic Properties
          case NEPTUNE::p_sat:
-            lp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lp, f);
             break;
          case NEPTUNE::T_sat:
-            ltsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(ltsp, f);
             break;
          case NEPTUNE::h_l_sat:
-            lhlsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lhlsp, f);
             break;
          case NEPTUNE::h_v_sat:
-            lhvsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lhvsp, f);
             break;
          case NEPTUNE::cp_l_sat:
-            lcplsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lcplsp, f);
             break;
          case NEPTUNE::cp_v_sat:
-            lcpvsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lcpvsp, f);
             break;
          case NEPTUNE::rho_l_sat:
-            lrlsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lrlsp, f);
             break;
          case NEPTUNE::rho_v_sat:
-            lrvsp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lrvsp, f);
             break;
          // First Derivatives
          case NEPTUNE::d_T_sat_d_p:
-            ltsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(ltsp1, f);
             break;
          case NEPTUNE::d_h_l_sat_d_p:
-            lhlsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lhlsp1, f);
             break;
          case NEPTUNE::d_h_v_sat_d_p:
-            lhvsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lhvsp1, f);
             break;
          case NEPTUNE::d_cp_l_sat_d_p:
-            lclsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lclsp1, f);
             break;
          case NEPTUNE::d_cp_v_sat_d_p:
-            lcvsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lcvsp1, f);
             break;
          case NEPTUNE::d_rho_l_sat_d_p:
-            lrlsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lrlsp1, f);
             break;
          case NEPTUNE::d_rho_v_sat_d_p:
-            lrvsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lrvsp1, f);
             break;
          // Second Derivatives
          case NEPTUNE::d2_T_sat_d_p_d_p:
-            l2tsp1.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(l2tsp1, f);
             break;
             
          // Spinodale limites Thermodynamic Properties
          case NEPTUNE::p_lim:
-            lp.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(lp, f);
             break;
          case NEPTUNE::h_l_lim:
-            hllim.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(hllim, f);
             break;
          case NEPTUNE::h_v_lim:
-            hvlim.set_ptr(nsca, f.get_data().get_ptr());
+            map_ptr(hvlim, f);
             break;
             
          // Cathare Mixing Thermodynamic Properties
          case NEPTUNE::c_0:
             if (nincon > 0 && mode == vapor)
-              lxvap.set_ptr(nsca, f.get_data().get_ptr());
+              map_ptr(lxvap, f);
             else return 0;
             break;
          case NEPTUNE::c_1:
-            if (nincon > 0 && mode == vapor) lx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lx[0], f);
             else return 0;     
             break;
          case NEPTUNE::c_2: 
-            if (nincon > 0 && mode == vapor) lx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lx[1], f);
             else return 0;     
             break;
          case NEPTUNE::c_3:
-            if (nincon > 0 && mode == vapor) lx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lx[2], f);
             else return 0;     
             break;
          case NEPTUNE::c_4:
-            if (nincon > 0 && mode == vapor) lx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lx[3], f);
             else return 0;     
             break;
          case NEPTUNE::p_0:
-            if (nincon > 0 && mode == vapor) lpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpv, f);
             else return 0;     
             break ;
          case NEPTUNE::p_1:
-            if (nincon > 0 && mode == vapor) lpx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpx[0], f);
             else return 0;
             break;
          case NEPTUNE::p_2:
-            if (nincon > 0 && mode == vapor) lpx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpx[1], f);
             else return 0;
             break;
          case NEPTUNE::p_3:
-            if (nincon > 0 && mode == vapor) lpx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpx[2], f);
             else return 0;     
             break;
          case NEPTUNE::p_4:
-            if (nincon > 0 && mode == vapor) lpx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpx[3], f);
             else return 0;
             break;
          case NEPTUNE::h_0:
-            if (nincon > 0 && mode == vapor) lhv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhv, f);
             else return 0;
             break;
          case NEPTUNE::h_1:
-            if (nincon > 0 && mode == vapor) lhx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhx[0], f);
             else return 0;     
             break;
          case NEPTUNE::h_2:
-            if (nincon > 0 && mode == vapor) lhx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhx[1], f);
             else return 0;     
             break;
          case NEPTUNE::h_3:
-            if (nincon > 0 && mode == vapor) lhx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhx[2], f);
             else return 0;     
             break;
          case NEPTUNE::h_4:
-            if (nincon > 0 && mode == vapor) lhx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhx[3], f);
             else return 0;     
             break;
          case NEPTUNE::rho_0:
-            if (nincon > 0 && mode == vapor) lrv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrv, f);
             else return 0;     
             break;
          case NEPTUNE::mu_0:
-            if (nincon > 0 && mode == vapor) ltmuv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltmuv, f);
             else return 0;     
             break;
          case NEPTUNE::lambda_0:
-            if (nincon > 0 && mode == vapor) ltlav.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltlav, f);
             else return 0;     
             break;
          case NEPTUNE::cp_0:
-            if (nincon > 0 && mode == vapor) lcpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpv, f);
             else return 0;     
             break;
          case NEPTUNE::T_sat_0:
-            if (nincon > 0 && mode == vapor) ltspv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltspv, f);
             else return 0;     
             break;
          case NEPTUNE::h_l_sat_0:
-            if (nincon > 0 && mode == vapor) lhlsv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhlsv, f);
             else return 0;     
             break;
          case NEPTUNE::h_v_sat_0:
-            if (nincon > 0 && mode == vapor)  lhvsv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lhvsv, f); 
             else return 0;     
             break;
          case NEPTUNE::cp_l_sat_0:
-            if (nincon > 0 && mode == vapor)  lcplsv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor)  map_ptr(lcplsv, f);
             else return 0;     
             break;
          case NEPTUNE::cp_v_sat_0:
-            if (nincon > 0 && mode == vapor)  lcpvsv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lcpvsv, f); 
             else return 0;     
             break;
          case NEPTUNE::rho_l_sat_0:
-            if (nincon > 0 && mode == vapor)  lrlsv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lrlsv, f); 
             else return 0;     
             break;
          case NEPTUNE::rho_v_sat_0:
-            if (nincon > 0 && mode == vapor)  lrvsv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor)  map_ptr(lrvsv, f);
             else return 0;     
             break;
          case NEPTUNE::dncv:
-            if (nincon > 0 && mode == vapor) ldncv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncv, f);
             else return 0;     
             break;
          case NEPTUNE::rnc:
-            if (nincon > 0 && mode == vapor) lrnc.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrnc, f);
             else return 0;     
             break;
          case NEPTUNE::mnc:
-            if (nincon > 0 && mode == vapor) lmnc.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmnc, f);
             else return 0;     
             break;
          case NEPTUNE::prgr:
-            if (nincon > 0 && mode == vapor) lprgr.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lprgr, f);
             else return 0;     
             break;
          case NEPTUNE::xnc:
-            if (nincon > 0 && mode == vapor) lxnc.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lxnc, f);
             else return 0;     
             break;
          // First Derivatives
          case NEPTUNE::d_p_0_d_p_h:
-            if (nincon > 0 && mode == vapor) lpv1.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpv1, f);
             else return 0;     
             break;
          case NEPTUNE::d_p_0_d_h_p:
-            if (nincon > 0 && mode == vapor) lpv3.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpv3, f);
             else return 0;     
             break;
          case NEPTUNE::d_p_0_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lpvx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpvx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_p_0_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lpvx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpvx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_p_0_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lpvx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpvx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_p_0_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lpvx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lpvx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_h_0_d_p_h:
-            if (nincon > 0 && mode == vapor) lhv1.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhv1, f);
             else return 0;     
             break;
          case NEPTUNE::d_h_0_d_h_p:
-            if (nincon > 0 && mode == vapor) lhv3.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhv3, f);
             else return 0;     
             break;
          case NEPTUNE::d_h_0_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lhvx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhvx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_h_0_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lhvx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhvx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_h_0_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lhvx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhvx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_h_0_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lhvx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhvx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_h_d_c_1_pT:
-            if (nincon > 0 && mode == vapor) lhgx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhgx[0], f);
             else return 0;
             break;
          case NEPTUNE::d_h_d_c_2_pT:
-            if (nincon > 0 && mode == vapor) lhgx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhgx[1], f);
             else return 0;
             break;
          case NEPTUNE::d_h_d_c_3_pT:
-            if (nincon > 0 && mode == vapor) lhgx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhgx[2], f);
             else return 0;
             break;
          case NEPTUNE::d_h_d_c_4_pT:
-            if (nincon > 0 && mode == vapor) lhgx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhgx[3], f);
             else return 0;
             break;
          case NEPTUNE::d_T_d_h_0_p:
-            if (nincon > 0 && mode == vapor) ltghv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltghv, f);
             else return 0;     
             break;
          case NEPTUNE::d_T_d_p_0_h:
-            if (nincon > 0 && mode == vapor) ltgpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltgpv, f);
             else return 0;     
             break;
          case NEPTUNE::d_T_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) ltgx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltgx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_T_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) ltgx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltgx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_T_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) ltgx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltgx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_T_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) ltgx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltgx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lcpgx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpgx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lcpgx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpgx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lcpgx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpgx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lcpgx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpgx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) lcpvpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpvpv, f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_0_d_h_0_p:
-            if (nincon > 0 && mode == vapor) lcpvhv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lcpvhv, f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lrgx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrgx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lrgx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrgx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lrgx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrgx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lrgx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrgx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_mu_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) ltmugx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltmugx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_mu_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) ltmugx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltmugx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_mu_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) ltmugx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltmugx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_mu_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) ltmugx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltmugx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_sigma_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lsix[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lsix[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_sigma_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lsix[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lsix[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_sigma_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lsix[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lsix[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_sigma_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lsix[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lsix[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_lambda_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) ltlagx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltlagx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_lambda_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) ltlagx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltlagx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_lambda_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) ltlagx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltlagx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_lambda_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) ltlagx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltlagx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_sigma_d_p_0_h:
-            if (nincon > 0 && mode == vapor) lsipv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lsipv, f);
             else return 0;     
             break;
          case NEPTUNE::d_T_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) ltspvv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ltspvv, f);
             else return 0;     
             break;
          case NEPTUNE::d_h_l_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) lhlsvv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhlsvv, f);
             else return 0;     
             break;
          case NEPTUNE::d_h_v_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) lhvsvv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lhvsvv, f);
             else return 0;     
             break;
          case NEPTUNE::d_cp_l_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor)  lclsvv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lclsvv, f); 
             else return 0;     
             break;
          case NEPTUNE::d_cp_v_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor)  lcvsvv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lcvsvv, f); 
             else return 0;     
             break;
          case NEPTUNE::d_rho_l_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor)  lrlsvv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lrlsvv, f); 
             else return 0;     
             break;
          case NEPTUNE::d_rho_v_sat_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor)  lrvsvv.set_ptr(nsca, f.get_data().get_ptr()); 
+            if (nincon > 0 && mode == vapor)  map_ptr(lrvsvv, f); 
             else return 0;     
             break;
          case NEPTUNE::d_lambda_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) llavpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(llavpv, f);
             else return 0;     
             break;
          case NEPTUNE::d_lambda_0_d_T_p:
-            if (nincon > 0 && mode == vapor) llavtg.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(llavtg, f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_p_h:
-            if (nincon > 0 && mode == vapor) lrv1.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrv1, f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_h_p:
-            if (nincon > 0 && mode == vapor) lrv3.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrv3, f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) lrvpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrvpv, f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_h_0_p:
-            if (nincon > 0 && mode == vapor) lrvhv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrvhv, f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lrvx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrvx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lrvx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrvx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lrvx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrvx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_rho_0_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lrvx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrvx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_rnc_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lrncx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrncx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_rnc_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lrncx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrncx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_rnc_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lrncx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrncx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_rnc_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lrncx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lrncx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_mnc_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) lmncx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmncx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_mnc_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) lmncx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmncx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_mnc_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) lmncx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmncx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_mnc_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) lmncx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmncx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_dncv_d_c_1_ph:
-            if (nincon > 0 && mode == vapor) ldncvx[0].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncvx[0], f);
             else return 0;     
             break;
          case NEPTUNE::d_dncv_d_c_2_ph:
-            if (nincon > 0 && mode == vapor) ldncvx[1].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncvx[1], f);
             else return 0;     
             break;
          case NEPTUNE::d_dncv_d_c_3_ph:
-            if (nincon > 0 && mode == vapor) ldncvx[2].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncvx[2], f);
             else return 0;     
             break;
          case NEPTUNE::d_dncv_d_c_4_ph:
-            if (nincon > 0 && mode == vapor) ldncvx[3].set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncvx[3], f);
             else return 0;     
             break;
          case NEPTUNE::d_dncv_d_p_h:
-            if (nincon > 0 && mode == vapor) ldncv1.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncv1, f);
             else return 0;     
             break;
          case NEPTUNE::d_dncv_d_h_p:
-            if (nincon > 0 && mode == vapor) ldncv3.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(ldncv3, f);
             else return 0;     
             break;
          case NEPTUNE::d_mu_0_d_T_p:
-            if (nincon > 0 && mode == vapor) lmuvtg.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmuvtg, f);
             else return 0;     
             break;
          case NEPTUNE::d_mu_0_d_p_0_h:
-            if (nincon > 0 && mode == vapor) lmuvpv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(lmuvpv, f);
             else return 0;     
             break;
          // Second Derivatives
          case NEPTUNE::d2_T_sat_0_d_p_0_d_p_0:
-            if (nincon > 0 && mode == vapor) l2tsdpvv.set_ptr(nsca, f.get_data().get_ptr());
+            if (nincon > 0 && mode == vapor) map_ptr(l2tsdpvv, f);
             else return 0;     
             break;
             
          // Cathare2 IAPWS Thermodynamic Properties
          case NEPTUNE::epstl:
-            if (mode == liquid)        lepstliq.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == vapor)    lepstliq.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lepstliq.set_ptr(nsca, f.get_data().get_ptr()) ;
+            if (mode == liquid)        map_ptr(lepstliq, f) ;
+            else if (mode == vapor)    map_ptr(lepstliq, f) ;
+            else if (mode == unknown)  map_ptr(lepstliq, f) ;
             else return 0 ;
             break;
          case NEPTUNE::hlspsc:
-            if (mode == liquid)        lhlspsc.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == vapor)    lhlspsc.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lhlspsc.set_ptr(nsca, f.get_data().get_ptr()) ;
+            if (mode == liquid)        map_ptr(lhlspsc, f) ;
+            else if (mode == vapor)    map_ptr(lhlspsc, f) ;
+            else if (mode == unknown)  map_ptr(lhlspsc, f) ;
             else return 0 ;
             break;
          case NEPTUNE::hlsvsc:
             if (mode == liquid)                       return 0 ;
-            else if (nincon > 0 && mode == vapor)     lhlsvsc.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)   lhlsvsc.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)     map_ptr(lhlsvsc, f) ;
+            else if (nincon > 0 && mode == unknown)   map_ptr(lhlsvsc, f) ;
             else return 0 ;
             break;
          case NEPTUNE::epstg:
             if (mode == liquid)        return 0 ;
-            else if (mode == vapor)    lepstgas.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lepstgas.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (mode == vapor)    map_ptr(lepstgas, f) ;
+            else if (mode == unknown)  map_ptr(lepstgas, f) ;
             else return 0 ;
             break;
          case NEPTUNE::hvspsc:
             if (mode == liquid)        return 0 ;
-            else if (mode == vapor)    lhvspsc.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lhvspsc.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (mode == vapor)    map_ptr(lhvspsc, f) ;
+            else if (mode == unknown)  map_ptr(lhvspsc, f) ;
             else return 0 ;
             break;
          case NEPTUNE::hvsvsc:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhvsvsc.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvsc.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhvsvsc, f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvsc, f) ;
             else return 0 ;
             break;
          // First Derivatives
          case NEPTUNE::d_epstl_dp_h:
-            if (mode == liquid)        lepstliq1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == vapor)    lepstliq1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lepstliq1.set_ptr(nsca, f.get_data().get_ptr()) ;
+            if (mode == liquid)        map_ptr(lepstliq1, f) ;
+            else if (mode == vapor)    map_ptr(lepstliq1, f) ;
+            else if (mode == unknown)  map_ptr(lepstliq1, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstl_dh_p:
-            if (mode == liquid)        lepstliq2.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == vapor)    lepstliq2.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lepstliq2.set_ptr(nsca, f.get_data().get_ptr()) ;
+            if (mode == liquid)        map_ptr(lepstliq2, f) ;
+            else if (mode == vapor)    map_ptr(lepstliq2, f) ;
+            else if (mode == unknown)  map_ptr(lepstliq2, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlspsc_dp_h:
-            if (mode == liquid)        lhlspsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == vapor)    lhlspsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lhlspsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
+            if (mode == liquid)        map_ptr(lhlspsc1, f) ;
+            else if (mode == vapor)    map_ptr(lhlspsc1, f) ;
+            else if (mode == unknown)  map_ptr(lhlspsc1, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlspsc_dh_p:
-            if (mode == liquid)        lhlspsc2.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == vapor)    lhlspsc2.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lhlspsc2.set_ptr(nsca, f.get_data().get_ptr()) ;
+            if (mode == liquid)        map_ptr(lhlspsc2, f) ;
+            else if (mode == vapor)    map_ptr(lhlspsc2, f) ;
+            else if (mode == unknown)  map_ptr(lhlspsc2, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_dp_h:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvsc1, f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvsc1, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_dh_p0:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvsc2.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvsc2.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvsc2, f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvsc2, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_dh_p:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvsc3.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvsc3.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvsc3, f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvsc3, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_d_c_1_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvscx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvscx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvscx[0], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvscx[0], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_d_c_2_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvscx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvscx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvscx[1], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvscx[1], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_d_c_3_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvscx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvscx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvscx[2], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvscx[2], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hlsvsc_d_c_4_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhlsvscx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhlsvscx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhlsvscx[3], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhlsvscx[3], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstg_dp_h:
             if (mode == liquid)        return 0 ;
-            else if (mode == vapor)    lepstgas1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lepstgas1.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (mode == vapor)    map_ptr(lepstgas1, f) ;
+            else if (mode == unknown)  map_ptr(lepstgas1, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstg_dh_p:
             if (mode == liquid)        return 0 ;
-            else if (mode == vapor)    lepstgas3.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)  lepstgas3.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (mode == vapor)    map_ptr(lepstgas3, f) ;
+            else if (mode == unknown)  map_ptr(lepstgas3, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstg_d_c_1_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lepstgasx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lepstgasx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lepstgasx[0], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lepstgasx[0], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstg_d_c_2_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lepstgasx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lepstgasx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lepstgasx[1], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lepstgasx[1], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstg_d_c_3_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lepstgasx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lepstgasx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lepstgasx[2], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lepstgasx[2], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_epstg_d_c_4_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lepstgasx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lepstgasx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lepstgasx[3], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lepstgasx[3], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvspsc_dp_h:
             if (mode == liquid)                      return 0 ;
-            else if (mode == vapor)                  lhvspsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)                lhvspsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (mode == vapor)                  map_ptr(lhvspsc1, f) ;
+            else if (mode == unknown)                map_ptr(lhvspsc1, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvspsc_dh_p:
             if (mode == liquid)                      return 0 ;
-            else if (mode == vapor)                  lhvspsc3.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (mode == unknown)                lhvspsc3.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (mode == vapor)                  map_ptr(lhvspsc3, f) ;
+            else if (mode == unknown)                map_ptr(lhvspsc3, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvspsc_d_c_1_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvspscx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvspscx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvspscx[0], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvspscx[0], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvspsc_d_c_2_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvspscx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvspscx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvspscx[1], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvspscx[1], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvspsc_d_c_3_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvspscx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvspscx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvspscx[2], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvspscx[2], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvspsc_d_c_4_ph:
             if (mode == liquid)                      return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvspscx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvspscx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvspscx[3], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvspscx[3], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvsvsc_dp_h:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhvsvsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvsc1.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhvsvsc1, f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvsc1, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvsvsc_dh_p:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor)    lhvsvsc3.set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvsc3.set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor)    map_ptr(lhvsvsc3, f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvsc3, f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvsvsc_d_c_1_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvsvscx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvscx[0].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvsvscx[0], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvscx[0], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvsvsc_d_c_2_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvsvscx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvscx[1].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvsvscx[1], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvscx[1], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvsvsc_d_c_3_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvsvscx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvscx[2].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvsvscx[2], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvscx[2], f) ;
             else return 0 ;
             break;
          case NEPTUNE::d_hvsvsc_d_c_4_ph:
             if (mode == liquid)        return 0 ;
-            else if (nincon > 0 && mode == vapor )   lhvsvscx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
-            else if (nincon > 0 && mode == unknown)  lhvsvscx[3].set_ptr(nsca, f.get_data().get_ptr()) ;
+            else if (nincon > 0 && mode == vapor )   map_ptr(lhvsvscx[3], f) ;
+            else if (nincon > 0 && mode == unknown)  map_ptr(lhvsvscx[3], f) ;
             else return 0 ;
             break;
          default: 
@@ -1112,6 +1111,32 @@ namespace CATHARE2
     return 1 ;
   }
 
+  void CATHARE2::map_ptr(ArrOfDouble& a, const EOS_Field& f)
+  { for (size_t i=0; i<mapped_arr.size(); i++)
+       if (mapped_arr[i] == &a)
+          { a.set_ptr(nsca, f.get_data().get_ptr()) ;
+            return ;
+          }
+    // keep the work array aside, it is given back by unmap_ptr
+    mapped_arr.push_back(&a) ;
+    mapped_own.push_back(ArrOfDouble()) ;
+    mapped_own.back().swap(a) ;
+    a.set_ptr(nsca, f.get_data().get_ptr()) ;
+  }
+
+  void CATHARE2::unmap_ptr(ArrOfDouble& a)
+  { for (size_t i=0; i<mapped_arr.size(); i++)
+       if (mapped_arr[i] == &a)
+          { a.swap(mapped_own[i]) ;
+            mapped_arr[i] = mapped_arr.back() ;
+            mapped_own[i].swap(mapped_own.back()) ;
+            mapped_arr.pop_back() ;
+            mapped_own.pop_back() ;
+            return ;
+          }
+    a.clear() ;
+  }
+
   EOS_Error CATHARE2::map_eos_fields(const EOS_Fields& f, vector<int>& existprop_fields, domain mode) 
   { int f_size = f.size() ;
     assert (f_size > 0);
@@ -1132,392 +1157,392 @@ namespace CATHARE2
     switch(f.get_property_number()) 
        {
          case NEPTUNE::p :
-            lp.clear();
+            unmap_ptr(lp);
             break ;
          case NEPTUNE::h :
             if (mode == liquid) 
                { if (typ_ths == TH_space::PT)
-                    lhlpt.clear() ;
+                    unmap_ptr(lhlpt) ;
                  else
-                    lhl.clear() ;
+                    unmap_ptr(lhl) ;
                }
             else if (mode == vapor)
                {  if (nincon == 0 && typ_ths == TH_space::PT)
-                     lhvpt.clear() ;
+                     unmap_ptr(lhvpt) ;
                   else
-                     { lhl.clear() ;
-                       lhg.clear() ;
+                     { unmap_ptr(lhl) ;
+                       unmap_ptr(lhg) ;
                      }
                }
-            else if (mode == unknown) lh.clear();
+            else if (mode == unknown) unmap_ptr(lh);
             break;
          case NEPTUNE::T:
-            if (mode == liquid) ltl.clear();
-            else if (mode == vapor) ltg.clear();
-            else if (mode == unknown) lt.clear();
+            if (mode == liquid) unmap_ptr(ltl);
+            else if (mode == vapor) unmap_ptr(ltg);
+            else if (mode == unknown) unmap_ptr(lt);
             break;
          case NEPTUNE::rho:
             if (mode == liquid)
                { if (typ_ths == TH_space::PT)
-                    lrlpt.clear() ;
+                    unmap_ptr(lrlpt) ;
                  else
-                    lrl.clear() ;
+                    unmap_ptr(lrl) ;
                }
             else if (mode == vapor)
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                   lrvpt.clear() ;
+                   unmap_ptr(lrvpt) ;
                  else
-                   lrg.clear() ;
+                   unmap_ptr(lrg) ;
                }
-            else if (mode == unknown) lr.clear();
+            else if (mode == unknown) unmap_ptr(lr);
             break;
          case NEPTUNE::cp:
             if (mode == liquid)
                { if (typ_ths == TH_space::PT)
-                    lcplpt.clear() ;
+                    unmap_ptr(lcplpt) ;
                  else
-                    lcpl.clear() ;
+                    unmap_ptr(lcpl) ;
                }
             else if (mode == vapor) 
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                    lcpvpt.clear() ;
+                    unmap_ptr(lcpvpt) ;
                  else
-                    lcpg.clear() ;
+                    unmap_ptr(lcpg) ;
                }
-            else if (mode == unknown) lcp.clear();
+            else if (mode == unknown) unmap_ptr(lcp);
             break;
          case NEPTUNE::beta:
-            if (mode == liquid) lbetal.clear();
-            else if (mode == unknown) lbetal.clear();
+            if (mode == liquid) unmap_ptr(lbetal);
+            else if (mode == unknown) unmap_ptr(lbetal);
             break;
          case NEPTUNE::lambda:
-            if (mode == liquid) ltlal.clear();
-            else if (mode == vapor) ltlag.clear();
-            else if (mode == unknown) lla.clear();
+            if (mode == liquid) unmap_ptr(ltlal);
+            else if (mode == vapor) unmap_ptr(ltlag);
+            else if (mode == unknown) unmap_ptr(lla);
             break;
          case NEPTUNE::mu:
-            if (mode == liquid) ltmul.clear();
-            else if (mode == vapor) ltmug.clear();
-            else if (mode == unknown) lmu.clear();
+            if (mode == liquid) unmap_ptr(ltmul);
+            else if (mode == vapor) unmap_ptr(ltmug);
+            else if (mode == unknown) unmap_ptr(lmu);
             break;
          case NEPTUNE::sigma:
-            if (mode == vapor) lsi.clear();
-            else if (mode == unknown) lsi.clear();
+            if (mode == vapor) unmap_ptr(lsi);
+            else if (mode == unknown) unmap_ptr(lsi);
             break;
-         case NEPTUNE::gamma: lkiseng.clear(); break ;
+         case NEPTUNE::gamma: unmap_ptr(lkiseng); break ;
          case NEPTUNE::pr:
-            if (mode == vapor) lprandg.clear();
-            if (mode == unknown) lprandg.clear();
+            if (mode == vapor) unmap_ptr(lprandg);
+            if (mode == unknown) unmap_ptr(lprandg);
             break;
          case NEPTUNE::d_T_d_p_h:
-            if (mode == liquid) ltl1.clear();
-            else if (mode == vapor) ltg1.clear();
-            else if (mode == unknown) lt1.clear();
+            if (mode == liquid) unmap_ptr(ltl1);
+            else if (mode == vapor) unmap_ptr(ltg1);
+            else if (mode == unknown) unmap_ptr(lt1);
             break;
          case NEPTUNE::d_T_d_h_p:
-            if (mode == liquid) ltl2.clear();
-            else if (mode == vapor) ltg3.clear();
-            else if (mode == unknown) lt2.clear();
+            if (mode == liquid) unmap_ptr(ltl2);
+            else if (mode == vapor) unmap_ptr(ltg3);
+            else if (mode == unknown) unmap_ptr(lt2);
             break;
          case NEPTUNE::d_h_d_T_p:
             if (mode == liquid)
                { if (typ_ths == TH_space::PT)
-                    lhl2pt.clear() ;
+                    unmap_ptr(lhl2pt) ;
                  else
-                    lhl2.clear() ;
+                    unmap_ptr(lhl2) ;
                }
             else if (mode == vapor) 
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                    lcpvpt.clear() ;
+                    unmap_ptr(lcpvpt) ;
                  else
-                    lcpg.clear() ;
+                    unmap_ptr(lcpg) ;
                }
             break;
          case NEPTUNE::d_h_d_p_T:
             if (mode == liquid)
                { if (typ_ths == TH_space::PT)
-                    lhl1pt.clear() ;
+                    unmap_ptr(lhl1pt) ;
                  else
-                    lhl1.clear() ;
+                    unmap_ptr(lhl1) ;
                }
             else if (mode == vapor) 
                { if (nincon == 0 && typ_ths == TH_space::PT)
-                    lhv1pt.clear() ;
+                    unmap_ptr(lhv1pt) ;
                  else
-                    lhg1.clear() ;
+                    unmap_ptr(lhg1) ;
                }
             break;
          case NEPTUNE::d_rho_d_p_h:
-            if (mode == liquid) lrl1.clear();
+            if (mode == liquid) unmap_ptr(lrl1);
             else if (mode == vapor)
                { if (nincon == 0) 
-                    lrvpv.clear();
+                    unmap_ptr(lrvpv);
                  else
-                    lrg1.clear();
+                    unmap_ptr(lrg1);
                }
-            else if (mode == unknown) lr1.clear();
+            else if (mode == unknown) unmap_ptr(lr1);
             break;
          case NEPTUNE::d_rho_d_h_p:
-            if (mode == liquid) lrl2.clear();
+            if (mode == liquid) unmap_ptr(lrl2);
             else if (mode == vapor)
                { if (nincon == 0) 
-                    lrvhv.clear();
+                    unmap_ptr(lrvhv);
                  else
-                    lrg3.clear();
+                    unmap_ptr(lrg3);
                }
-            else if (mode == unknown) lr2.clear();
+            else if (mode == unknown) unmap_ptr(lr2);
             break;
          case NEPTUNE::d_rho_d_p_T:
-            if      (mode == liquid) lrl1pt.clear();
-            else if (mode == vapor)  lrv1pt.clear();
+            if      (mode == liquid) unmap_ptr(lrl1pt);
+            else if (mode == vapor)  unmap_ptr(lrv1pt);
             break;
          case NEPTUNE::d_rho_d_T_p:
-            if      (mode == liquid) lrl2pt.clear();
-            else if (mode == vapor)  lrv3pt.clear();
+            if      (mode == liquid) unmap_ptr(lrl2pt);
+            else if (mode == vapor)  unmap_ptr(lrv3pt);
             break;
          case NEPTUNE::d_cp_d_p_h:
-            if (mode == liquid) lcpl1.clear();
+            if (mode == liquid) unmap_ptr(lcpl1);
             else if (mode == vapor)
                { if (nincon == 0) 
-                    lcpvpv.clear();
+                    unmap_ptr(lcpvpv);
                  else
-                    lcpg1.clear();
+                    unmap_ptr(lcpg1);
                }
-            else if (mode == unknown) lcp1.clear();
+            else if (mode == unknown) unmap_ptr(lcp1);
             break;
          case NEPTUNE::d_cp_d_h_p:
-            if (mode == liquid) lcpl2.clear();
+            if (mode == liquid) unmap_ptr(lcpl2);
             else if (mode == vapor)
                { if (nincon == 0) 
-                    lcpvhv.clear();
+                    unmap_ptr(lcpvhv);
                  else
-                    lcpg3.clear();
+                    unmap_ptr(lcpg3);
                }
-            else if (mode == unknown) lcp2.clear();
+            else if (mode == unknown) unmap_ptr(lcp2);
             break;
          case NEPTUNE::d_beta_d_p_h:
-            if (mode == liquid) lbetal1.clear();
-            else if (mode == unknown) lbetal1.clear();
+            if (mode == liquid) unmap_ptr(lbetal1);
+            else if (mode == unknown) unmap_ptr(lbetal1);
             break;
          case NEPTUNE::d_beta_d_h_p:
-            if (mode == liquid) lbetal2.clear();
-            else if (mode == unknown) lbetal2.clear();
+            if (mode == liquid) unmap_ptr(lbetal2);
+            else if (mode == unknown) unmap_ptr(lbetal2);
             break;
          case NEPTUNE::d_lambda_d_p_h:
-            if (mode == liquid) ltlal1.clear();
-            else if (mode == vapor) ltlag1.clear();
-            else if (mode == unknown) lla1.clear();
+            if (mode == liquid) unmap_ptr(ltlal1);
+            else if (mode == vapor) unmap_ptr(ltlag1);
+            else if (mode == unknown) unmap_ptr(lla1);
             break;
          case NEPTUNE::d_lambda_d_h_p:
-            if (mode == liquid) ltlal2.clear();
-            else if (mode == vapor) ltlag3.clear();
-            else if (mode == unknown) lla2.clear();
+            if (mode == liquid) unmap_ptr(ltlal2);
+            else if (mode == vapor) unmap_ptr(ltlag3);
+            else if (mode == unknown) unmap_ptr(lla2);
             break;
          case NEPTUNE::d_lambda_d_T_p:
-            if (mode == vapor) llagtg.clear();
-            else if (mode == unknown) llagtg.clear();
+            if (mode == vapor) unmap_ptr(llagtg);
+            else if (mode == unknown) unmap_ptr(llagtg);
             break;
          case NEPTUNE::d_mu_d_p_h:
-            if (mode == liquid) ltmul1.clear();
-            else if (mode == vapor) ltmug1.clear();
-            else if (mode == unknown) lmu1.clear();
+            if (mode == liquid) unmap_ptr(ltmul1);
+            else if (mode == vapor) unmap_ptr(ltmug1);
+            else if (mode == unknown) unmap_ptr(lmu1);
             break;
          case NEPTUNE::d_mu_d_h_p:
-            if (mode == liquid) ltmul2.clear();
-            else if (mode == vapor) ltmug3.clear();
-            else if (mode == unknown) lmu2.clear();
+            if (mode == liquid) unmap_ptr(ltmul2);
+            else if (mode == vapor) unmap_ptr(ltmug3);
+            else if (mode == unknown) unmap_ptr(lmu2);
             break;
          case NEPTUNE::d_mu_d_T_p:
-            if (mode == vapor) lmugtg.clear();
+            if (mode == vapor) unmap_ptr(lmugtg);
             break;
          case NEPTUNE::d_sigma_d_p_h:
-            if (mode == vapor) lsi1.clear();
-            else if (mode == unknown) lsi1.clear();
+            if (mode == vapor) unmap_ptr(lsi1);
+            else if (mode == unknown) unmap_ptr(lsi1);
             break;
          case NEPTUNE::d_sigma_d_h_p:
-            if (mode == vapor) lsi3.clear();
-            else if (mode == unknown) lsi3.clear();
+            if (mode == vapor) unmap_ptr(lsi3);
+            else if (mode == unknown) unmap_ptr(lsi3);
             break;
          case NEPTUNE::d_cp_d_p_T:
-            if      (mode == liquid)  lcpl1pt.clear();
-            else if (mode == vapor)   lcpvpvpt.clear();
-            else if (mode == unknown) lcpl1pt.clear();
+            if      (mode == liquid)  unmap_ptr(lcpl1pt);
+            else if (mode == vapor)   unmap_ptr(lcpvpvpt);
+            else if (mode == unknown) unmap_ptr(lcpl1pt);
             break;
          case NEPTUNE::d_cp_d_T_p:
-            if      (mode == liquid)  lcpl2pt.clear();
-            else if (mode == vapor)   lcpgtgpt.clear();
-            else if (mode == unknown) lcpgtg.clear();
-            break;
-         case NEPTUNE::p_sat            : lp.clear() ; break ;
-         case NEPTUNE::T_sat            : ltsp.clear() ; break ;
-         case NEPTUNE::h_l_sat          : lhlsp.clear() ; break ;
-         case NEPTUNE::h_v_sat          : lhvsp.clear() ; break ;
-         case NEPTUNE::cp_l_sat         : lcplsp.clear() ; break ;
-         case NEPTUNE::cp_v_sat         : lcpvsp.clear() ; break ;
-         case NEPTUNE::rho_l_sat        : lrlsp.clear() ; break ;
-         case NEPTUNE::rho_v_sat        : lrvsp.clear() ; break ;
-         case NEPTUNE::d_T_sat_d_p      : ltsp1.clear() ; break ;
-         case NEPTUNE::d_h_l_sat_d_p    : lhlsp1.clear() ; break ;
-         case NEPTUNE::d_h_v_sat_d_p    : lhvsp1.clear() ; break ;
-         case NEPTUNE::d_cp_l_sat_d_p   : lclsp1.clear() ; break ;
-         case NEPTUNE::d_cp_v_sat_d_p   : lcvsp1.clear() ; break ;
-         case NEPTUNE::d_rho_l_sat_d_p  : lrlsp1.clear() ; break ;
-         case NEPTUNE::d_rho_v_sat_d_p  : lrvsp1.clear() ; break ;
-         case NEPTUNE::d2_T_sat_d_p_d_p : l2tsp1.clear() ; break ;
-
-         case NEPTUNE::p_lim   : lp.clear() ; break ;
-         case NEPTUNE::h_l_lim : hllim.clear() ; break ;
-         case NEPTUNE::h_v_lim : hvlim.clear() ; break ;
-
-         case NEPTUNE::c_0:        if (nincon > 0 && mode == vapor)  lxvap.clear(); break;
-         case NEPTUNE::c_1:        if (nincon > 0 && mode == vapor)  lx[0].clear(); break;
-         case NEPTUNE::c_2:        if (nincon > 0 && mode == vapor)  lx[1].clear(); break;
-         case NEPTUNE::c_3:        if (nincon > 0 && mode == vapor)  lx[2].clear(); break;
-         case NEPTUNE::c_4:        if (nincon > 0 && mode == vapor)  lx[3].clear(); break;
-         case NEPTUNE::p_0:        if (nincon > 0 && mode == vapor)  lpv.clear(); break;
-         case NEPTUNE::p_1:        if (nincon > 0 && mode == vapor)  lpx[0].clear(); break;
-         case NEPTUNE::p_2:        if (nincon > 0 && mode == vapor)  lpx[1].clear(); break;
-         case NEPTUNE::p_3:        if (nincon > 0 && mode == vapor)  lpx[2].clear(); break;
-         case NEPTUNE::p_4:        if (nincon > 0 && mode == vapor)  lpx[3].clear(); break;
-         case NEPTUNE::h_0:        if (nincon > 0 && mode == vapor)  lhv.clear(); break;
-         case NEPTUNE::h_1:        if (nincon > 0 && mode == vapor)  lhx[0].clear(); break;
-         case NEPTUNE::h_2:        if (nincon > 0 && mode == vapor)  lhx[1].clear(); break;
-         case NEPTUNE::h_3:        if (nincon > 0 && mode == vapor)  lhx[2].clear(); break;
-         case NEPTUNE::h_4:        if (nincon > 0 && mode == vapor)  lhx[3].clear(); break;
-         case NEPTUNE::cp_0:       if (nincon > 0 && mode == vapor)  lcpv.clear(); break;
-         case NEPTUNE::rho_0:      if (nincon > 0 && mode == vapor)  lrv.clear(); break;
-         case NEPTUNE::lambda_0:   if (nincon > 0 && mode == vapor)  ltlav.clear(); break;
-         case NEPTUNE::mu_0:       if (nincon > 0 && mode == vapor)  ltmuv.clear(); break;
-         case NEPTUNE::T_sat_0:    if (nincon > 0 && mode == vapor)  ltspv.clear(); break;
-         case NEPTUNE::h_l_sat_0:  if (nincon > 0 && mode == vapor)  lhlsv.clear(); break;
-         case NEPTUNE::h_v_sat_0:  if (nincon > 0 && mode == vapor)  lhvsv.clear(); break;
-         case NEPTUNE::cp_l_sat_0: if (nincon > 0 && mode == vapor)  lcplsv.clear(); break;
-         case NEPTUNE::cp_v_sat_0: if (nincon > 0 && mode == vapor)  lcpvsv.clear(); break;
-         case NEPTUNE::rho_l_sat_0:if (nincon > 0 && mode == vapor)  lrlsv.clear(); break;
-         case NEPTUNE::rho_v_sat_0:if (nincon > 0 && mode == vapor)  lrvsv.clear(); break;
-         case NEPTUNE::dncv:       if (nincon > 0 && mode == vapor)  ldncv.clear(); break;
-         case NEPTUNE::rnc:        if (nincon > 0 && mode == vapor)  lrnc.clear(); break;
-         case NEPTUNE::mnc:        if (nincon > 0 && mode == vapor)  lmnc.clear(); break;
-         case NEPTUNE::prgr:       if (nincon > 0 && mode == vapor)  lprgr.clear(); break;
-         case NEPTUNE::xnc:        if (nincon > 0 && mode == vapor)  lxnc.clear(); break;
+            if      (mode == liquid)  unmap_ptr(lcpl2pt);
+            else if (mode == vapor)   unmap_ptr(lcpgtgpt);
+            else if (mode == unknown) unmap_ptr(lcpgtg);
+            break;
+         case NEPTUNE::p_sat            : unmap_ptr(lp) ; break ;
+         case NEPTUNE::T_sat            : unmap_ptr(ltsp) ; break ;
+         case NEPTUNE::h_l_sat          : unmap_ptr(lhlsp) ; break ;
+         case NEPTUNE::h_v_sat          : unmap_ptr(lhvsp) ; break ;
+         case NEPTUNE::cp_l_sat         : unmap_ptr(lcplsp) ; break ;
+         case NEPTUNE::cp_v_sat         : unmap_ptr(lcpvsp) ; break ;
+         case NEPTUNE::rho_l_sat        : unmap_ptr(lrlsp) ; break ;
+         case NEPTUNE::rho_v_sat        : unmap_ptr(lrvsp) ; break ;
+         case NEPTUNE::d_T_sat_d_p      : unmap_ptr(ltsp1) ; break ;
+         case NEPTUNE::d_h_l_sat_d_p    : unmap_ptr(lhlsp1) ; break ;
+         case NEPTUNE::d_h_v_sat_d_p    : unmap_ptr(lhvsp1) ; break ;
+         case NEPTUNE::d_cp_l_sat_d_p   : unmap_ptr(lclsp1) ; break ;
+         case NEPTUNE::d_cp_v_sat_d_p   : unmap_ptr(lcvsp1) ; break ;
+         case NEPTUNE::d_rho_l_sat_d_p  : unmap_ptr(lrlsp1) ; break ;
+         case NEPTUNE::d_rho_v_sat_d_p  : unmap_ptr(lrvsp1) ; break ;
+         case NEPTUNE::d2_T_sat_d_p_d_p : unmap_ptr(l2tsp1) ; break ;
+
+         case NEPTUNE::p_lim   : unmap_ptr(lp) ; break ;
+         case NEPTUNE::h_l_lim : unmap_ptr(hllim) ; break ;
+         case NEPTUNE::h_v_lim : unmap_ptr(hvlim) ; break ;
+
+         case NEPTUNE::c_0:        if (nincon > 0 && mode == vapor)  unmap_ptr(lxvap); break;
+         case NEPTUNE::c_1:        if (nincon > 0 && mode == vapor)  unmap_ptr(lx[0]); break;
+         case NEPTUNE::c_2:        if (nincon > 0 && mode == vapor)  unmap_ptr(lx[1]); break;
+         case NEPTUNE::c_3:        if (nincon > 0 && mode == vapor)  unmap_ptr(lx[2]); break;
+         case NEPTUNE::c_4:        if (nincon > 0 && mode == vapor)  unmap_ptr(lx[3]); break;
+         case NEPTUNE::p_0:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpv); break;
+         case NEPTUNE::p_1:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpx[0]); break;
+         case NEPTUNE::p_2:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpx[1]); break;
+         case NEPTUNE::p_3:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpx[2]); break;
+         case NEPTUNE::p_4:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpx[3]); break;
+         case NEPTUNE::h_0:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhv); break;
+         case NEPTUNE::h_1:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhx[0]); break;
+         case NEPTUNE::h_2:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhx[1]); break;
+         case NEPTUNE::h_3:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhx[2]); break;
+         case NEPTUNE::h_4:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhx[3]); break;
+         case NEPTUNE::cp_0:       if (nincon > 0 && mode == vapor)  unmap_ptr(lcpv); break;
+         case NEPTUNE::rho_0:      if (nincon > 0 && mode == vapor)  unmap_ptr(lrv); break;
+         case NEPTUNE::lambda_0:   if (nincon > 0 && mode == vapor)  unmap_ptr(ltlav); break;
+         case NEPTUNE::mu_0:       if (nincon > 0 && mode == vapor)  unmap_ptr(ltmuv); break;
+         case NEPTUNE::T_sat_0:    if (nincon > 0 && mode == vapor)  unmap_ptr(ltspv); break;
+         case NEPTUNE::h_l_sat_0:  if (nincon > 0 && mode == vapor)  unmap_ptr(lhlsv); break;
+         case NEPTUNE::h_v_sat_0:  if (nincon > 0 && mode == vapor)  unmap_ptr(lhvsv); break;
+         case NEPTUNE::cp_l_sat_0: if (nincon > 0 && mode == vapor)  unmap_ptr(lcplsv); break;
+         case NEPTUNE::cp_v_sat_0: if (nincon > 0 && mode == vapor)  unmap_ptr(lcpvsv); break;
+         case NEPTUNE::rho_l_sat_0:if (nincon > 0 && mode == vapor)  unmap_ptr(lrlsv); break;
+         case NEPTUNE::rho_v_sat_0:if (nincon > 0 && mode == vapor)  unmap_ptr(lrvsv); break;
+         case NEPTUNE::dncv:       if (nincon > 0 && mode == vapor)  unmap_ptr(ldncv); break;
+         case NEPTUNE::rnc:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrnc); break;
+         case NEPTUNE::mnc:        if (nincon > 0 && mode == vapor)  unmap_ptr(lmnc); break;
+         case NEPTUNE::prgr:       if (nincon > 0 && mode == vapor)  unmap_ptr(lprgr); break;
+         case NEPTUNE::xnc:        if (nincon > 0 && mode == vapor)  unmap_ptr(lxnc); break;
          // First Derivatives
-         case NEPTUNE::d_p_0_d_p_h:           if (nincon > 0 && mode == vapor)  lpv1.clear(); break;
-         case NEPTUNE::d_p_0_d_h_p:           if (nincon > 0 && mode == vapor)  lpv3.clear(); break;
-         case NEPTUNE::d_p_0_d_c_1_ph:        if (nincon > 0 && mode == vapor)  lpvx[0].clear(); break;
-         case NEPTUNE::d_p_0_d_c_2_ph:        if (nincon > 0 && mode == vapor)  lpvx[1].clear(); break;
-         case NEPTUNE::d_p_0_d_c_3_ph:        if (nincon > 0 && mode == vapor)  lpvx[2].clear(); break;
-         case NEPTUNE::d_p_0_d_c_4_ph:        if (nincon > 0 && mode == vapor)  lpvx[3].clear(); break;
-         case NEPTUNE::d_h_0_d_p_h:           if (nincon > 0 && mode == vapor)  lhv1.clear(); break;
-         case NEPTUNE::d_h_0_d_h_p:           if (nincon > 0 && mode == vapor)  lhv3.clear(); break;
-         case NEPTUNE::d_h_0_d_c_1_ph:        if (nincon > 0 && mode == vapor)  lhvx[0].clear(); break;
-         case NEPTUNE::d_h_0_d_c_2_ph:        if (nincon > 0 && mode == vapor)  lhvx[1].clear(); break;
-         case NEPTUNE::d_h_0_d_c_3_ph:        if (nincon > 0 && mode == vapor)  lhvx[2].clear(); break;
-         case NEPTUNE::d_h_0_d_c_4_ph:        if (nincon > 0 && mode == vapor)  lhvx[3].clear(); break;
-         case NEPTUNE::d_h_d_c_1_pT:          if (nincon > 0 && mode == vapor)  lhgx[0].clear(); break;
-         case NEPTUNE::d_h_d_c_2_pT:          if (nincon > 0 && mode == vapor)  lhgx[1].clear(); break;
-         case NEPTUNE::d_h_d_c_3_pT:          if (nincon > 0 && mode == vapor)  lhgx[2].clear(); break;
-         case NEPTUNE::d_h_d_c_4_pT:          if (nincon > 0 && mode == vapor)  lhgx[3].clear(); break;
-         case NEPTUNE::d_T_d_h_0_p:           if (nincon > 0 && mode == vapor)  ltghv.clear(); break;
-         case NEPTUNE::d_T_d_p_0_h:           if (nincon > 0 && mode == vapor)  ltgpv.clear(); break;
-         case NEPTUNE::d_T_d_c_1_ph:          if (nincon > 0 && mode == vapor)  ltgx[0].clear(); break;
-         case NEPTUNE::d_T_d_c_2_ph:          if (nincon > 0 && mode == vapor)  ltgx[1].clear(); break;
-         case NEPTUNE::d_T_d_c_3_ph:          if (nincon > 0 && mode == vapor)  ltgx[2].clear(); break;
-         case NEPTUNE::d_T_d_c_4_ph:          if (nincon > 0 && mode == vapor)  ltgx[3].clear(); break;
-         case NEPTUNE::d_cp_d_c_1_ph:         if (nincon > 0 && mode == vapor)  lcpgx[0].clear(); break;
-         case NEPTUNE::d_cp_d_c_2_ph:         if (nincon > 0 && mode == vapor)  lcpgx[1].clear(); break;
-         case NEPTUNE::d_cp_d_c_3_ph:         if (nincon > 0 && mode == vapor)  lcpgx[2].clear(); break;
-         case NEPTUNE::d_cp_d_c_4_ph:         if (nincon > 0 && mode == vapor)  lcpgx[3].clear(); break;
-         case NEPTUNE::d_cp_0_d_p_0_h:        if (nincon > 0 && mode == vapor)  lcpvpv.clear(); break;
-         case NEPTUNE::d_cp_0_d_h_0_p:        if (nincon > 0 && mode == vapor)  lcpvhv.clear(); break;
-         case NEPTUNE::d_rho_d_c_1_ph:        if (nincon > 0 && mode == vapor)  lrgx[0].clear(); break;
-         case NEPTUNE::d_rho_d_c_2_ph:        if (nincon > 0 && mode == vapor)  lrgx[1].clear(); break;
-         case NEPTUNE::d_rho_d_c_3_ph:        if (nincon > 0 && mode == vapor)  lrgx[2].clear(); break;
-         case NEPTUNE::d_rho_d_c_4_ph:        if (nincon > 0 && mode == vapor)  lrgx[3].clear(); break;
-         case NEPTUNE::d_mu_d_c_1_ph:         if (nincon > 0 && mode == vapor)  ltmugx[0].clear(); break;
-         case NEPTUNE::d_mu_d_c_2_ph:         if (nincon > 0 && mode == vapor)  ltmugx[1].clear(); break;
-         case NEPTUNE::d_mu_d_c_3_ph:         if (nincon > 0 && mode == vapor)  ltmugx[2].clear(); break;
-         case NEPTUNE::d_mu_d_c_4_ph:         if (nincon > 0 && mode == vapor)  ltmugx[3].clear(); break;
-         case NEPTUNE::d_sigma_d_c_1_ph:      if (nincon > 0 && mode == vapor)  lsix[0].clear(); break;
-         case NEPTUNE::d_sigma_d_c_2_ph:      if (nincon > 0 && mode == vapor)  lsix[1].clear(); break;
-         case NEPTUNE::d_sigma_d_c_3_ph:      if (nincon > 0 && mode == vapor)  lsix[2].clear(); break;
-         case NEPTUNE::d_sigma_d_c_4_ph:      if (nincon > 0 && mode == vapor)  lsix[3].clear(); break;
-         case NEPTUNE::d_lambda_d_c_1_ph:     if (nincon > 0 && mode == vapor)  ltlagx[0].clear(); break;
-         case NEPTUNE::d_lambda_d_c_2_ph:     if (nincon > 0 && mode == vapor)  ltlagx[1].clear(); break;
-         case NEPTUNE::d_lambda_d_c_3_ph:     if (nincon > 0 && mode == vapor)  ltlagx[2].clear(); break;
-         case NEPTUNE::d_lambda_d_c_4_ph:     if (nincon > 0 && mode == vapor)  ltlagx[3].clear(); break;
-         case NEPTUNE::d_sigma_d_p_0_h:       if (nincon > 0 && mode == vapor)  lsipv.clear(); break;
-         case NEPTUNE::d_T_sat_0_d_p_0_h:     if (nincon > 0 && mode == vapor)  ltspvv.clear(); break;
-         case NEPTUNE::d_h_l_sat_0_d_p_0_h:   if (nincon > 0 && mode == vapor)  lhlsvv.clear(); break;
-         case NEPTUNE::d_h_v_sat_0_d_p_0_h:   if (nincon > 0 && mode == vapor)  lhvsvv.clear(); break;
-         case NEPTUNE::d_cp_l_sat_0_d_p_0_h:  if (nincon > 0 && mode == vapor)  lclsvv.clear(); break;
-         case NEPTUNE::d_cp_v_sat_0_d_p_0_h:  if (nincon > 0 && mode == vapor)  lcvsvv.clear(); break;
-         case NEPTUNE::d_rho_l_sat_0_d_p_0_h: if (nincon > 0 && mode == vapor)  lrlsvv.clear(); break;
-         case NEPTUNE::d_rho_v_sat_0_d_p_0_h: if (nincon > 0 && mode == vapor)  lrvsvv.clear(); break;
-         case NEPTUNE::d_lambda_0_d_p_0_h:    if (nincon > 0 && mode == vapor)  llavpv.clear(); break;
-         case NEPTUNE::d_lambda_0_d_T_p:      if (nincon > 0 && mode == vapor)  llavtg.clear(); break;
-         case NEPTUNE::d_rho_0_d_p_h:         if (nincon > 0 && mode == vapor)  lrv1.clear(); break;
-         case NEPTUNE::d_rho_0_d_h_p:         if (nincon > 0 && mode == vapor)  lrv3.clear(); break;
-         case NEPTUNE::d_rho_0_d_p_0_h:       if (nincon > 0 && mode == vapor)  lrvpv.clear(); break;
-         case NEPTUNE::d_rho_0_d_h_0_p:       if (nincon > 0 && mode == vapor)  lrvhv.clear(); break;
-         case NEPTUNE::d_rho_0_d_c_1_ph:      if (nincon > 0 && mode == vapor)  lrvx[0].clear(); break;
-         case NEPTUNE::d_rho_0_d_c_2_ph:      if (nincon > 0 && mode == vapor)  lrvx[1].clear(); break;
-         case NEPTUNE::d_rho_0_d_c_3_ph:      if (nincon > 0 && mode == vapor)  lrvx[2].clear(); break;
-         case NEPTUNE::d_rho_0_d_c_4_ph:      if (nincon > 0 && mode == vapor)  lrvx[3].clear(); break;
-         case NEPTUNE::d_rnc_d_c_1_ph:        if (nincon > 0 && mode == vapor)  lrncx[0].clear(); break;
-         case NEPTUNE::d_rnc_d_c_2_ph:        if (nincon > 0 && mode == vapor)  lrncx[1].clear(); break;
-         case NEPTUNE::d_rnc_d_c_3_ph:        if (nincon > 0 && mode == vapor)  lrncx[2].clear(); break;
-         case NEPTUNE::d_rnc_d_c_4_ph:        if (nincon > 0 && mode == vapor)  lrncx[3].clear(); break;
-         case NEPTUNE::d_mnc_d_c_1_ph:        if (nincon > 0 && mode == vapor)  lmncx[0].clear(); break;
-         case NEPTUNE::d_mnc_d_c_2_ph:        if (nincon > 0 && mode == vapor)  lmncx[1].clear(); break;
-         case NEPTUNE::d_mnc_d_c_3_ph:        if (nincon > 0 && mode == vapor)  lmncx[2].clear(); break;
-         case NEPTUNE::d_mnc_d_c_4_ph:        if (nincon > 0 && mode == vapor)  lmncx[3].clear(); break;
-         case NEPTUNE::d_dncv_d_c_1_ph:       if (nincon > 0 && mode == vapor)  ldncvx[0].clear(); break;
-         case NEPTUNE::d_dncv_d_c_2_ph:       if (nincon > 0 && mode == vapor)  ldncvx[1].clear(); break;
-         case NEPTUNE::d_dncv_d_c_3_ph:       if (nincon > 0 && mode == vapor)  ldncvx[2].clear(); break;
-         case NEPTUNE::d_dncv_d_c_4_ph:       if (nincon > 0 && mode == vapor)  ldncvx[3].clear(); break;
-         case NEPTUNE::d_dncv_d_p_h:          if (nincon > 0 && mode == vapor)  ldncv1.clear(); break;
-         case NEPTUNE::d_dncv_d_h_p:          if (nincon > 0 && mode == vapor)  ldncv3.clear(); break;
-         case NEPTUNE::d_mu_0_d_T_p:          if (nincon > 0 && mode == vapor)  lmuvtg.clear(); break;
-         case NEPTUNE::d_mu_0_d_p_0_h:        if (nincon > 0 && mode == vapor)  lmuvpv.clear(); break;
+         case NEPTUNE::d_p_0_d_p_h:           if (nincon > 0 && mode == vapor)  unmap_ptr(lpv1); break;
+         case NEPTUNE::d_p_0_d_h_p:           if (nincon > 0 && mode == vapor)  unmap_ptr(lpv3); break;
+         case NEPTUNE::d_p_0_d_c_1_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpvx[0]); break;
+         case NEPTUNE::d_p_0_d_c_2_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpvx[1]); break;
+         case NEPTUNE::d_p_0_d_c_3_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpvx[2]); break;
+         case NEPTUNE::d_p_0_d_c_4_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lpvx[3]); break;
+         case NEPTUNE::d_h_0_d_p_h:           if (nincon > 0 && mode == vapor)  unmap_ptr(lhv1); break;
+         case NEPTUNE::d_h_0_d_h_p:           if (nincon > 0 && mode == vapor)  unmap_ptr(lhv3); break;
+         case NEPTUNE::d_h_0_d_c_1_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhvx[0]); break;
+         case NEPTUNE::d_h_0_d_c_2_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhvx[1]); break;
+         case NEPTUNE::d_h_0_d_c_3_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhvx[2]); break;
+         case NEPTUNE::d_h_0_d_c_4_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lhvx[3]); break;
+         case NEPTUNE::d_h_d_c_1_pT:          if (nincon > 0 && mode == vapor)  unmap_ptr(lhgx[0]); break;
+         case NEPTUNE::d_h_d_c_2_pT:          if (nincon > 0 && mode == vapor)  unmap_ptr(lhgx[1]); break;
+         case NEPTUNE::d_h_d_c_3_pT:          if (nincon > 0 && mode == vapor)  unmap_ptr(lhgx[2]); break;
+         case NEPTUNE::d_h_d_c_4_pT:          if (nincon > 0 && mode == vapor)  unmap_ptr(lhgx[3]); break;
+         case NEPTUNE::d_T_d_h_0_p:           if (nincon > 0 && mode == vapor)  unmap_ptr(ltghv); break;
+         case NEPTUNE::d_T_d_p_0_h:           if (nincon > 0 && mode == vapor)  unmap_ptr(ltgpv); break;
+         case NEPTUNE::d_T_d_c_1_ph:          if (nincon > 0 && mode == vapor)  unmap_ptr(ltgx[0]); break;
+         case NEPTUNE::d_T_d_c_2_ph:          if (nincon > 0 && mode == vapor)  unmap_ptr(ltgx[1]); break;
+         case NEPTUNE::d_T_d_c_3_ph:          if (nincon > 0 && mode == vapor)  unmap_ptr(ltgx[2]); break;
+         case NEPTUNE::d_T_d_c_4_ph:          if (nincon > 0 && mode == vapor)  unmap_ptr(ltgx[3]); break;
+         case NEPTUNE::d_cp_d_c_1_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(lcpgx[0]); break;
+         case NEPTUNE::d_cp_d_c_2_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(lcpgx[1]); break;
+         case NEPTUNE::d_cp_d_c_3_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(lcpgx[2]); break;
+         case NEPTUNE::d_cp_d_c_4_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(lcpgx[3]); break;
+         case NEPTUNE::d_cp_0_d_p_0_h:        if (nincon > 0 && mode == vapor)  unmap_ptr(lcpvpv); break;
+         case NEPTUNE::d_cp_0_d_h_0_p:        if (nincon > 0 && mode == vapor)  unmap_ptr(lcpvhv); break;
+         case NEPTUNE::d_rho_d_c_1_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrgx[0]); break;
+         case NEPTUNE::d_rho_d_c_2_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrgx[1]); break;
+         case NEPTUNE::d_rho_d_c_3_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrgx[2]); break;
+         case NEPTUNE::d_rho_d_c_4_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrgx[3]); break;
+         case NEPTUNE::d_mu_d_c_1_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(ltmugx[0]); break;
+         case NEPTUNE::d_mu_d_c_2_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(ltmugx[1]); break;
+         case NEPTUNE::d_mu_d_c_3_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(ltmugx[2]); break;
+         case NEPTUNE::d_mu_d_c_4_ph:         if (nincon > 0 && mode == vapor)  unmap_ptr(ltmugx[3]); break;
+         case NEPTUNE::d_sigma_d_c_1_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lsix[0]); break;
+         case NEPTUNE::d_sigma_d_c_2_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lsix[1]); break;
+         case NEPTUNE::d_sigma_d_c_3_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lsix[2]); break;
+         case NEPTUNE::d_sigma_d_c_4_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lsix[3]); break;
+         case NEPTUNE::d_lambda_d_c_1_ph:     if (nincon > 0 && mode == vapor)  unmap_ptr(ltlagx[0]); break;
+         case NEPTUNE::d_lambda_d_c_2_ph:     if (nincon > 0 && mode == vapor)  unmap_ptr(ltlagx[1]); break;
+         case NEPTUNE::d_lambda_d_c_3_ph:     if (nincon > 0 && mode == vapor)  unmap_ptr(ltlagx[2]); break;
+         case NEPTUNE::d_lambda_d_c_4_ph:     if (nincon > 0 && mode == vapor)  unmap_ptr(ltlagx[3]); break;
+         case NEPTUNE::d_sigma_d_p_0_h:       if (nincon > 0 && mode == vapor)  unmap_ptr(lsipv); break;
+         case NEPTUNE::d_T_sat_0_d_p_0_h:     if (nincon > 0 && mode == vapor)  unmap_ptr(ltspvv); break;
+         case NEPTUNE::d_h_l_sat_0_d_p_0_h:   if (nincon > 0 && mode == vapor)  unmap_ptr(lhlsvv); break;
+         case NEPTUNE::d_h_v_sat_0_d_p_0_h:   if (nincon > 0 && mode == vapor)  unmap_ptr(lhvsvv); break;
+         case NEPTUNE::d_cp_l_sat_0_d_p_0_h:  if (nincon > 0 && mode == vapor)  unmap_ptr(lclsvv); break;
+         case NEPTUNE::d_cp_v_sat_0_d_p_0_h:  if (nincon > 0 && mode == vapor)  unmap_ptr(lcvsvv); break;
+         case NEPTUNE::d_rho_l_sat_0_d_p_0_h: if (nincon > 0 && mode == vapor)  unmap_ptr(lrlsvv); break;
+         case NEPTUNE::d_rho_v_sat_0_d_p_0_h: if (nincon > 0 && mode == vapor)  unmap_ptr(lrvsvv); break;
+         case NEPTUNE::d_lambda_0_d_p_0_h:    if (nincon > 0 && mode == vapor)  unmap_ptr(llavpv); break;
+         case NEPTUNE::d_lambda_0_d_T_p:      if (nincon > 0 && mode == vapor)  unmap_ptr(llavtg); break;
+         case NEPTUNE::d_rho_0_d_p_h:         if (nincon > 0 && mode == vapor)  unmap_ptr(lrv1); break;
+         case NEPTUNE::d_rho_0_d_h_p:         if (nincon > 0 && mode == vapor)  unmap_ptr(lrv3); break;
+         case NEPTUNE::d_rho_0_d_p_0_h:       if (nincon > 0 && mode == vapor)  unmap_ptr(lrvpv); break;
+         case NEPTUNE::d_rho_0_d_h_0_p:       if (nincon > 0 && mode == vapor)  unmap_ptr(lrvhv); break;
+         case NEPTUNE::d_rho_0_d_c_1_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lrvx[0]); break;
+         case NEPTUNE::d_rho_0_d_c_2_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lrvx[1]); break;
+         case NEPTUNE::d_rho_0_d_c_3_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lrvx[2]); break;
+         case NEPTUNE::d_rho_0_d_c_4_ph:      if (nincon > 0 && mode == vapor)  unmap_ptr(lrvx[3]); break;
+         case NEPTUNE::d_rnc_d_c_1_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrncx[0]); break;
+         case NEPTUNE::d_rnc_d_c_2_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrncx[1]); break;
+         case NEPTUNE::d_rnc_d_c_3_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrncx[2]); break;
+         case NEPTUNE::d_rnc_d_c_4_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lrncx[3]); break;
+         case NEPTUNE::d_mnc_d_c_1_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lmncx[0]); break;
+         case NEPTUNE::d_mnc_d_c_2_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lmncx[1]); break;
+         case NEPTUNE::d_mnc_d_c_3_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lmncx[2]); break;
+         case NEPTUNE::d_mnc_d_c_4_ph:        if (nincon > 0 && mode == vapor)  unmap_ptr(lmncx[3]); break;
+         case NEPTUNE::d_dncv_d_c_1_ph:       if (nincon > 0 && mode == vapor)  unmap_ptr(ldncvx[0]); break;
+         case NEPTUNE::d_dncv_d_c_2_ph:       if (nincon > 0 && mode == vapor)  unmap_ptr(ldncvx[1]); break;
+         case NEPTUNE::d_dncv_d_c_3_ph:       if (nincon > 0 && mode == vapor)  unmap_ptr(ldncvx[2]); break;
+         case NEPTUNE::d_dncv_d_c_4_ph:       if (nincon > 0 && mode == vapor)  unmap_ptr(ldncvx[3]); break;
+         case NEPTUNE::d_dncv_d_p_h:          if (nincon > 0 && mode == vapor)  unmap_ptr(ldncv1); break;
+         case NEPTUNE::d_dncv_d_h_p:          if (nincon > 0 && mode == vapor)  unmap_ptr(ldncv3); break;
+         case NEPTUNE::d_mu_0_d_T_p:          if (nincon > 0 && mode == vapor)  unmap_ptr(lmuvtg); break;
+         case NEPTUNE::d_mu_0_d_p_0_h:        if (nincon > 0 && mode == vapor)  unmap_ptr(lmuvpv); break;
          // Second Derivatives
-         case NEPTUNE::d2_T_sat_0_d_p_0_d_p_0: if (nincon > 0 && mode == vapor) l2tsdpvv.clear(); break;
+         case NEPTUNE::d2_T_sat_0_d_p_0_d_p_0: if (nincon > 0 && mode == vapor) unmap_ptr(l2tsdpvv); break;
 
          // Cathare2 IAPWS Thermodynamic Properties
-         case NEPTUNE::epstl:              if (mode == liquid)  lepstliq.clear();  break;
-         case NEPTUNE::hlspsc:             if (mode == liquid)  lhlspsc.clear();  break;
-         case NEPTUNE::hlsvsc:             if (mode == liquid)  lhlsvsc.clear();  break;
-         case NEPTUNE::epstg:              if (mode == liquid)  lepstgas.clear();  break;
-         case NEPTUNE::hvspsc:             if (mode == liquid)  lhvspsc.clear();  break;
-         case NEPTUNE::hvsvsc:             if (mode == liquid)  lhvsvsc.clear();  break;
-         case NEPTUNE::d_epstl_dp_h:       if (mode == liquid)  lepstliq1.clear();  break;
-         case NEPTUNE::d_epstl_dh_p:       if (mode == liquid)  lepstliq2.clear();  break;
-         case NEPTUNE::d_hlspsc_dp_h:      if (mode == liquid)  lhlspsc1.clear();  break;
-         case NEPTUNE::d_hlspsc_dh_p:      if (mode == liquid)  lhlspsc2.clear();  break;
-         case NEPTUNE::d_hlsvsc_dp_h:      if (mode == liquid)  lhlsvsc1.clear();  break;
-         case NEPTUNE::d_hlsvsc_dh_p0:     if (mode == liquid)  lhlsvsc2.clear();  break;
-         case NEPTUNE::d_hlsvsc_dh_p:      if (mode == liquid)  lhlsvsc3.clear();  break;
-         case NEPTUNE::d_hlsvsc_d_c_1_ph:  if (mode == liquid)  lhlsvscx[0].clear();  break;
-         case NEPTUNE::d_hlsvsc_d_c_2_ph:  if (mode == liquid)  lhlsvscx[1].clear();  break;
-         case NEPTUNE::d_hlsvsc_d_c_3_ph:  if (mode == liquid)  lhlsvscx[2].clear();  break;
-         case NEPTUNE::d_hlsvsc_d_c_4_ph:  if (mode == liquid)  lhlsvscx[3].clear();  break;
-         case NEPTUNE::d_epstg_dp_h:       if (mode == vapor)   lepstgas1.clear();  break;
-         case NEPTUNE::d_epstg_dh_p:       if (mode == vapor)   lepstgas3.clear();  break;
-         case NEPTUNE::d_epstg_d_c_1_ph:   if (mode == vapor)   lepstgasx[0].clear();  break;
-         case NEPTUNE::d_epstg_d_c_2_ph:   if (mode == vapor)   lepstgasx[1].clear();  break;
-         case NEPTUNE::d_epstg_d_c_3_ph:   if (mode == vapor)   lepstgasx[2].clear();  break;
-         case NEPTUNE::d_epstg_d_c_4_ph:   if (mode == vapor)   lepstgasx[3].clear();  break;
-         case NEPTUNE::d_hvspsc_dp_h:      if (mode == vapor)   lhvspsc1.clear();  break;
-         case NEPTUNE::d_hvspsc_dh_p:      if (mode == vapor)   lhvspsc3.clear();  break;
-         case NEPTUNE::d_hvspsc_d_c_1_ph:  if (mode == vapor)   lhvspscx[0].clear();  break;
-         case NEPTUNE::d_hvspsc_d_c_2_ph:  if (mode == vapor)   lhvspscx[1].clear();  break;
-         case NEPTUNE::d_hvspsc_d_c_3_ph:  if (mode == vapor)   lhvspscx[2].clear();  break;
-         case NEPTUNE::d_hvspsc_d_c_4_ph:  if (mode == vapor)   lhvspscx[3].clear();  break;
-         case NEPTUNE::d_hvsvsc_dp_h:      if (mode == vapor)   lhvsvsc1.clear();  break;
-         case NEPTUNE::d_hvsvsc_dh_p:      if (mode == vapor)   lhvsvsc3.clear();  break;
-         case NEPTUNE::d_hvsvsc_d_c_1_ph:  if (mode == vapor)   lhvsvscx[0].clear();  break;
-         case NEPTUNE::d_hvsvsc_d_c_2_ph:  if (mode == vapor)   lhvsvscx[1].clear();  break;
-         case NEPTUNE::d_hvsvsc_d_c_3_ph:  if (mode == vapor)   lhvsvscx[2].clear();  break;
-         case NEPTUNE::d_hvsvsc_d_c_4_ph:  if (mode == vapor)   lhvsvscx[3].clear();  break;
+         case NEPTUNE::epstl:              if (mode == liquid)  unmap_ptr(lepstliq);  break;
+         case NEPTUNE::hlspsc:             if (mode == liquid)  unmap_ptr(lhlspsc);  break;
+         case NEPTUNE::hlsvsc:             if (mode == liquid)  unmap_ptr(lhlsvsc);  break;
+         case NEPTUNE::epstg:              if (mode == liquid)  unmap_ptr(lepstgas);  break;
+         case NEPTUNE::hvspsc:             if (mode == liquid)  unmap_ptr(lhvspsc);  break;
+         case NEPTUNE::hvsvsc:             if (mode == liquid)  unmap_ptr(lhvsvsc);  break;
+         case NEPTUNE::d_epstl_dp_h:       if (mode == liquid)  unmap_ptr(lepstliq1);  break;
+         case NEPTUNE::d_epstl_dh_p:       if (mode == liquid)  unmap_ptr(lepstliq2);  break;
+         case NEPTUNE::d_hlspsc_dp_h:      if (mode == liquid)  unmap_ptr(lhlspsc1);  break;
+         case NEPTUNE::d_hlspsc_dh_p:      if (mode == liquid)  unmap_ptr(lhlspsc2);  break;
+         case NEPTUNE::d_hlsvsc_dp_h:      if (mode == liquid)  unmap_ptr(lhlsvsc1);  break;
+         case NEPTUNE::d_hlsvsc_dh_p0:     if (mode == liquid)  unmap_ptr(lhlsvsc2);  break;
+         case NEPTUNE::d_hlsvsc_dh_p:      if (mode == liquid)  unmap_ptr(lhlsvsc3);  break;
+         case NEPTUNE::d_hlsvsc_d_c_1_ph:  if (mode == liquid)  unmap_ptr(lhlsvscx[0]);  break;
+         case NEPTUNE::d_hlsvsc_d_c_2_ph:  if (mode == liquid)  unmap_ptr(lhlsvscx[1]);  break;
+         case NEPTUNE::d_hlsvsc_d_c_3_ph:  if (mode == liquid)  unmap_ptr(lhlsvscx[2]);  break;
+         case NEPTUNE::d_hlsvsc_d_c_4_ph:  if (mode == liquid)  unmap_ptr(lhlsvscx[3]);  break;
+         case NEPTUNE::d_epstg_dp_h:       if (mode == vapor)   unmap_ptr(lepstgas1);  break;
+         case NEPTUNE::d_epstg_dh_p:       if (mode == vapor)   unmap_ptr(lepstgas3);  break;
+         case NEPTUNE::d_epstg_d_c_1_ph:   if (mode == vapor)   unmap_ptr(lepstgasx[0]);  break;
+         case NEPTUNE::d_epstg_d_c_2_ph:   if (mode == vapor)   unmap_ptr(lepstgasx[1]);  break;
+         case NEPTUNE::d_epstg_d_c_3_ph:   if (mode == vapor)   unmap_ptr(lepstgasx[2]);  break;
+         case NEPTUNE::d_epstg_d_c_4_ph:   if (mode == vapor)   unmap_ptr(lepstgasx[3]);  break;
+         case NEPTUNE::d_hvspsc_dp_h:      if (mode == vapor)   unmap_ptr(lhvspsc1);  break;
+         case NEPTUNE::d_hvspsc_dh_p:      if (mode == vapor)   unmap_ptr(lhvspsc3);  break;
+         case NEPTUNE::d_hvspsc_d_c_1_ph:  if (mode == vapor)   unmap_ptr(lhvspscx[0]);  break;
+         case NEPTUNE::d_hvspsc_d_c_2_ph:  if (mode == vapor)   unmap_ptr(lhvspscx[1]);  break;
+         case NEPTUNE::d_hvspsc_d_c_3_ph:  if (mode == vapor)   unmap_ptr(lhvspscx[2]);  break;
+         case NEPTUNE::d_hvspsc_d_c_4_ph:  if (mode == vapor)   unmap_ptr(lhvspscx[3]);  break;
+         case NEPTUNE::d_hvsvsc_dp_h:      if (mode == vapor)   unmap_ptr(lhvsvsc1);  break;
+         case NEPTUNE::d_hvsvsc_dh_p:      if (mode == vapor)   unmap_ptr(lhvsvsc3);  break;
+         case NEPTUNE::d_hvsvsc_d_c_1_ph:  if (mode == vapor)   unmap_ptr(lhvsvscx[0]);  break;
+         case NEPTUNE::d_hvsvsc_d_c_2_ph:  if (mode == vapor)   unmap_ptr(lhvsvscx[1]);  break;
+         case NEPTUNE::d_hvsvsc_d_c_3_ph:  if (mode == vapor)   unmap_ptr(lhvsvscx[2]);  break;
+         case NEPTUNE::d_hvsvsc_d_c_4_ph:  if (mode == vapor)   unmap_ptr(lhvsvscx[3]);  break;
          default: 
             return 0 ;
        }
@@ -2029,6 +2054,8 @@ namespace CATHARE2
        { ferr = EOS_Internal_Error::NOT_IMPLEMENTED ;
          return EOS_Error::error ;
        }
+    bool need_pt, need_tra, need_lim ;
+    calc2_needs(out, need_pt, need_tra, need_lim) ;
     preconvert_eos_fields() ;
     rezise_eos_fields(nsca, phase) ;
 
@@ -2059,14 +2086,15 @@ namespace CATHARE2
          }
     }
     // M.F.
-    if (nincon == 0)
+    if ((nincon == 0) && need_pt)
        { if ((phase == liquid) || (phase == unknown)) ftliqfld() ;
          if ((phase == vapor)  || (phase == unknown)) ftvapfld() ;
        }
     // M.F.
     ferr.set_worst_error(err_tmp) ;
     err_tmp = EOS_Internal_Error::OK ;
-    ftrafld(ill, ivstat = 0, phase) ;
+    ivstat = 0 ;
+    if (need_tra) ftrafld(ill, ivstat, phase) ;
     if (ivstat != 0) 
        { err_tmp.set(ill-1, convert_eos_error(ivstat));
          for (; ill<nsca; ill++)
@@ -2078,7 +2106,7 @@ namespace CATHARE2
          return ferr.find_worst_error().generic_error() ;
        }
     ferr.set_worst_error(err_tmp) ;
-    calc2_lim() ;
+    if (need_lim) calc2_lim() ;
     ferr.set_worst_error(err_tmp) ;
     postconvert_eos_fields() ;
 
@@ -2170,6 +2198,8 @@ namespace CATHARE2
        { ferr = EOS_Internal_Error::NOT_IMPLEMENTED ;
          return EOS_Error::error ;
        }
+    bool need_pt, need_tra, need_lim ;
+    calc2_needs(out, need_pt, need_tra, need_lim) ;
     preconvert_eos_fields() ;
     rezise_eos_fields(nsca, phase) ;
     ftsatpfld() ;
@@ -2217,7 +2247,8 @@ namespace CATHARE2
        }
     ferr.set_worst_error(err_tmp) ;
     err_tmp = EOS_Internal_Error::OK ;
-    ftrafld(ill, ivstat = 0, phase) ;
+    ivstat = 0 ;
+    if (need_tra) ftrafld(ill, ivstat, phase) ;
     if (ivstat != 0) 
        { err_tmp.set(ill-1, convert_eos_error(ivstat)) ;
          for (; ill<nsca; ill++)
@@ -2229,7 +2260,7 @@ namespace CATHARE2
          return ferr.find_worst_error().generic_error() ;
        }
     ferr.set_worst_error(err_tmp) ;
-    calc2_lim() ;
+    if (need_lim) calc2_lim() ;
     ferr.set_worst_error(err_tmp) ;
     postconvert_eos_fields() ;
 
@@ -2348,6 +2379,72 @@ namespace CATHARE2
     return EOS_Internal_Error::OK ; 
   }
   
+  void CATHARE2::calc2_needs(const EOS_Fields &out, bool &need_pt, bool &need_tra, bool &need_lim) const
+  { need_pt  = false ;
+    need_tra = false ;
+    need_lim = (phase == unknown) ;
+    // with noncondensable gas, the vapor cp (lcpg*) of the mixture is computed by ftrafld
+    bool cp_tra = (nincon > 0) && (phase != liquid) ;
+    for (int i=0; i<out.size() && !need_tra; i++)
+       { switch(out[i].get_property_number())
+            { case NEPTUNE::p:
+              case NEPTUNE::h:
+              case NEPTUNE::T:
+              case NEPTUNE::rho:
+              case NEPTUNE::beta:
+              case NEPTUNE::d_T_d_p_h:
+              case NEPTUNE::d_T_d_h_p:
+              case NEPTUNE::d_h_d_p_T:
+              case NEPTUNE::d_rho_d_p_h:
+              case NEPTUNE::d_rho_d_h_p:
+              case NEPTUNE::d_beta_d_p_h:
+              case NEPTUNE::d_beta_d_h_p:
+              case NEPTUNE::p_sat:
+              case NEPTUNE::T_sat:
+              case NEPTUNE::h_l_sat:
+              case NEPTUNE::h_v_sat:
+              case NEPTUNE::cp_l_sat:
+              case NEPTUNE::cp_v_sat:
+              case NEPTUNE::rho_l_sat:
+              case NEPTUNE::rho_v_sat:
+              case NEPTUNE::d_T_sat_d_p:
+              case NEPTUNE::d_h_l_sat_d_p:
+              case NEPTUNE::d_h_v_sat_d_p:
+              case NEPTUNE::d_cp_l_sat_d_p:
+              case NEPTUNE::d_cp_v_sat_d_p:
+              case NEPTUNE::d_rho_l_sat_d_p:
+              case NEPTUNE::d_rho_v_sat_d_p:
+              case NEPTUNE::d2_T_sat_d_p_d_p:
+              case NEPTUNE::p_lim:
+                 break ;
+              case NEPTUNE::h_l_lim:
+              case NEPTUNE::h_v_lim:
+                 need_lim = true ;
+                 break ;
+              case NEPTUNE::cp:
+              case NEPTUNE::d_h_d_T_p:
+              case NEPTUNE::d_cp_d_p_h:
+              case NEPTUNE::d_cp_d_h_p:
+                 if (cp_tra)  need_tra = true ;
+                 break ;
+              case NEPTUNE::d_rho_d_p_T:
+              case NEPTUNE::d_rho_d_T_p:
+              case NEPTUNE::d_cp_d_p_T:
+              case NEPTUNE::d_cp_d_T_p:
+                 need_pt = true ;
+                 break ;
+              default:
+                 // transport, noncondensable, metastable... : full pipeline
+                 need_tra = true ;
+                 break ;
+            }
+       }
+    if (need_tra)
+       { need_pt  = true ;
+         need_lim = true ;
+       }
+  }
+
   EOS_Error CATHARE2::calc2_lim() 
   { ArrOfDouble diff(nsca) ;
     diff   = lhvsp ;
@@ -151,14 +151,14 @@ namespace CATHARE2
      * ~CATHARE2() is pure virtual to force CATHARE2 to be abstract
      */
     virtual ~CATHARE2() = 0 ;
-    static bool in_erpile ;     //!< erpile error flag
+    static thread_local bool in_erpile ; //!< erpile error flag (per thread)
 
   protected:
     int nincon ;                //!< Number of noncondensible gas
     int nsca   ;                //!< Number of scalars
 
     static const double tabsk ; //!< Thermodynamic temperature of water triple point
-    static TH_space typ_ths   ;
+    TH_space typ_ths          ; //!< Thermo space of the current computation
     double un, zero, epspp    ;
 
     EOS_Fluid* fluid ;      //!< Pointer to the EOS_Cathare2 adapter
@@ -267,6 +267,10 @@ namespace CATHARE2
     ArrOfDouble lt1, lh1, lr1, lcp1, lmu1, lla1;
     ArrOfDouble lt2, lh2, lr2, lcp2, lmu2, lla2;
 
+    // Work arrays set aside while mapped on user fields
+    vector<ArrOfDouble*> mapped_arr ;
+    vector<ArrOfDouble>  mapped_own ;
+
     //! Check boundaries for a field
     /*!
      * \param[in] in field to check
@@ -300,6 +304,21 @@ namespace CATHARE2
      */
     int map_eos_field(const EOS_Field& f, domain mode);
 
+    //! Map a work array on the data of a field
+    /*!
+     * The allocated work array is kept aside and given back by unmap_ptr,
+     * so that it is reused by the next computation without reallocation.
+     * \param[in,out] a the work array
+     * \param[in] f the field
+     */
+    void map_ptr(ArrOfDouble& a, const EOS_Field& f);
+
+    //! Give back to a work array the allocation kept by map_ptr
+    /*!
+     * \param[in,out] a the work array
+     */
+    void unmap_ptr(ArrOfDouble& a);
+
     //! Map fields to CATHARE2 variables
     /*!
      * \param[in] f the fields to map
@@ -394,6 +413,18 @@ namespace CATHARE2
      */
     EOS_Error calc2_lim() ;
 
+    //! Select the Fortran pilots needed by the requested output fields
+    /*!
+     * Only thermodynamic properties known to be computed by fhpfld (and
+     * ftliqfld/ftvapfld for the (p,T) derivatives) can skip ftrafld :
+     * any other property keeps the whole pipeline.
+     * \param[in] out output fields
+     * \param[out] need_pt ftliqfld/ftvapfld needed (calc2_ph only)
+     * \param[out] need_tra ftrafld needed
+     * \param[out] need_lim calc2_lim needed
+     */
+    void calc2_needs(const EOS_Fields &out, bool &need_pt, bool &need_tra, bool &need_lim) const ;
+
     //! FHPFLD pilot (generated from Fortran)
     virtual int fhpfld(int& ill, int& ivstat, int& ivalu, domain mode) = 0 ;
     //! FTRAFLD pilot (generated from Fortran)
@@ -16,10 +16,9 @@
 
 
 #include "EOS_Cathare2.hxx"
-
-#ifdef _OPENMP
-#include <omp.h>
-#endif
+#include <atomic>
+#include <mutex>
+#include <set>
 
 using namespace NEPTUNE ;
 
@@ -56,13 +55,39 @@ namespace NEPTUNE_EOS
   { return *(new EOS_Cathare2()) ;
   }
 
+  // pilots of the calling thread, one entry per EOS_Cathare2 it used ;
+  // serials are never reused, the entries of a destroyed fluid are
+  // dropped by the next add_thread_pilot of the thread
+  struct Thread_Pilot
+  { long serial ;
+    CATHARE2::CATHARE2* pilot ;
+  } ;
+  static thread_local std::vector<Thread_Pilot> thread_pilots ;
+
+  // serials of the live fluids, and the lock taken to build a pilot
+  static std::mutex& pilots_mutex()
+  { static std::mutex m ;
+    return m ;
+  }
+  static std::set<long>& live_serials()
+  { static std::set<long> s ;
+    return s ;
+  }
+  static long new_serial()
+  { static std::atomic<long> next(0) ;
+    long sn = ++next ;
+    std::lock_guard<std::mutex> lock(pilots_mutex()) ;
+    live_serials().insert(sn) ;
+    return sn ;
+  }
+
   EOS_Cathare2::EOS_Cathare2(CATHARE2::domain the_phase) :
-  pilot(NULL), phase(the_phase), fluidname(UnknownStr)
+  phase(the_phase), fluidname(UnknownStr), serial(new_serial())
   {
   }
 
   EOS_Cathare2::EOS_Cathare2() :
-    pilot(NULL), phase(CATHARE2::unknown), fluidname(UnknownStr)
+    phase(CATHARE2::unknown), fluidname(UnknownStr), serial(new_serial())
   {
   }
 
@@ -71,8 +96,47 @@ namespace NEPTUNE_EOS
   }
 
   EOS_Cathare2::~EOS_Cathare2()
-  { if (pilot) delete pilot;
-    pilot = NULL;
+  { std::lock_guard<std::mutex> lock(pilots_mutex()) ;
+    live_serials().erase(serial) ;
+    for (size_t i=0; i<pilots.size(); i++)  delete pilots[i] ;
+    pilots.clear() ;
+  }
+
+  CATHARE2::CATHARE2* EOS_Cathare2::local_pilot() const
+  { for (size_t i=0; i<thread_pilots.size(); i++)
+       if (thread_pilots[i].serial == serial)  return thread_pilots[i].pilot ;
+    return add_thread_pilot() ;
+  }
+
+  CATHARE2::CATHARE2* EOS_Cathare2::add_thread_pilot() const
+  { std::lock_guard<std::mutex> lock(pilots_mutex()) ;
+    assert(!pilots.empty()) ;
+    size_t k = 0 ;
+    for (size_t i=0; i<thread_pilots.size(); i++)
+       if (live_serials().count(thread_pilots[i].serial))
+          thread_pilots[k++] = thread_pilots[i] ;
+    thread_pilots.resize(k) ;
+
+    // same fluid and options as the pilot built by init
+    Strings args(1) ;
+    args[0] = fluidname ;
+    CATHARE2::CATHARE2* local_pilot = const_cast<EOS_Cathare2*>(this)->new_pilot(args) ;
+    assert(local_pilot) ;
+    for (int i=0; i<options.size(); i++)
+       set_option(local_pilot, options, i) ;
+    pilots.push_back(local_pilot) ;
+    thread_pilots.push_back({serial, local_pilot}) ;
+    return local_pilot ;
+  }
+
+  CATHARE2::CATHARE2* EOS_Cathare2::new_pilot(const Strings& args)
+  { CATHARE2::CATHARE2 *local_pilot = nullptr;
+
+  #include "EOS_Cathare2.cxx.fld"
+    {
+      local_pilot = nullptr;
+    }
+    return local_pilot;
   }
 
   int EOS_Cathare2::type_Id=(RegisterType
@@ -89,34 +153,18 @@ namespace NEPTUNE_EOS
 
   int EOS_Cathare2::init(const Strings& args) 
   { int i = 0 ;
-    if (pilot == NULL) {
-
-      bool err = false;
-
-    #ifdef _OPENMP
-      pilot = new CATHARE2::CATHARE2*[omp_get_max_threads()];
-    #pragma omp parallel reduction(|| : err)
-      {
-    #endif
-        CATHARE2::CATHARE2 *local_pilot = nullptr;
-        err = false;
-
-      #include "EOS_Cathare2.cxx.fld"
-        {
-          err = true;
-        }
-    #ifdef _OPENMP
-        pilot[omp_get_thread_num()] = local_pilot;
-      }
-    #else
-      pilot = local_pilot;
-    #endif
-
-      if (err)
+    if (pilots.empty()) {
+      // pilot of the calling thread, the others are built on first use
+      CATHARE2::CATHARE2 *local_pilot = new_pilot(args);
+      if (local_pilot == nullptr)
       {
         cerr << "Unknown fluid " << args[0] << endl;
         return EOS_Error::error ;
       }
+      { std::lock_guard<std::mutex> lock(pilots_mutex()) ;
+        pilots.push_back(local_pilot) ;
+      }
+      thread_pilots.push_back({serial, local_pilot}) ;
 
       fluidname = args[0];
       equationname = args[0];
@@ -124,40 +172,45 @@ namespace NEPTUNE_EOS
       i++;
     }
 
-    CATHARE2::CATHARE2 * local_pilot;
-
-    #ifdef _OPENMP
-    local_pilot = pilot[omp_get_thread_num()];
-    #else
-    local_pilot = pilot;
-    #endif    
-    
     //! \todo Add checks on arguments
     //! \todo Add option POLYNCPT
     for (; i<args.size(); i++) 
        { if (i == args.size()) return EOS_Error::error ;
-         EOS_Error err ;
-         if ( args[i] == AString("ICAR") || args[i] == AString("icar"))
-           err  = local_pilot->set_icar(atoi(args[++i].aschar()));
-         else if ( args[i] == AString("ICARGAS") || args[i] == AString("icargas"))
-           err  = local_pilot->set_icargas(atoi(args[++i].aschar()));
-         else if ( args[i] == AString("IENC") || args[i] == AString("ienc"))
-           err  = local_pilot->set_ienc(atoi(args[++i].aschar()));
-         else if ( args[i] == AString("IREV") || args[i] == AString("irev"))
-           err  = local_pilot->set_irev(atoi(args[++i].aschar()));
-         else if ( args[i] == AString("ITERMIN") || args[i] == AString("itermin"))
-           err  = local_pilot->set_itermin(atoi(args[++i].aschar()));
-         else if ( args[i] == AString("LATYPML") || args[i] == AString("latypml"))
-           err  = local_pilot->set_latypml(atoi(args[++i].aschar()));
-         else if ( args[i] == AString("MUTYPML") || args[i] == AString("mutypml"))
-           err  = local_pilot->set_mutypml(atoi(args[++i].aschar()));
-         else 
-           err = EOS_Error::error ;
-         if (err != EOS_Error::good) return EOS_Error::error ;
+         // options are given to every pilot, and kept for the next ones
+         std::lock_guard<std::mutex> lock(pilots_mutex()) ;
+         int iopt = i ;
+         for (size_t j=0; j<pilots.size(); j++)
+            { i = iopt ;
+              if (set_option(pilots[j], args, i) != EOS_Error::good)  return EOS_Error::error ;
+            }
+         int nopt = options.size() ;
+         options.resize(nopt + i+1 - iopt) ;
+         for (int j=iopt; j<=i; j++)  options[nopt + j-iopt] = args[j] ;
        }
     return EOS_Error::good ;
   }
 
+  EOS_Error EOS_Cathare2::set_option(CATHARE2::CATHARE2* local_pilot, const Strings& args, int& i)
+  { EOS_Error err ;
+    if ( args[i] == AString("ICAR") || args[i] == AString("icar"))
+      err  = local_pilot->set_icar(atoi(args[++i].aschar()));
+    else if ( args[i] == AString("ICARGAS") || args[i] == AString("icargas"))
+      err  = local_pilot->set_icargas(atoi(args[++i].aschar()));
+    else if ( args[i] == AString("IENC") || args[i] == AString("ienc"))
+      err  = local_pilot->set_ienc(atoi(args[++i].aschar()));
+    else if ( args[i] == AString("IREV") || args[i] == AString("irev"))
+      err  = local_pilot->set_irev(atoi(args[++i].aschar()));
+    else if ( args[i] == AString("ITERMIN") || args[i] == AString("itermin"))
+      err  = local_pilot->set_itermin(atoi(args[++i].aschar()));
+    else if ( args[i] == AString("LATYPML") || args[i] == AString("latypml"))
+      err  = local_pilot->set_latypml(atoi(args[++i].aschar()));
+    else if ( args[i] == AString("MUTYPML") || args[i] == AString("mutypml"))
+      err  = local_pilot->set_mutypml(atoi(args[++i].aschar()));
+    else 
+      err = EOS_Error::error ;
+    return err ;
+  }
+
   int EOS_Cathare2::init(const Strings& args, const Strings& other_args) 
   { int iret ;
     iret = init(args) ;
@@ -168,14 +221,8 @@ namespace NEPTUNE_EOS
   EOS_Error EOS_Cathare2::compute (const EOS_Field& in, EOS_Fields& out, 
                                    EOS_Error_Field& err) const 
   { 
-    CATHARE2::CATHARE2 * local_pilot;
-
-    #ifdef _OPENMP
-    local_pilot = pilot[omp_get_thread_num()];
-    #else
-    local_pilot = pilot;
-    #endif    
-    
+    CATHARE2::CATHARE2 * local_pilot = this->local_pilot();
+
     assert(local_pilot) ;
     const EOS_Property property_number = in.get_property_number();
     if ( (property_number == NEPTUNE::p) 
@@ -202,13 +249,7 @@ namespace NEPTUNE_EOS
 
   EOS_Error EOS_Cathare2::compute (const EOS_Field& in1, const EOS_Field& in2, 
                                    EOS_Fields& out, EOS_Error_Field& err) const 
-  { CATHARE2::CATHARE2 * local_pilot;
-
-    #ifdef _OPENMP
-    local_pilot = pilot[omp_get_thread_num()];
-    #else
-    local_pilot = pilot;
-    #endif
+  { CATHARE2::CATHARE2 * local_pilot = this->local_pilot();
 
     assert(local_pilot) ;
     ArrOfInt err_array(in1.size()) ;
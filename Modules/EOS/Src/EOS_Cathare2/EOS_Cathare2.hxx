@@ -13,13 +13,11 @@
 *
 *****************************************************************************/
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #ifndef EOS_CATHARE2_HXX
 #define EOS_CATHARE2_HXX
 
+#include <vector>
+
 #include "EOS/Src/EOS_Cathare2/Cathare2.hxx"
 #include "EOS/Src/EOS_Cathare2/Cathare2_fld.hxx"
 #include "EOS/API/EOS_Fluid.hxx"
@@ -212,11 +210,14 @@ namespace NEPTUNE_EOS
     void describe_error(const EOS_Internal_Error error, AString & description) const;
 
   protected:
-#ifdef _OPENMP
-    CATHARE2::CATHARE2 **pilot;   //!< pointer to vector of pilot class (thread local)
-#else
-    CATHARE2::CATHARE2 *pilot;   //!< pointer to the pilot class
-#endif
+    //! Pilot (and its work arrays) of the calling thread, built on first use
+    /*!
+     * Each thread (OpenMP, std::thread, Python caller) gets its own pilot,
+     * found without lock in a thread_local table keyed by the fluid
+     * serial number. The pilots belong to the fluid and are deleted with it.
+     */
+    CATHARE2::CATHARE2* local_pilot() const;
+
     CATHARE2::domain phase;      //!< liquid or vapor
     AString fluidname;         //!< fluid name
     AString equationname;           //!< fluid name (with phase)
@@ -224,171 +225,92 @@ namespace NEPTUNE_EOS
   private:
     //! Type identifier: see language documentation
     static int type_Id;
+
+    //! Give the init option args[i] (and its value) to a pilot
+    static EOS_Error set_option(CATHARE2::CATHARE2* local_pilot, const Strings& args, int& i);
+    //! New pilot for fluid args[0], nullptr if the fluid is unknown
+    CATHARE2::CATHARE2* new_pilot(const Strings& args);
+    //! Build the pilot of the calling thread (locked, once per thread)
+    CATHARE2::CATHARE2* add_thread_pilot() const;
+
+    long serial;                 //!< key of the fluid in the thread pilot tables
+    Strings options;             //!< init options, given to every pilot
+    mutable std::vector<CATHARE2::CATHARE2*> pilots;  //!< all the thread pilots
   };
 
   inline EOS_Internal_Error EOS_Cathare2::get_mm(double& mm) const
   {     
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_mm( mm);
-    #else
-      assert(pilot);
-      return pilot->get_mm( mm);
-    #endif
+    return local_pilot()->get_mm( mm);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_p_crit(double& p_crit) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_p_crit( p_crit);
-    #else
-      assert(pilot);
-      return pilot->get_p_crit( p_crit);
-    #endif
+    return local_pilot()->get_p_crit( p_crit);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_h_crit(double& h_crit) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_h_crit( h_crit);
-    #else
-      assert(pilot);
-      return pilot->get_h_crit( h_crit);
-    #endif
+    return local_pilot()->get_h_crit( h_crit);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_T_crit(double& T_crit) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_T_crit( T_crit);
-    #else
-      assert(pilot);
-      return pilot->get_T_crit( T_crit);
-    #endif
+    return local_pilot()->get_T_crit( T_crit);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_p_min(double& p_min) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_p_min( p_min);
-    #else
-      assert(pilot);
-      return pilot->get_p_min( p_min);
-    #endif
+    return local_pilot()->get_p_min( p_min);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_p_max(double& p_max) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_p_max( p_max);
-    #else
-      assert(pilot);
-      return pilot->get_p_max( p_max);
-    #endif
+    return local_pilot()->get_p_max( p_max);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_h_min(double& h_min) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_h_min( h_min);
-    #else
-      assert(pilot);
-      return pilot->get_h_min( h_min);
-    #endif
+    return local_pilot()->get_h_min( h_min);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_h_max(double& h_max) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_h_max( h_max);
-    #else
-      assert(pilot);
-      return pilot->get_h_max( h_max);
-    #endif
+    return local_pilot()->get_h_max( h_max);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_T_min(double& T_min) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_T_min( T_min);
-    #else
-      assert(pilot);
-      return pilot->get_T_min( T_min);
-    #endif
+    return local_pilot()->get_T_min( T_min);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_T_max(double& T_max) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_T_max( T_max);
-    #else
-      assert(pilot);
-      return pilot->get_T_max( T_max);
-    #endif
+    return local_pilot()->get_T_max( T_max);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_p_ref(double& p_ref) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_p_ref( p_ref);
-    #else
-      assert(pilot);
-      return pilot->get_p_ref( p_ref);
-    #endif
+    return local_pilot()->get_p_ref( p_ref);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_h_ref(double& h_ref) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_h_ref( h_ref);
-    #else
-      assert(pilot);
-      return pilot->get_h_ref( h_ref);
-    #endif
+    return local_pilot()->get_h_ref( h_ref);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::get_T_ref(double& T_ref) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->get_T_ref( T_ref);
-    #else
-      assert(pilot);
-      return pilot->get_T_ref( T_ref);
-    #endif
+    return local_pilot()->get_T_ref( T_ref);
   }
 
   inline EOS_Internal_Error EOS_Cathare2::compute_h_l_lim_p( double p, double& h_l_lim ) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->compute_h_l_lim_p( p, h_l_lim );
-    #else
-      assert(pilot);
-      return pilot->compute_h_l_lim_p( p, h_l_lim );
-    #endif
+    return local_pilot()->compute_h_l_lim_p( p, h_l_lim );
   }
 
   inline EOS_Internal_Error EOS_Cathare2::compute_h_v_lim_p( double p, double& h_v_lim ) const
   {
-    #ifdef _OPENMP
-      assert(pilot[omp_get_thread_num()]);
-      return pilot[omp_get_thread_num()]->compute_h_v_lim_p( p, h_v_lim );
-    #else
-      assert(pilot);
-      return pilot->compute_h_v_lim_p( p, h_v_lim );
-    #endif
+    return local_pilot()->compute_h_v_lim_p( p, h_v_lim );
   }
 
   inline void EOS_Cathare2::describe_error(const EOS_Internal_Error ierr, AString & description) const
@@ -52,13 +52,7 @@ namespace NEPTUNE_EOS
   EOS_Error EOS_Cathare2Vapor::calc2_mixing(const int n, const EOS_Fields& in, EOS_Fields& out, EOS_Error_Field& ferr)
   { // set_mixing_properties has already been done for (r,cp0,cp1,...)
     
-    CATHARE2::CATHARE2 *local_pilot;
-
-    #ifdef _OPENMP
-      local_pilot = pilot[omp_get_thread_num()];
-    #else
-       local_pilot = pilot;
-    #endif
+    CATHARE2::CATHARE2 *local_pilot = this->local_pilot();
 
     assert (local_pilot) ;
     assert ((n>0) && (n<5)) ;
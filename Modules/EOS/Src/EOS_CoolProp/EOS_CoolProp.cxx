@@ -26,6 +26,9 @@ extern "C" {
 #include "Language/API/Types_Info.hxx"
 #include "EOS/API/EOS_Config.hxx"
 #include <fstream>
+#include <atomic>
+#include <mutex>
+#include <set>
 
 namespace NEPTUNE_EOS
 {
@@ -353,8 +356,40 @@ namespace NEPTUNE_EOS
   // ---------------------------------------------------------------------------
   // ---------------------------------------------------------------------------
 
+  // ---------------------------------------------------------------------------
+  // Handles of the calling thread, one entry per EOS_CoolProp it used.
+  // Serials are never reused : the entries of a destroyed object are
+  // never matched, and are dropped by the next add_state_handle_ of
+  // the thread.
+
+  struct Thread_Handle
+  { long serial;
+    long handle;
+  };
+  static thread_local std::vector<Thread_Handle> thread_handles;
+
+  // serials of the live objects, and the lock taken to create a handle
+  static std::mutex& handles_mutex()
+  { static std::mutex m;
+    return m;
+  }
+  static std::set<long>& live_serials()
+  { static std::set<long> s;
+    return s;
+  }
+  static long new_serial()
+  { static std::atomic<long> next(0);
+    long sn = ++next;
+    std::lock_guard<std::mutex> lock(handles_mutex());
+    live_serials().insert(sn);
+    return sn;
+  }
+
+  // ---------------------------------------------------------------------------
+
   EOS_CoolProp::EOS_CoolProp() :
     abstract_state_handle_(-1),
+    serial_(new_serial()),
     handle_phase_(UnknownStr),
     backend_(DefaultBackend_),
     fluid_name_(UnknownStr),
@@ -417,6 +452,16 @@ namespace NEPTUNE_EOS
   { return fluid_name_ ;
   }
 
+  // one CoolProp state per thread, see state_handle_
+  bool EOS_CoolProp::is_thread_safe() const
+  { return true ;
+  }
+
+  // the single-field compute is batched, see compute(in1, in2, out, err)
+  bool EOS_CoolProp::fuses_fields() const
+  { return false ;
+  }
+
   // ---------------------------------------------------------------------------
   // ---------------------------------------------------------------------------
 
@@ -430,13 +475,74 @@ namespace NEPTUNE_EOS
 
   EOS_CoolProp::~EOS_CoolProp()
   {
-    if (abstract_state_handle_ != -1) {
-      long errcode = 0;
-      char message_buffer[512];
-      AbstractState_free(abstract_state_handle_,
-                         &errcode, message_buffer, 511);
-      abstract_state_handle_ = -1;
+    long errcode = 0;
+    char message_buffer[512];
+    std::lock_guard<std::mutex> lock(handles_mutex());
+    live_serials().erase(serial_);
+    for (size_t i = 0; i < state_handles_.size(); i++)
+      AbstractState_free(state_handles_[i], &errcode, message_buffer, 511);
+    state_handles_.clear();
+    abstract_state_handle_ = -1;
+  }
+
+  // ---------------------------------------------------------------------------
+
+  long EOS_CoolProp::new_state_handle_() const
+  {
+    long errcode = 0;
+    char message_buffer[512];
+    long handle = AbstractState_factory(backend_.aschar(),
+                                        fluid_name_.aschar(),
+                                        &errcode,
+                                        message_buffer,
+                                        511);
+    if (errcode != 0) {
+      print_error_message_(message_buffer);
+      return -1;
+    }
+
+    errcode = 0;
+    AbstractState_specify_phase(handle,
+                                handle_phase_.aschar(),
+                                &errcode,
+                                message_buffer,
+                                511);
+    if (errcode != 0) {
+      print_error_message_(message_buffer);
+      AbstractState_free(handle, &errcode, message_buffer, 511);
+      return -1;
     }
+
+    return handle;
+  }
+
+  // ---------------------------------------------------------------------------
+
+  // OpenMP threads (nested teams included), std::thread or Python
+  // threads : each one gets its own AbstractState
+  long EOS_CoolProp::state_handle_() const
+  {
+    for (size_t i = 0; i < thread_handles.size(); i++)
+      if (thread_handles[i].serial == serial_)
+        return thread_handles[i].handle;
+    return add_state_handle_();
+  }
+
+  long EOS_CoolProp::add_state_handle_() const
+  {
+    std::lock_guard<std::mutex> lock(handles_mutex());
+    size_t k = 0;
+    for (size_t i = 0; i < thread_handles.size(); i++)
+      if (live_serials().count(thread_handles[i].serial))
+        thread_handles[k++] = thread_handles[i];
+    thread_handles.resize(k);
+
+    const long handle = new_state_handle_();
+    if (handle == -1)
+      return -1;
+    state_handles_.push_back(handle);
+    thread_handles.push_back({serial_, handle});
+    return handle;
   }
 
   const Type_Info& EOS_CoolProp::get_Type_Info () const
@@ -486,31 +592,19 @@ namespace NEPTUNE_EOS
     // equation of state name : EosStr
     fluid_name_phase_ =  fluid_name_;
 
-    // Get handles
+    // Get handles : the first one now, the other threads on first use
 
     long errcode = 0;
     char message_buffer[512];
-    abstract_state_handle_ = AbstractState_factory(backend_.aschar(),
-                                                   fluid_name_.aschar(),
-                                                   &errcode,
-                                                   message_buffer,
-                                                   511);
-
-    if (errcode != 0) {
-      print_error_message_(message_buffer);
+    abstract_state_handle_ = new_state_handle_();
+    if (abstract_state_handle_ == -1)
       return EOS_Error::error;
-    }
 
-    errcode = 0;
-    AbstractState_specify_phase(abstract_state_handle_,
-                                handle_phase_.aschar(),
-                                &errcode,
-                                message_buffer,
-                                511);
-    if (errcode != 0) {
-      print_error_message_(message_buffer);
-      return EOS_Error::error;
+    {
+      std::lock_guard<std::mutex> lock(handles_mutex());
+      state_handles_.push_back(abstract_state_handle_);
     }
+    thread_handles.push_back({serial_, abstract_state_handle_});
 
     /* Initialize molar_mass */
 
@@ -555,18 +649,18 @@ namespace NEPTUNE_EOS
                                   EOS_Fields&      out,
                                   EOS_Error_Field& err) const
   {
-    assert(abstract_state_handle_ != -1);
+    assert(state_handle_() != -1);
 
     if ( in.get_property() == NEPTUNE::p ||
          in.get_sat_property() == NEPTUNE::p_sat ||
          in.get_lim_property() == NEPTUNE::p_lim) {
-      return compute_list_at_sat_<true>(abstract_state_handle_,
+      return compute_list_at_sat_<true>(state_handle_(),
                                         in, sat_quality_,
                                         out, err);
     }
     else if (in.get_property() == NEPTUNE::T ||
              in.get_sat_property() == NEPTUNE::T_sat) {
-      return compute_list_at_sat_<false>(abstract_state_handle_,
+      return compute_list_at_sat_<false>(state_handle_(),
                                          in, sat_quality_,
                                          out, err);
     }
@@ -716,20 +810,20 @@ namespace NEPTUNE_EOS
                                   EOS_Fields&      out,
                                   EOS_Error_Field& err) const
   {
-    assert(abstract_state_handle_ != -1);
+    assert(state_handle_() != -1);
 
     // CoolProp inputs are (P,T) and (H,P) !
     if ( (in1.get_property() == NEPTUNE::p && in2.get_property() == NEPTUNE::h)) {
-      return compute_list_from_pair_<true>(abstract_state_handle_, in2, in1, out, err);
+      return compute_list_from_pair_<true>(state_handle_(), in2, in1, out, err);
     }
     else if ((in2.get_property() == NEPTUNE::p && in1.get_property() == NEPTUNE::h)) {
-      return compute_list_from_pair_<true>(abstract_state_handle_, in1, in2, out, err);
+      return compute_list_from_pair_<true>(state_handle_(), in1, in2, out, err);
     }
     else if ((in1.get_property() == NEPTUNE::p && in2.get_property() == NEPTUNE::T)) {
-      return compute_list_from_pair_<false>(abstract_state_handle_, in1, in2, out, err);
+      return compute_list_from_pair_<false>(state_handle_(), in1, in2, out, err);
     }
     else if ((in2.get_property() == NEPTUNE::p && in1.get_property() == NEPTUNE::T)) {
-      return compute_list_from_pair_<false>(abstract_state_handle_, in2, in1, out, err);
+      return compute_list_from_pair_<false>(state_handle_(), in2, in1, out, err);
     }
     else {
       return EOS_Error::error;
@@ -749,6 +843,159 @@ namespace NEPTUNE_EOS
   }
   */
 
+  // ---------------------------------------------------------------------------
+  //! CoolProp key of the outputs computed by a plain update + keyed output
+  //! (same values as compute_*_ph / compute_*_pT), -1 for the others
+  // ---------------------------------------------------------------------------
+
+  static long
+  batch_key_(int property_number, bool from_ph)
+  {
+    switch (property_number)
+    {
+    case NEPTUNE::T:      return from_ph ? (long)CoolProp::iT : -1;
+    case NEPTUNE::h:      return from_ph ? -1 : (long)CoolProp::iHmass;
+    case NEPTUNE::rho:    return (long)CoolProp::iDmass;
+    case NEPTUNE::u:      return (long)CoolProp::iUmass;
+    case NEPTUNE::s:      return (long)CoolProp::iSmass;
+    case NEPTUNE::mu:     return (long)CoolProp::iviscosity;
+    case NEPTUNE::lambda: return (long)CoolProp::iconductivity;
+    case NEPTUNE::cp:     return (long)CoolProp::iCpmass;
+    case NEPTUNE::cv:     return (long)CoolProp::iCvmass;
+    case NEPTUNE::w:      return (long)CoolProp::ispeed_sound;
+    case NEPTUNE::pr:     return (long)CoolProp::iPrandtl;
+    default:              return -1;
+    }
+  }
+
+  // ---------------------------------------------------------------------------
+  //! Compute several outputs based on (p,h) or (p,T)
+  // ---------------------------------------------------------------------------
+
+  EOS_Error EOS_CoolProp::compute(const EOS_Field& in1,
+                                  const EOS_Field& in2,
+                                  EOS_Fields&      out,
+                                  EOS_Error_Field& err) const
+  {
+    const int prop1 = in1.get_property_number();
+    const int prop2 = in2.get_property_number();
+    const EOS_Field* in_p = 0;
+    const EOS_Field* in_x = 0;
+    if ((prop1 == NEPTUNE::p) && ((prop2 == NEPTUNE::h) || (prop2 == NEPTUNE::T))) {
+      in_p = &in1;
+      in_x = &in2;
+    }
+    else if ((prop2 == NEPTUNE::p) && ((prop1 == NEPTUNE::h) || (prop1 == NEPTUNE::T))) {
+      in_p = &in2;
+      in_x = &in1;
+    }
+    else
+      return EOS_Fluid::compute(in1, in2, out, err);
+
+    const bool from_ph = (in_x->get_property_number() == NEPTUNE::h);
+    const int  sz      = err.size();
+    const int  nb_out  = out.size();
+
+    // outputs with a CoolProp key are batched, the others go through EOS_Fluid
+    std::vector<int>  i_batch;
+    std::vector<long> keys;
+    std::vector<int>  i_rest;
+    for (int k = 0; k < nb_out; k++) {
+      long key = batch_key_(out[k].get_property_number(), from_ph);
+      if (key < 0)
+        i_rest.push_back(k);
+      else {
+        i_batch.push_back(k);
+        keys.push_back(key);
+      }
+    }
+
+    err = EOS_Internal_Error::OK;
+    if (i_rest.size() == 1)
+      EOS_Fluid::compute(in1, in2, out[i_rest[0]], err);
+    else if (i_rest.size() > 1) {
+      EOS_Fields rest((int)i_rest.size());
+      for (size_t k = 0; k < i_rest.size(); k++)
+        rest[(int)k] = out[i_rest[k]];
+      EOS_Fluid::compute(in1, in2, rest, err);
+    }
+
+    const long handle = state_handle_();
+    const long pair   = from_ph ? (long)CoolProp::HmassP_INPUTS : (long)CoolProp::PT_INPUTS;
+    double* val1 = (double*)(from_ph ? in_x : in_p)->get_data().get_ptr();
+    double* val2 = (double*)(from_ph ? in_p : in_x)->get_data().get_ptr();
+    std::vector<double> unused;
+
+    const int nb_batch = (int)keys.size();
+    for (int k = 0; k < nb_batch; k += 5) {
+      // groups of 5 outputs, the missing ones on a scratch array
+      const int nk = std::min(5, nb_batch - k);
+      long    outputs[5];
+      double* res[5];
+      for (int j = 0; j < 5; j++) {
+        if (j < nk) {
+          outputs[j] = keys[k+j];
+          res[j] = (double*)out[i_batch[k+j]].get_data().get_ptr();
+        }
+        else {
+          if (unused.empty())
+            unused.resize(sz);
+          outputs[j] = keys[k];
+          res[j] = &unused[0];
+        }
+      }
+
+      long errcode = 0;
+      char message_buffer[512];
+      AbstractState_update_and_5_out(handle, pair, val1, val2, sz, outputs,
+                                     res[0], res[1], res[2], res[3], res[4],
+                                     &errcode, message_buffer, 511);
+      if (errcode == 0)
+        continue;
+
+      // the batch stops on the first bad point : redone point by point
+      // so that only the bad points are flagged
+      for (int i = 0; i < sz; i++) {
+        errcode = 0;
+        AbstractState_update(handle, pair, val1[i], val2[i],
+                             &errcode, message_buffer, 511);
+        if (errcode != 0) {
+          print_error_message_(message_buffer);
+          for (int j = 0; j < nk; j++)
+            res[j][i] = -99999.;
+          err.set(i, worst_internal_error(err[i], COMPUTE_ERROR_));
+          continue;
+        }
+        for (int j = 0; j < nk; j++) {
+          res[j][i] = AbstractState_keyed_output(handle, outputs[j],
+                                                 &errcode, message_buffer, 511);
+          if (errcode != 0) {
+            print_error_message_(message_buffer);
+            err.set(i, worst_internal_error(err[i], COMPUTE_ERROR_));
+            errcode = 0;
+          }
+        }
+      }
+    }
+
+    return err.find_worst_error().generic_error();
+  }
+
+  // ---------------------------------------------------------------------------
+  //! Compute one output based on (p,h) or (p,T)
+  // ---------------------------------------------------------------------------
+
+  EOS_Error EOS_CoolProp::compute(const EOS_Field& in1,
+                                  const EOS_Field& in2,
+                                  EOS_Field&       out,
+                                  EOS_Error_Field& err) const
+  {
+    EOS_Fields fields(1);
+    fields[0] = out;
+    return compute(in1, in2, fields, err);
+  }
+
+
   // ---------------------------------------------------------------------------
   //! Dedicated functions for specific properties
   // ---------------------------------------------------------------------------
@@ -817,7 +1064,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    pr = _update_and_compute_from_pair(abstract_state_handle_,
+    pr = _update_and_compute_from_pair(state_handle_(),
                                        h, p,
                                        CoolProp::HmassP_INPUTS,
                                        CoolProp::iPrandtl,
@@ -835,7 +1082,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    pr = _update_and_compute_from_pair(abstract_state_handle_,
+    pr = _update_and_compute_from_pair(state_handle_(),
                                        p, T,
                                        CoolProp::PT_INPUTS,
                                        CoolProp::iPrandtl,
@@ -853,7 +1100,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    h = _update_and_compute_from_pair(abstract_state_handle_,
+    h = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iHmass,
@@ -871,7 +1118,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    T = _update_and_compute_from_pair(abstract_state_handle_,
+    T = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iT,
@@ -890,7 +1137,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    double cv = _update_and_compute_from_pair(abstract_state_handle_,
+    double cv = _update_and_compute_from_pair(state_handle_(),
                                               h, p,
                                               CoolProp::HmassP_INPUTS,
                                               CoolProp::iCvmass, err_);
@@ -898,7 +1145,7 @@ namespace NEPTUNE_EOS
     if (cv <= 0.e0 || err_ != 0) return COMPUTE_ERROR_;
 
     /* No need to reset h,p */
-    double cp = _compute_param(abstract_state_handle_,
+    double cp = _compute_param(state_handle_(),
                                CoolProp::iCpmass,
                                err_);
 
@@ -916,14 +1163,14 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    double cv = _update_and_compute_from_pair(abstract_state_handle_,
+    double cv = _update_and_compute_from_pair(state_handle_(),
                                               p, T,
                                               CoolProp::PT_INPUTS,
                                               CoolProp::iCvmass, err_);
 
     if (cv <= 0.e0 || err_ != 0) return COMPUTE_ERROR_;
 
-    double cp = _compute_param(abstract_state_handle_,
+    double cp = _compute_param(state_handle_(),
                                CoolProp::iCpmass,
                                err_);
 
@@ -941,7 +1188,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iDmass,
@@ -959,7 +1206,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iDmass,
@@ -977,7 +1224,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iUmass,
@@ -995,7 +1242,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iUmass,
@@ -1013,7 +1260,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iSmass,
@@ -1031,7 +1278,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iSmass,
@@ -1049,7 +1296,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iviscosity,
@@ -1067,7 +1314,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iviscosity,
@@ -1085,7 +1332,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iconductivity,
@@ -1103,7 +1350,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iconductivity,
@@ -1121,7 +1368,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iCpmass,
@@ -1139,7 +1386,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iCpmass,
@@ -1157,7 +1404,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iCvmass,
@@ -1175,7 +1422,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iCvmass,
@@ -1193,7 +1440,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::isurface_tension,
@@ -1211,7 +1458,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
     (void)h;//h not used
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, sat_quality_,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::isurface_tension,
@@ -1229,7 +1476,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::ispeed_sound,
@@ -1247,7 +1494,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::ispeed_sound,
@@ -1265,7 +1512,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iGmass,
@@ -1283,7 +1530,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iGmass,
@@ -1301,7 +1548,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iGmass,
@@ -1319,7 +1566,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iGmass,
@@ -1337,7 +1584,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, T,
                                       CoolProp::PT_INPUTS,
                                       CoolProp::iisobaric_expansion_coefficient,
@@ -1355,7 +1602,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       h, p,
                                       CoolProp::HmassP_INPUTS,
                                       CoolProp::iisobaric_expansion_coefficient,
@@ -1373,7 +1620,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, 0.,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iDmass,
@@ -1391,7 +1638,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       0., T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iDmass,
@@ -1409,7 +1656,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, 1.,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iDmass,
@@ -1427,7 +1674,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       1., T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iDmass,
@@ -1445,7 +1692,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, 0.,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iHmass,
@@ -1463,7 +1710,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       0., T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iHmass,
@@ -1481,7 +1728,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, 1.,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iHmass,
@@ -1499,7 +1746,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       1., T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iHmass,
@@ -1517,7 +1764,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, 0.,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iCpmass,
@@ -1535,7 +1782,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       0., T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iCpmass,
@@ -1553,7 +1800,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, 1.,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iCpmass,
@@ -1571,7 +1818,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       1., T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iCpmass,
@@ -1589,7 +1836,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       p, sat_quality_,
                                       CoolProp::PQ_INPUTS,
                                       CoolProp::iT,
@@ -1607,7 +1854,7 @@ namespace NEPTUNE_EOS
   {
     long err_ = 0;
 
-    r = _update_and_compute_from_pair(abstract_state_handle_,
+    r = _update_and_compute_from_pair(state_handle_(),
                                       sat_quality_, T,
                                       CoolProp::QT_INPUTS,
                                       CoolProp::iP,
@@ -1627,7 +1874,7 @@ namespace NEPTUNE_EOS
     char message_buffer[512];
 
     /* Trivial output, doesnt need a state set ! */
-    p_min = AbstractState_keyed_output(abstract_state_handle_,
+    p_min = AbstractState_keyed_output(state_handle_(),
                                        (long)CoolProp::iP_min,
                                        &errcode,
                                        message_buffer,
@@ -1652,7 +1899,7 @@ namespace NEPTUNE_EOS
     char message_buffer[512];
 
     /* Trivial output, doesnt need a state set ! */
-    p_max = AbstractState_keyed_output(abstract_state_handle_,
+    p_max = AbstractState_keyed_output(state_handle_(),
                                        (long)CoolProp::iP_max,
                                        &errcode,
                                        message_buffer,
@@ -1675,7 +1922,7 @@ namespace NEPTUNE_EOS
     char message_buffer[512];
 
     /* Trivial output, doesnt need a state set ! */
-    T_min = AbstractState_keyed_output(abstract_state_handle_,
+    T_min = AbstractState_keyed_output(state_handle_(),
                                        (long)CoolProp::iT_min,
                                        &errcode,
                                        message_buffer,
@@ -1698,7 +1945,7 @@ namespace NEPTUNE_EOS
     char message_buffer[512];
 
     /* Trivial output, doesnt need a state set ! */
-    T_max = AbstractState_keyed_output(abstract_state_handle_,
+    T_max = AbstractState_keyed_output(state_handle_(),
                                        (long)CoolProp::iT_max,
                                        &errcode,
                                        message_buffer,
@@ -1781,7 +2028,7 @@ namespace NEPTUNE_EOS
     char message_buffer[512];
 
     /* Trivial output, doesnt need a state set ! */
-    p_crit = AbstractState_keyed_output(abstract_state_handle_,
+    p_crit = AbstractState_keyed_output(state_handle_(),
                                        (long)CoolProp::iP_critical,
                                        &errcode,
                                        message_buffer,
@@ -1804,7 +2051,7 @@ namespace NEPTUNE_EOS
     char message_buffer[512];
 
     /* Trivial output, doesnt need a state set ! */
-    T_crit = AbstractState_keyed_output(abstract_state_handle_,
+    T_crit = AbstractState_keyed_output(state_handle_(),
                                        (long)CoolProp::iT_critical,
                                        &errcode,
                                        message_buffer,
@@ -1864,18 +2111,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -1899,18 +2146,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -1933,18 +2180,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iDmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -1966,18 +2213,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iDmass,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -1999,18 +2246,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iUmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -2032,18 +2279,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iUmass,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -2065,18 +2312,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iSmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -2098,18 +2345,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iSmass,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -2131,18 +2378,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iviscosity,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -2164,18 +2411,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iviscosity,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -2197,18 +2444,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iconductivity,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -2230,18 +2477,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iviscosity,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -2263,18 +2510,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCpmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -2296,18 +2543,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCpmass,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -2329,18 +2576,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCvmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iHmass,
@@ -2362,18 +2609,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::HmassP_INPUTS,
                          h, p,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCvmass,
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
@@ -2400,18 +2647,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2435,18 +2682,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iHmass,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2471,18 +2718,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iDmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2504,18 +2751,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iDmass,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2537,18 +2784,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iUmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2570,18 +2817,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iUmass,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2603,18 +2850,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iSmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2636,18 +2883,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iSmass,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2669,18 +2916,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iviscosity,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2702,18 +2949,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iviscosity,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2735,18 +2982,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iconductivity,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2768,18 +3015,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iviscosity,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2801,18 +3048,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCpmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2834,18 +3081,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCpmass,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
@@ -2867,18 +3114,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCvmass,
                                              (long)CoolProp::iP,
                                              (long)CoolProp::iT,
@@ -2900,18 +3147,18 @@ namespace NEPTUNE_EOS
     long errcode = 0;
     char message_buffer[512];
 
-    AbstractState_update(abstract_state_handle_,
+    AbstractState_update(state_handle_(),
                          (long)CoolProp::PT_INPUTS,
                          p, T,
                          &errcode, message_buffer, 511);
 
-    AbstractState_specify_phase(abstract_state_handle_,
+    AbstractState_specify_phase(state_handle_(),
                                 handle_phase_.aschar(),
                                 &errcode,
                                 message_buffer,
                                 511);
 
-    r = AbstractState_first_partial_deriv(abstract_state_handle_,
+    r = AbstractState_first_partial_deriv(state_handle_(),
                                              (long)CoolProp::iCvmass,
                                              (long)CoolProp::iT,
                                              (long)CoolProp::iP,
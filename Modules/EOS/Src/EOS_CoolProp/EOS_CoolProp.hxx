@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cmath>
 #include <sstream>
+#include <vector>
 using std::istringstream ;
 using std::ostringstream ;
 
@@ -67,6 +68,8 @@ namespace NEPTUNE_EOS
     //
     const AString& fluid_name() const;
     const AString& equation_name() const;
+    bool is_thread_safe() const;
+    bool fuses_fields() const;
 
     //! initializers
     int init(const Strings&);
@@ -111,6 +114,17 @@ namespace NEPTUNE_EOS
      */
 //    EOS_Error compute(const EOS_Field& in1, const EOS_Field& in2, EOS_Field& out, EOS_Error_Field& err) const;
 
+    using EOS_Fluid::compute;
+
+    //! Compute calculations from fields, inputs (p,h) or (p,T)
+    /*!
+     * Outputs given by a plain CoolProp keyed output are computed by
+     * batches of 5 with AbstractState_update_and_5_out over the whole
+     * arrays, the others through EOS_Fluid.
+     */
+    EOS_Error compute(const EOS_Field& in1, const EOS_Field& in2, EOS_Fields& out, EOS_Error_Field& err) const;
+    EOS_Error compute(const EOS_Field& in1, const EOS_Field& in2, EOS_Field& out, EOS_Error_Field& err) const;
+
     //! Global methods
     EOS_Error compute_Ph(const char* const property_name, double in1, double in2, double& out) const ;
     EOS_Error compute_PT(const char* const property_name, double in1, double in2, double& out) const ;
@@ -280,8 +294,22 @@ namespace NEPTUNE_EOS
 
 
   protected:
-    //! Abstract handle for low-level Coolprop API
+    //! Abstract handle for low-level Coolprop API (first thread)
     long abstract_state_handle_;
+    //! Handle of the calling thread, same backend/fluid/phase
+    /*!
+     * Found without lock in a thread_local table keyed by serial_ ;
+     * created (under a lock) on first use by its thread.
+     */
+    long state_handle_() const;
+    //! new handle with the backend, fluid and phase of this object
+    long new_state_handle_() const;
+    //! create the handle of the calling thread and record it
+    long add_state_handle_() const;
+    //! key of this object in the thread handle tables
+    long serial_;
+    //! All the handles of this object, freed by the destructor
+    mutable std::vector<long> state_handles_;
 
     double sat_quality_;
     //! Handle phase id : phase_unkown, phase_gas or phase_liquid
@@ -58,6 +58,27 @@ namespace NEPTUNE
   {
   }
 
+  EOS_Error_Field::EOS_Error_Field(EOS_Error_Field &&f):
+     UObject(), data(std::move(f.data)),
+     library_codes(std::move(f.library_codes)),
+     name(f.name)
+  {
+  }
+
+  EOS_Error_Field& EOS_Error_Field::operator= (const EOS_Error_Field &f)
+  { data = f.data ;
+    library_codes = f.library_codes ;
+    name = f.name ;
+    return *this ;
+  }
+
+  EOS_Error_Field& EOS_Error_Field::operator= (EOS_Error_Field &&f)
+  { data = std::move(f.data) ;
+    library_codes = std::move(f.library_codes) ;
+    name = f.name ;
+    return *this ;
+  }
+
   EOS_Error_Field::EOS_Error_Field(ArrOfInt &a):
     data(a.size(), &a[0]),
     library_codes(a.size()),
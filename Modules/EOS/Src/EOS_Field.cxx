@@ -74,6 +74,23 @@ namespace NEPTUNE
   {
   }
 
+  EOS_Field::EOS_Field(EOS_Field &&f):
+  UObject(),
+  data(std::move(f.data)),
+  property_title(f.property_title), 
+  property_name(f.property_name),
+  property_number(f.property_number)
+  {
+  }
+
+  EOS_Field& EOS_Field::operator = (EOS_Field &&f)
+  { data.swap(f.data) ;
+    property_title   = f.property_title  ;
+    property_name    = f.property_name   ;
+    property_number  = f.property_number ;
+    return *this ;
+  }
+
   EOS_Field& EOS_Field::operator = (const EOS_Field &f)
   { data.attach(f.get_data()) ;
     property_title   = f.property_title  ;
@@ -88,7 +105,7 @@ namespace NEPTUNE
   { property_title  = namet ;
     property_name   = namep ;
     property_number = gen_property_number(namep)   ;
-    data            = ArrOfDouble(x.size(), &x[0]) ;
+    data.copy(ArrOfDouble(x.size(), &x[0])) ;
     return good ;
   }
   int EOS_Field::init(const char* const namet, 
@@ -98,7 +115,7 @@ namespace NEPTUNE
   { property_title  = namet ;
     property_name   = namep ;
     property_number = prop_numb  ;
-    data            = ArrOfDouble(x.size(), &x[0]) ;
+    data.copy(ArrOfDouble(x.size(), &x[0])) ;
     return good ;
   }
 
@@ -109,20 +126,20 @@ namespace NEPTUNE
   { property_title  = namet ;
     property_name   = namep ;
     property_number = prop_numb  ;
-    data            = ArrOfDouble(nsz, ptr) ;
+    data.copy(ArrOfDouble(nsz, ptr)) ;
     return good ;
   }
 
 
   int EOS_Field::reset_data_ptr(ArrOfDouble &x)
   {
-    data = ArrOfDouble(x.size(), &x[0]);
+    data.copy(ArrOfDouble(x.size(), &x[0]));
     return good;
   }
 
   int EOS_Field::reset_data_ptr(int nsz, double* ptr)
   {
-    data = ArrOfDouble(nsz, ptr) ;
+    data.copy(ArrOfDouble(nsz, ptr)) ;
     return good;
   }
 
@@ -142,7 +159,7 @@ namespace NEPTUNE
   { property_title  = namet ;
     property_name   = namep ;
     property_number = gen_property_number(namep)   ;
-    data            = ArrOfDouble(nsz, ptr) ;
+    data.copy(ArrOfDouble(nsz, ptr)) ;
     return good ;
   }
 
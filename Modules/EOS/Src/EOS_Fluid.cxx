@@ -18,17 +18,18 @@
 //
 #include "EOS/API/EOS_Fluid.hxx"
 #include "EOS/API/EOS_Field.hxx"
+#include "EOS/API/EOS_FieldView.hxx"
 #include "EOS/API/EOS_Error_Field.hxx"
 #include "EOS/API/EOS_Fields.hxx"
+#include <algorithm>
 
 // for fluid_name, table_name, version_name
 static NEPTUNE::AString UNKNOWN("Unknown") ;
 // for numerical derivation
 static double epsilon = 1.e-6 ;
 // for Newton
-static  int nb_iter_max = 50 ;
-static  int iter_Newton;
-static  double epsn = 1.e-8 ;
+static  const int nb_iter_max = 50 ;
+static  const double epsn = 1.e-8 ;
 
 namespace NEPTUNE
 {
@@ -59,6 +60,37 @@ namespace NEPTUNE
        description = "EOS_Fluid unknown error code" ;
   }
 
+  // Derivatives r(p,h) obtained as r(p,T(p,h)) : method r(p,T), or 0
+  typedef EOS_Internal_Error (EOS_Fluid::*EOS_Fluid_pT_method)(double, double, double&) const ;
+  static EOS_Fluid_pT_method T_derivative(int property_number)
+  { switch(property_number)
+       { case NEPTUNE::d_rho_d_T_p    : return &EOS_Fluid::compute_d_rho_d_T_p_pT    ;
+         case NEPTUNE::d_rho_d_p_T    : return &EOS_Fluid::compute_d_rho_d_p_T_pT    ;
+         case NEPTUNE::d_u_d_T_p      : return &EOS_Fluid::compute_d_u_d_T_p_pT      ;
+         case NEPTUNE::d_s_d_T_p      : return &EOS_Fluid::compute_d_s_d_T_p_pT      ;
+         case NEPTUNE::d_s_d_p_T      : return &EOS_Fluid::compute_d_s_d_p_T_pT      ;
+         case NEPTUNE::d_mu_d_T_p     : return &EOS_Fluid::compute_d_mu_d_T_p_pT     ;
+         case NEPTUNE::d_mu_d_p_T     : return &EOS_Fluid::compute_d_mu_d_p_T_pT     ;
+         case NEPTUNE::d_lambda_d_p_T : return &EOS_Fluid::compute_d_lambda_d_p_T_pT ;
+         case NEPTUNE::d_lambda_d_T_p : return &EOS_Fluid::compute_d_lambda_d_T_p_pT ;
+         case NEPTUNE::d_cp_d_T_p     : return &EOS_Fluid::compute_d_cp_d_T_p_pT     ;
+         case NEPTUNE::d_cp_d_p_T     : return &EOS_Fluid::compute_d_cp_d_p_T_pT     ;
+         case NEPTUNE::d_cv_d_T_p     : return &EOS_Fluid::compute_d_cv_d_T_p_pT     ;
+         case NEPTUNE::d_cv_d_p_T     : return &EOS_Fluid::compute_d_cv_d_p_T_pT     ;
+         case NEPTUNE::d_sigma_d_T_p  : return &EOS_Fluid::compute_d_sigma_d_T_p_pT  ;
+         case NEPTUNE::d_w_d_T_p      : return &EOS_Fluid::compute_d_w_d_T_p_pT      ;
+         case NEPTUNE::d_w_d_p_T      : return &EOS_Fluid::compute_d_w_d_p_T_pT      ;
+         case NEPTUNE::d_g_d_T_p      : return &EOS_Fluid::compute_d_g_d_T_p_pT      ;
+         case NEPTUNE::d_f_d_T_p      : return &EOS_Fluid::compute_d_f_d_T_p_pT      ;
+         case NEPTUNE::d_pr_d_T_p     : return &EOS_Fluid::compute_d_pr_d_T_p_pT     ;
+         case NEPTUNE::d_beta_d_T_p   : return &EOS_Fluid::compute_d_beta_d_T_p_pT   ;
+         case NEPTUNE::d_gamma_d_T_p  : return &EOS_Fluid::compute_d_gamma_d_T_p_pT  ;
+         case NEPTUNE::d_h_d_T_p      : return &EOS_Fluid::compute_d_h_d_T_p_pT      ;
+         case NEPTUNE::d_h_d_p_T      : return &EOS_Fluid::compute_d_h_d_p_T_pT      ;
+         default                      : return 0 ;
+       }
+  }
+
   int EOS_Fluid::type_Id=(RegisterType("EOS_Fluid", "UObject",
                           "Equation Of States",
                           sizeof(EOS_Fluid),
@@ -239,6 +271,14 @@ namespace NEPTUNE
                                EOS_Error_Field& errfield) const
   { const int nb_fields = r.size() ;
     const int sz        = errfield.size() ;
+
+    const int prop_p = p.get_property_number() ;
+    const int prop_h = h.get_property_number() ;
+    const bool in_ph = (prop_p == NEPTUNE::p) && ((prop_h == NEPTUNE::h) || (prop_h == NEPTUNE::T)) ;
+    const bool in_hp = (prop_h == NEPTUNE::p) && ((prop_p == NEPTUNE::h) || (prop_p == NEPTUNE::T)) ;
+    if ((nb_fields > 1) && (in_ph || in_hp) && fuses_fields())
+       return compute_fused(in_ph ? p : h, in_ph ? h : p, r, errfield) ;
+
     errfield = EOS_Internal_Error::OK ;
     EOS_Error err = EOS_Error::good  ;
     ArrOfInt err_data(sz) ;
@@ -252,6 +292,77 @@ namespace NEPTUNE
     return err ;
   }
 
+  // Fused evaluation of several fields r(p,h) or r(p,T) :
+  // the intermediates shared by the outputs are computed once per point,
+  // h(p,T) and T(p,h) for the derivatives at constant p or T ; every other
+  // output goes through the single-field compute and compute_X_ph, so the
+  // per-point overrides (compute_pr_ph, ...) are kept.
+  // Same values and errors as one compute(p, x, r[i]) per output, as long
+  // as the single-field compute is not overridden (see fuses_fields).
+  EOS_Error EOS_Fluid::compute_fused(const EOS_Field& p,
+                                     const EOS_Field& x,
+                                     EOS_Fields& r,
+                                     EOS_Error_Field& errfield) const
+  { const int nb_fields = r.size() ;
+    const int sz        = errfield.size() ;
+    errfield = EOS_Internal_Error::OK ;
+
+    ArrOfInt err_data(sz) ;
+    EOS_Error_Field err_field2(err_data) ;
+
+    // plan : derivatives needing T(p,h)
+    bool need_T = false ;
+    for (int k=0; k<nb_fields; k++)
+       if (T_derivative(r[k].get_property_number()))  need_T = true ;
+
+    const EOS_FieldView pp(p) ;
+    EOS_FieldView hh ;
+    EOS_FieldView tt ;
+    ArrOfDouble hh_data ;
+    ArrOfDouble tt_data ;
+    const bool in_T = (x.get_property_number() == NEPTUNE::T) ;
+    if (in_T)
+       { // h(p,T) once for all the outputs
+         hh_data.resize(sz) ;
+         hh = EOS_FieldView(NEPTUNE::h, sz, (double*) hh_data.get_ptr()) ;
+         const EOS_FieldView xt(x) ;
+         for (int i=0; i<sz; i++)
+            errfield.set(i, compute_h_pT(pp[i], xt[i], hh[i])) ;
+       }
+    else
+       hh = EOS_FieldView(x) ;
+
+    if (need_T)
+       { // T(p,h) once for all the derivatives r(p,T(p,h))
+         tt_data.resize(sz) ;
+         tt = EOS_FieldView(NEPTUNE::T, sz, (double*) tt_data.get_ptr()) ;
+         for (int i=0; i<sz; i++)
+            { EOS_Internal_Error err = compute_T_ph(pp[i], hh[i], tt[i]) ;
+              errfield.set(i, worst_internal_error(errfield[i], err)) ;
+            }
+       }
+
+    for (int k=0; k<nb_fields; k++)
+       { EOS_FieldView rr(r[k]) ;
+         const int prop_r = r[k].get_property_number() ;
+         EOS_Fluid_pT_method fT = T_derivative(prop_r) ;
+
+         if (in_T && (prop_r == NEPTUNE::h))
+            { for (int i=0; i<sz; i++)  rr[i] = hh[i] ;
+              continue ;
+            }
+         else if (fT)
+            { for (int i=0; i<sz; i++)
+                 err_field2.set(i, (this->*fT)(pp[i], tt[i], rr[i])) ;
+            }
+         else
+            compute(pp, hh, rr, err_field2) ;
+         errfield.set_worst_error(err_field2) ;
+       }
+
+    return errfield.find_worst_error().generic_error() ;
+  }
+
 //
   EOS_Error EOS_Fluid::compute(const EOS_Field& p,
                                EOS_Fields& r,
@@ -294,6 +405,15 @@ namespace NEPTUNE
   EOS_Error EOS_Fluid::compute(const EOS_Field& p,
                                EOS_Field& r,
                                EOS_Error_Field& errfield) const
+  { const EOS_FieldView vp(p) ;
+    EOS_FieldView vr(r) ;
+    return compute(vp, vr, errfield) ;
+  }
+
+//
+  EOS_Error EOS_Fluid::compute(const EOS_FieldView& p,
+                               EOS_FieldView& r,
+                               EOS_Error_Field& errfield) const
   { const int sz = p.size() ;
 
     assert(r.size() == sz) ;
@@ -403,6 +523,17 @@ namespace NEPTUNE
                                const EOS_Field& h,
                                EOS_Field& r,
                                EOS_Error_Field& errfield) const
+  { const EOS_FieldView vp(p) ;
+    const EOS_FieldView vh(h) ;
+    EOS_FieldView vr(r) ;
+    return compute(vp, vh, vr, errfield) ;
+  }
+
+//
+  EOS_Error EOS_Fluid::compute(const EOS_FieldView& p,
+                               const EOS_FieldView& h,
+                               EOS_FieldView& r,
+                               EOS_Error_Field& errfield) const
   { const int sz = p.size() ;
 
     assert(h.size() == sz) ;
@@ -410,14 +541,13 @@ namespace NEPTUNE
     assert(errfield.size() == sz) ;
 
     errfield = EOS_Internal_Error::OK ;
-    ArrOfDouble pp_data(sz) ;
-    ArrOfDouble hh_data(sz) ;
-    ArrOfDouble tt_data(sz) ;
-    ArrOfDouble ss_data(sz) ;
-    EOS_Field pp("pp","p",NEPTUNE::p,pp_data) ;
-    EOS_Field hh("hh","h",NEPTUNE::h,hh_data) ;
-    EOS_Field tt("tt","T",NEPTUNE::T,tt_data) ;
-    EOS_Field ss("ss","s",NEPTUNE::s,ss_data) ;
+    // scratch storage only for h(p,T) and T(p,h), allocated when needed
+    ArrOfDouble hh_data ;
+    ArrOfDouble tt_data ;
+    EOS_FieldView pp ;
+    EOS_FieldView hh ;
+    EOS_FieldView tt ;
+    EOS_FieldView ss ;
     int lp = 0 ;
     int lh = 0 ;
     int lt = 0 ;
@@ -464,7 +594,11 @@ namespace NEPTUNE
        }
 
     if ( (lp == 1) && (lt == 1) )
-       { for (int i=0; i<sz; i++)
+       { if (lh == 0)
+            { hh_data.resize(sz) ;
+              hh = EOS_FieldView(NEPTUNE::h,sz,(double*) hh_data.get_ptr()) ;
+            }
+         for (int i=0; i<sz; i++)
             errfield.set(i, compute_h_pT(pp[i], tt[i], hh[i])) ;
          lh = 1 ;
        }
@@ -503,7 +637,10 @@ namespace NEPTUNE
        }
 
     if ( (lp == 1) && (lh == 1) )
-       {
+       { if ( (lt == 0) && T_derivative(r.get_property_number()) )
+            { tt_data.resize(sz) ;
+              tt = EOS_FieldView(NEPTUNE::T,sz,(double*) tt_data.get_ptr()) ;
+            }
          switch(r.get_property_number())
             { case NEPTUNE::h :
                  if (lt == 1)
@@ -1461,15 +1598,36 @@ EOS_Internal_Error EOS_Fluid::compute([[maybe_unused]] const char* const propert
   // Default implementation for p_sat(T)
   // Newton iteration to solve for P such that T_sat(P) = T
   EOS_Internal_Error EOS_Fluid::compute_p_sat_T(double T, double& p) const
+  { int nb_iter ;
+    return newton_p_sat_T(T, p, -1.e0, nb_iter) ;
+  }
+
+  // Newton iteration on T_sat(P) = T, per-call state only (reentrant)
+  EOS_Internal_Error EOS_Fluid::newton_p_sat_T(double T, double& p, double p_start, int& nb_iter) const
   { EOS_Internal_Error err1(EOS_Internal_Error::OK) ;
     EOS_Internal_Error err2(EOS_Internal_Error::OK) ;
 
     double Ti, dTi, deltap ;
     double func = 1.e0 ;
     double pi   = 1.e5 ; // Starting from 1 bar.
-    for (iter_Newton = 0 ;
-        (iter_Newton < nb_iter_max) && (fabs(func) > epsn);
-        iter_Newton++ )
+    if (p_start > 0.e0)
+       pi = p_start ;
+    else if (!guess_T.empty() && (T >= guess_T.front()) && (T <= guess_T.back()))
+       { // cubic Hermite interpolation of ln p(T) between the sampled nodes
+         int k = (int)(std::upper_bound(guess_T.begin(), guess_T.end(), T) - guess_T.begin()) - 1 ;
+         k = std::min(k, (int)guess_T.size() - 2) ;
+         double dT  = guess_T[k+1] - guess_T[k] ;
+         double t   = (T - guess_T[k]) / dT ;
+         double t2  = t*t ;
+         double lnp =   (2.e0*t2*t - 3.e0*t2 + 1.e0) * guess_lnp[k]
+                      + (t2*t - 2.e0*t2 + t)         * dT * guess_dlnp[k]
+                      + (-2.e0*t2*t + 3.e0*t2)       * guess_lnp[k+1]
+                      + (t2*t - t2)                  * dT * guess_dlnp[k+1] ;
+         pi = exp(lnp) ;
+       }
+    for (nb_iter = 0 ;
+        (nb_iter < nb_iter_max) && (fabs(func) > epsn);
+        nb_iter++ )
       { err1   = compute_T_sat_p(pi,Ti) ;
         err2   = compute_d_T_sat_d_p_p(pi, dTi) ;
         func   = T - Ti      ;
@@ -1483,13 +1641,50 @@ EOS_Internal_Error EOS_Fluid::compute([[maybe_unused]] const char* const propert
         }
       }
     // If not converged, error.
-    if ( (iter_Newton >= nb_iter_max) && (fabs(func) > epsn) )  return Error_p_sat_T_newton ;
+    if ( (nb_iter >= nb_iter_max) && (fabs(func) > epsn) )  return Error_p_sat_T_newton ;
 
     p = pi ;
     // Result is based on the last compute_T_sat_p, so return the same error code:
     return err1 ;
   }
 
+  // Samples T_sat(p) on n points (geometric in p) and keeps, for the guess
+  // of newton_p_sat_T, ln p and d ln p / dT = 1 / (p dT_sat/dp) at the nodes.
+  // Points where T_sat(p) fails or is not increasing are skipped.
+  EOS_Internal_Error EOS_Fluid::init_p_sat_T_guess(double pmin, double pmax, int n)
+  { guess_T.clear()    ;
+    guess_lnp.clear()  ;
+    guess_dlnp.clear() ;
+    if ( (pmin <= 0.e0) || (pmax <= pmin) || (n < 2) )  return EOS_Internal_Error::DATA_NUMBER ;
+
+    EOS_Internal_Error ierr(EOS_Internal_Error::OK) ;
+    const double lmin = log(pmin) ;
+    const double dl   = (log(pmax) - lmin) / (n - 1) ;
+    for (int k=0; k<n; k++)
+       { double pk = exp(lmin + k*dl) ;
+         double Tk, dTk ;
+         EOS_Internal_Error err1 = compute_T_sat_p(pk, Tk) ;
+         EOS_Internal_Error err2 = compute_d_T_sat_d_p_p(pk, dTk) ;
+         EOS_Internal_Error err  = worst_internal_error(err1, err2) ;
+         if (err.generic_error() >= EOS_Error::bad)
+            { ierr = err ;
+              continue ;
+            }
+         if ( (dTk <= 0.e0) || (!guess_T.empty() && (Tk <= guess_T.back())) )  continue ;
+         guess_T.push_back(Tk) ;
+         guess_lnp.push_back(log(pk)) ;
+         guess_dlnp.push_back(1.e0 / (pk*dTk)) ;
+       }
+
+    if (guess_T.size() < 2)
+       { guess_T.clear()    ;
+         guess_lnp.clear()  ;
+         guess_dlnp.clear() ;
+         return (ierr == EOS_Internal_Error::OK) ? EOS_Internal_Error(EOS_Internal_Error::EOS_BAD_COMPUTE) : ierr ;
+       }
+    return EOS_Internal_Error::OK ;
+  }
+
 
   // - --- Auto --- -
 
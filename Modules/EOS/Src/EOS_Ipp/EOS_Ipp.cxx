@@ -26,9 +26,11 @@
 #include "EOS/API/EOS_Config.hxx"
 #include <fstream>
 #include <iostream> // pour std::cerr
-#include <set>
 #include <string>
 #include <vector>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #define DBL_EPSILON 1e-9
 
 namespace NEPTUNE_EOS
@@ -81,7 +83,14 @@ namespace NEPTUNE_EOS
                        connect_lim(0),
                        n_p_ph(0),
                        n_h_ph(0),
-                       n_p_satlim(0)
+                       n_p_satlim(0),
+                       nb_fallback_calls(0),
+                       nb_fallback_points(0),
+                       nb_fallback_failed(0),
+                       nb_fallback_no_model(0),
+                       quad_depth_ph(0),
+                       bin_addr(nullptr),
+                       bin_size(0)
 
   {
   }
@@ -92,6 +101,7 @@ namespace NEPTUNE_EOS
     {
       delete obj_fluid;
     }
+    release_bin();
   }
 
   static RegisteredClass &EOS_Ipp_create()
@@ -153,6 +163,10 @@ namespace NEPTUNE_EOS
       reference = "";
     }
 
+    // binary table : mapped, no MED reading nor pretraitements
+    if (is_bin(med_file.aschar()))
+      return load_bin(med_file.aschar());
+
     // load med file
     EOS_Med med(med_file);
     errM = med.read_File();
@@ -201,6 +215,8 @@ namespace NEPTUNE_EOS
       return errM;
     }
 
+    init_prop_ph_slots();
+
     // pretraitements (2D)
     if (index_conn_ph.size() != 0)
       f_mesh2r_mesh();
@@ -249,6 +265,10 @@ namespace NEPTUNE_EOS
     method = strtok(file_name.aschar(), ".");
     reference = strtok(NULL, ".");
 
+    // binary table : all the properties are mapped, only the pages used are read
+    if (is_bin(med_file.aschar()))
+      return load_bin(med_file.aschar());
+
     // load med file
     EOS_Med med(med_file);
     errM = med.read_File();
@@ -282,6 +302,8 @@ namespace NEPTUNE_EOS
     load_med_scalar(med);
     med.close_File();
 
+    init_prop_ph_slots();
+
     // pretraitements (2D)
     if (index_conn_ph.size() != 0)
       f_mesh2r_mesh();
@@ -451,21 +473,224 @@ namespace NEPTUNE_EOS
                              EOS_Fields &r,
                              EOS_Error_Field &errfield) const
   {
-    EOS_Error err = EOS_Fluid::compute(pp, hh, r, errfield);
+    EOS_Error err;
+    if (pp.get_property_number() == NEPTUNE::p && hh.get_property_number() == NEPTUNE::h)
+      err = compute_ph_fields(pp, hh, r, errfield);
+    else
+      err = EOS_Fluid::compute(pp, hh, r, errfield);
     if ((err != EOS_Error::good)) // if the calculation by ipp did not pass
+      err = compute_fallback(pp, &hh, r, errfield);
+    return err;
+  }
+
+  // seuls les points en erreur sont regroupes dans des champs compacts, calcules par
+  // le fluide de reference puis recopies a leur place
+  EOS_Error EOS_Ipp::compute_fallback(const EOS_Field &in1, const EOS_Field *in2, EOS_Fields &r,
+                                      EOS_Error_Field &errfield) const
+  {
+    const int sz = errfield.size();
+    std::vector<int> idx;
+    for (int i = 0; i < sz; i++)
+      if (errfield[i].generic_error() != EOS_Error::good)
+        idx.push_back(i);
+    const int nf = idx.size();
+    if (nf == 0)
+      return EOS_Error::good;
+
+    if (obj_fluid == nullptr)
+    {
+      long nb_prev;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+      nb_prev = nb_fallback_no_model++;
+      if (nb_prev == 0)
+        std::cerr << "Error: The interpolator fluid is not initialized. To continue the calculation, call the function init_model(). " << std::endl;
+      return errfield.find_worst_error().generic_error();
+    }
+
+    const int nb_fields = r.size();
+    ArrOfDouble v1(nf), v2(nf);
+    std::vector<ArrOfDouble> vr(nb_fields, ArrOfDouble(nf));
+    for (int k = 0; k < nf; k++)
+      v1[k] = in1[idx[k]];
+    EOS_Field f1(in1.get_property_title().aschar(), in1.get_property_name().aschar(), in1.get_property_number(), v1);
+    EOS_Field f2;
+    if (in2 != nullptr)
+    {
+      for (int k = 0; k < nf; k++)
+        v2[k] = (*in2)[idx[k]];
+      f2 = EOS_Field(in2->get_property_title().aschar(), in2->get_property_name().aschar(), in2->get_property_number(), v2);
+    }
+    EOS_Fields fr(nb_fields);
+    for (int j = 0; j < nb_fields; j++)
+      fr[j] = EOS_Field(r[j].get_property_title().aschar(), r[j].get_property_name().aschar(), r[j].get_property_number(), vr[j]);
+    ArrOfInt ierr(nf);
+    EOS_Error_Field ferr(ierr);
+
+    if (in2 != nullptr)
+      obj_fluid->compute(f1, f2, fr, ferr);
+    else
+      obj_fluid->compute(f1, fr, ferr);
+
+    long nb_failed = 0;
+    for (int k = 0; k < nf; k++)
     {
-        std::cout << "Error detected : " << err << " ;";
-        std::cout << "for the pair (" << pp.get_data()[0] << "," << hh.get_data()[0] << ") " << std::endl;
-        //r.print_On(std::cout);
-      if (obj_fluid == nullptr)
+      for (int j = 0; j < nb_fields; j++)
+        r[j][idx[k]] = vr[j][k];
+      errfield.set(idx[k], ferr[k]);
+      if (ferr[k].generic_error() != EOS_Error::good)
+        nb_failed++;
+    }
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    nb_fallback_calls++;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    nb_fallback_points += nf;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+    nb_fallback_failed += nb_failed;
+    return errfield.find_worst_error().generic_error();
+  }
+
+  void EOS_Ipp::get_fallback_counts(long &nb_calls, long &nb_points, long &nb_failed, long &nb_no_model) const
+  {
+    nb_calls = nb_fallback_calls;
+    nb_points = nb_fallback_points;
+    nb_failed = nb_fallback_failed;
+    nb_no_model = nb_fallback_no_model;
+  }
+
+  void EOS_Ipp::reset_fallback_counts()
+  {
+    nb_fallback_calls = 0;
+    nb_fallback_points = 0;
+    nb_fallback_failed = 0;
+    nb_fallback_no_model = 0;
+  }
+
+  // derivees calculees par le fluide de reference si swch_calc_deriv_fld_ (cf. EOS_Ipp_i.hxx)
+  static bool is_fluid_deriv(int prop)
+  {
+    return prop == NEPTUNE::d_mu_d_p_h || prop == NEPTUNE::d_mu_d_h_p || prop == NEPTUNE::d_lambda_d_p_h || prop == NEPTUNE::d_lambda_d_h_p || prop == NEPTUNE::d_cp_d_p_h || prop == NEPTUNE::d_cp_d_h_p || prop == NEPTUNE::d_beta_d_p_h;
+  }
+
+  // calcul par blocs de points de tous les champs r(p,h) tabules dans le plan ph :
+  // la recherche de maille et les poids bilineaires sont calcules une seule fois par point
+  // puis partages entre les proprietes ; les autres champs passent par EOS_Fluid::compute
+  EOS_Error EOS_Ipp::compute_ph_fields(const EOS_Field &p,
+                                       const EOS_Field &h,
+                                       EOS_Fields &r,
+                                       EOS_Error_Field &errfield) const
+  {
+    const int nb_fields = r.size();
+    const int sz = errfield.size();
+    assert(p.size() == sz);
+    assert(h.size() == sz);
+    errfield = EOS_Internal_Error::OK;
+    EOS_Error err = EOS_Error::good;
+
+    // champs hors table : chemin generique point par point
+    std::vector<int> slots(nb_fields, -1);
+    int nb_ipp = 0;
+    ArrOfInt err_data(sz);
+    EOS_Error_Field err_field2(err_data);
+    for (int j = 0; j < nb_fields; j++)
+    {
+      int prop = r[j].get_property_number();
+      if (!(swch_calc_deriv_fld_ && is_fluid_deriv(prop)))
+        slots[j] = get_prop_ph_slot((EOS_thermprop)prop);
+      if (slots[j] >= 0)
       {
-        std::cerr << "Error: The interpolator fluid is not initialized. To continue the calculation, call the function init_model(). " << std::endl;
-        return err;
+        nb_ipp++;
+        continue;
       }
-      err = obj_fluid->compute(pp, hh, r, errfield);
+      EOS_Error err2 = EOS_Fluid::compute(p, h, r[j], err_field2);
+      err = worst_generic_error(err, err2);
+      errfield.set_worst_error(err_field2);
     }
-    // errfield = EOS_Internal_Error::OK; 
-    return err;
+    if (nb_ipp == 0 || sz == 0)
+      return err;
+
+    const double *pv = p.get_data().get_ptr();
+    const double *hv = h.get_data().get_ptr();
+    const double *np = nodes_ph[0].get_data().get_ptr();
+    const double *nh = nodes_ph[1].get_data().get_ptr();
+    const int *corn = corners.get_ptr();
+
+    const int blk = 256;
+    int cell[blk], c0[blk], c1[blk], c2[blk], c3[blk];
+    double w1[blk], w2[blk], w3[blk], w4[blk];
+    double pk[blk], hk[blk];
+    bool out[blk];
+
+    for (int i0 = 0; i0 < sz; i0 += blk)
+    {
+      const int n = (sz - i0 < blk) ? sz - i0 : blk;
+
+      // localisation et poids, communs a toutes les proprietes
+      // (les points hors domaine sont localises en (pmin, hmin) puis ecartes)
+      for (int k = 0; k < n; k++)
+      {
+        out[k] = (check_ph_bounds(pv[i0 + k], hv[i0 + k]) == OUT_OF_BOUNDS);
+        pk[k] = out[k] ? pmin_ipp : pv[i0 + k];
+        hk[k] = out[k] ? hmin_ipp : hv[i0 + k];
+      }
+      get_cellidx(n, pk, hk, cell);
+      for (int k = 0; k < n; k++)
+      {
+        if (out[k])
+        {
+          cell[k] = -1;
+          errfield.set(i0 + k, OUT_OF_BOUNDS);
+          c0[k] = c1[k] = c2[k] = c3[k] = 0;
+          w1[k] = w2[k] = w3[k] = w4[k] = 0.e0;
+          continue;
+        }
+        int idx = cell[k];
+        c0[k] = corn[4 * idx];
+        c1[k] = corn[1 + 4 * idx];
+        c2[k] = corn[2 + 4 * idx];
+        c3[k] = corn[3 + 4 * idx];
+      }
+      for (int k = 0; k < n; k++)
+      {
+        double pcal = (pv[i0 + k] - np[c0[k]]) / (np[c3[k]] - np[c0[k]]);
+        double hcal = (hv[i0 + k] - nh[c0[k]]) / (nh[c1[k]] - nh[c0[k]]);
+        w3[k] = pcal * hcal;
+        w4[k] = pcal - w3[k];
+        w2[k] = hcal - w3[k];
+        w1[k] = 1.e0 - pcal - w2[k];
+      }
+
+      // interpolation de chaque propriete demandee
+      for (int j = 0; j < nb_fields; j++)
+      {
+        if (slots[j] < 0)
+          continue;
+        const double *v = val_prop_ph[slots[j]].get_data().get_ptr();
+        const int *cerr = err_cell_ph[slots[j]].get_data().get_ptr();
+        EOS_Field &rj = r[j];
+        for (int k = 0; k < n; k++)
+        {
+          if (cell[k] < 0)
+            continue;
+          int code = cerr[cell[k]];
+          if (code != EOS_Internal_Error::OK)
+          {
+            errfield.set(i0 + k, worst_internal_error(errfield[i0 + k], EOS_Internal_Error(code)));
+            continue;
+          }
+          rj[i0 + k] = w1[k] * v[c0[k]] + w2[k] * v[c1[k]] + w3[k] * v[c2[k]] + w4[k] * v[c3[k]];
+        }
+      }
+    }
+
+    return worst_generic_error(err, errfield.find_worst_error().generic_error());
   }
 
   EOS_Error EOS_Ipp::compute(const EOS_Field &p,
@@ -474,17 +699,7 @@ namespace NEPTUNE_EOS
   {
     EOS_Error err = EOS_Fluid::compute(p, r, errfield);
     if ((err != EOS_Error::good)) // if the calculation by ipp did not pass
-    {
-      std::cout <<" Erreur EOS : " << err; 
-      std::cout << "The point p= (" << p.get_data() << "), Did not produce a valid calculation. " << std::endl;
-      r.print_On(std::cout);
-      if (obj_fluid == nullptr)
-      {
-        std::cerr << "Error: The interpolator fluid is not initialized. To continue the calculation, call the function init_model().  " << std::endl;
-        return err;
-      }
-      err = obj_fluid->compute(p, r, errfield);
-    }
+      err = compute_fallback(p, nullptr, r, errfield);
     return err;
   }
 
@@ -688,8 +903,18 @@ namespace NEPTUNE_EOS
       }
     }
 
-    // Initialisation des dictionnaires :
+    init_prop_dicts();
+
+    /*for (auto toto : Ipp_Prop_sat)
+      std::cout << toto.first << " et  " << toto.second << std::endl; */
+    // Display interpolated quantities at initialization
+
+    return EOS_Error::good;
+  }
 
+  // Initialisation des dictionnaires :
+  void EOS_Ipp::init_prop_dicts()
+  {
     // domaine ph
     AString name_prop;
     for (int n_prop = 0; n_prop < val_prop_ph.size(); n_prop++)
@@ -710,12 +935,6 @@ namespace NEPTUNE_EOS
       name_prop = val_prop_lim[n_prop].get_property_name();
       Ipp_Prop_lim[name_prop] = n_prop;
     }
-
-    /*for (auto toto : Ipp_Prop_sat)
-      std::cout << toto.first << " et  " << toto.second << std::endl; */
-    // Display interpolated quantities at initialization
-
-    return EOS_Error::good;
   }
 
   // load selectif : uniquement les champs demandes par l'user
@@ -972,6 +1191,161 @@ namespace NEPTUNE_EOS
     return err;
   }
 
+  // tables en memoire (EOS_IGen) : memes donnees que load_med_nodes/load_med_champ/load_med_scalar
+  // sans passer par un fichier MED ; reset_tables() permet de recharger l'objet a chaque raffinement
+  void EOS_Ipp::reset_tables()
+  {
+    FluidStr = AString("unknown");
+    method = "";
+    reference = "";
+    val_prop_ph.resize(0);
+    val_prop_sat.resize(0);
+    val_prop_lim.resize(0);
+    err_cell_ph.clear();
+    err_segm_sat.clear();
+    err_segm_lim.clear();
+    all_prop_val.clear();
+    all_err_val.clear();
+    Ipp_Prop_ph.clear();
+    Ipp_Prop_sat.clear();
+    Ipp_Prop_lim.clear();
+    index_conn_ph.resize(0);
+    connect_ph.resize(0);
+    connect_sat.resize(0);
+    connect_lim.resize(0);
+    release_bin();
+  }
+
+  EOS_Error EOS_Ipp::set_ph_nodes(const EOS_Field &p, const EOS_Field &h, const ArrOfInt &index_conn, const ArrOfInt &connect)
+  {
+    if (check_writable("set_ph_nodes") != EOS_Error::good)
+      return EOS_Error::error;
+    n_p_ph = p.get_data();
+    n_h_ph = h.get_data();
+
+    EOS_Field pf("P", "p", n_p_ph);
+    EOS_Field hf("h", "h", n_h_ph);
+    nodes_ph[0] = pf;
+    nodes_ph[1] = hf;
+
+    index_conn_ph = index_conn;
+    connect_ph = connect;
+    return EOS_Error::good;
+  }
+
+  EOS_Error EOS_Ipp::set_p_nodes(const EOS_Field &p)
+  {
+    if (check_writable("set_p_nodes") != EOS_Error::good)
+      return EOS_Error::error;
+    n_p_satlim = p.get_data();
+    EOS_Field pf("P", "p", n_p_satlim);
+    nodes_sat[0] = pf;
+    nodes_lim[0] = pf;
+
+    // segments [i, i+1] (cf. EOS_Med::add_Connectivity_1D)
+    int nb_seg = n_p_satlim.size() - 1;
+    connect_sat.resize(2 * nb_seg);
+    for (int i = 0; i < nb_seg; i++)
+    {
+      connect_sat[2 * i] = i;
+      connect_sat[2 * i + 1] = i + 1;
+    }
+    connect_lim = connect_sat;
+    return EOS_Error::good;
+  }
+
+  EOS_Error EOS_Ipp::add_ph_prop(const EOS_Field &val, EOS_Error_Field &err)
+  {
+    if (check_writable("add_ph_prop") != EOS_Error::good)
+      return EOS_Error::error;
+    AString name = val.get_propname_int();
+    all_prop_val.push_back(val.get_data());
+    EOS_Field res(name.aschar(), name.aschar(), all_prop_val[all_prop_val.size() - 1]);
+    int nprop_ph = val_prop_ph.size();
+    val_prop_ph.resize(nprop_ph + 1);
+    val_prop_ph[nprop_ph] = res;
+
+    err.set_name(name.aschar());
+    node_err2mesh_err(err);
+    return EOS_Error::good;
+  }
+
+  EOS_Error EOS_Ipp::add_p_prop(const EOS_Field &val, EOS_Error_Field &err, int sat_lim)
+  {
+    if (check_writable("add_p_prop") != EOS_Error::good)
+      return EOS_Error::error;
+    AString name = val.get_propname_int();
+    all_prop_val.push_back(val.get_data());
+    EOS_Field res(name.aschar(), name.aschar(), all_prop_val[all_prop_val.size() - 1]);
+    EOS_Fields &val_prop = (sat_lim == 0) ? val_prop_sat : val_prop_lim;
+    int nprop = val_prop.size();
+    val_prop.resize(nprop + 1);
+    val_prop[nprop] = res;
+
+    err.set_name(name.aschar());
+    node_err2segm_err(err, sat_lim);
+    return EOS_Error::good;
+  }
+
+  EOS_Error EOS_Ipp::set_scalar(const char *const name, double value)
+  {
+    if (strcmp(name, "pmin") == 0)
+      pmin = value;
+    else if (strcmp(name, "pmax") == 0)
+      pmax = value;
+    else if (strcmp(name, "hmin") == 0)
+      hmin = value;
+    else if (strcmp(name, "hmax") == 0)
+      hmax = value;
+    else if (strcmp(name, "tmin") == 0)
+      tmin = value;
+    else if (strcmp(name, "tmax") == 0)
+      tmax = value;
+    else if (strcmp(name, "delta_p") == 0)
+      delta_p_f = value;
+    else if (strcmp(name, "delta_h") == 0)
+      delta_h_f = value;
+    else if (strcmp(name, "tcrit") == 0)
+      tcrit = value;
+    else if (strcmp(name, "pcrit") == 0)
+      pcrit = value;
+    else if (strcmp(name, "hcrit") == 0)
+      hcrit = value;
+    else
+    {
+      cerr << "EOS_Ipp::set_scalar : unknown scalar " << name << endl;
+      return EOS_Error::error;
+    }
+    return EOS_Error::good;
+  }
+
+  // fin du chargement en memoire : memes pretraitements que init()
+  EOS_Error EOS_Ipp::init_tables()
+  {
+    if (check_writable("init_tables") != EOS_Error::good)
+      return EOS_Error::error;
+    nb_p_virtual = round((pmax - pmin) / delta_p_f);
+    nb_h_virtual = (delta_h_f > 0.e0) ? round((hmax - hmin) / delta_h_f) : 0;
+
+    hmin_ipp = hmin;
+    hmax_ipp = hmax;
+    tmin_ipp = tmin;
+    tmax_ipp = tmax;
+    pmin_ipp = pmin;
+    pmax_ipp = pmax;
+
+    init_prop_dicts();
+    init_prop_ph_slots();
+
+    // pretraitements (2D)
+    if (index_conn_ph.size() != 0)
+      f_mesh2r_mesh();
+
+    if (connect_sat.size() != 0)
+      f_mesh1r_mesh();
+    return EOS_Error::good;
+  }
+
   void EOS_Ipp::linear_interpolator(double p, double &res) const
   {
     // nodes
@@ -1140,19 +1514,52 @@ namespace NEPTUNE_EOS
       }
     }
   }
+  // insere la maille cell, rectangle [p0,p1[ x [h0,h1[ de la grille virtuelle, dans le
+  // sous-arbre node de cote size et d'origine (ip0, ih0) ; une feuille entierement couverte
+  // prend la maille, sinon elle est decoupee en 4 fils qui heritent de sa valeur
+  static void quad_insert(std::vector<int> &quad, int node, unsigned int ip0, unsigned int ih0, unsigned int size,
+                          unsigned int p0, unsigned int p1, unsigned int h0, unsigned int h1, int cell)
+  {
+    if (p1 <= ip0 || ip0 + size <= p0 || h1 <= ih0 || ih0 + size <= h0)
+      return;
+    if (quad[node] <= 0 && p0 <= ip0 && ip0 + size <= p1 && h0 <= ih0 && ih0 + size <= h1)
+    {
+      quad[node] = -cell;
+      return;
+    }
+    if (quad[node] <= 0)
+    {
+      int first = quad.size();
+      quad.resize(first + 4, quad[node]);
+      quad[node] = first;
+    }
+    unsigned int half = size / 2;
+    int first = quad[node];
+    for (int c = 0; c < 4; c++)
+      quad_insert(quad, first + c, ip0 + (c >> 1) * half, ih0 + (c & 1) * half, half, p0, p1, h0, h1, cell);
+  }
+
+  unsigned int EOS_Ipp::ph_quad_depth() const
+  {
+    unsigned int depth = 0;
+    while ((1u << depth) < nb_p_virtual || (1u << depth) < nb_h_virtual)
+      depth++;
+    return depth;
+  }
+
   // correspondance noeud fictif avec 1 noeud du polygone
   // On stocke la valeur de l'index pour pouvoir retrouver polygone dans connect_ph
   //(besoin des 4 noeuds pour les interpolations)
-  // facon de faire à revoir peu robuste (Cf. condition d'enregistrement de fnodes2phnodes[l])
+  // les mailles raffinees localement sont des blocs dyadiques de la grille virtuelle : le quadtree
+  // n'a qu'une feuille par maille (plus les freres), au lieu de nb_p_virtual * nb_h_virtual entrees
   void EOS_Ipp::f_mesh2r_mesh()
   {
     unsigned int nb_cell = index_conn_ph.size() - 1;
     corners.resize(4 * nb_cell);
 
-    unsigned int nb_h_nodes = round((hmax_ipp - hmin_ipp) / delta_h_f);
-    unsigned int nb_p_nodes = round((pmax_ipp - pmin_ipp) / delta_p_f);
-
-    fnodes2phnodes.resize(nb_h_nodes * nb_p_nodes);
+    quad_depth_ph = ph_quad_depth();
+    std::vector<int> quad(1, 0);
+    quad.reserve(2 * nb_cell + 1);
 
     for (unsigned int i_med_cell = 0; i_med_cell < nb_cell; i_med_cell++)
     {
@@ -1197,22 +1604,21 @@ namespace NEPTUNE_EOS
       unsigned int i_h_min = round((h_min_cell - hmin_ipp) / delta_h_f);
       unsigned int i_h_max = round((h_max_cell - hmin_ipp) / delta_h_f);
 
-      for (unsigned int i_p = i_p_min; i_p < i_p_max; i_p++)
-      {
-        for (unsigned int i_h = i_h_min; i_h < i_h_max; i_h++)
-        {
-          fnodes2phnodes[i_h + nb_h_nodes * i_p] = i_med_cell;
-        }
-      }
+      quad_insert(quad, 0, 0, 0, 1u << quad_depth_ph, i_p_min, i_p_max, i_h_min, i_h_max, i_med_cell);
 
       corners[0 + 4 * i_med_cell] = node_0;
       corners[1 + 4 * i_med_cell] = node_1;
       corners[2 + 4 * i_med_cell] = node_2;
       corners[3 + 4 * i_med_cell] = node_3;
     }
+
+    quad_ph.resize(quad.size());
+    memcpy(&quad_ph[0], &quad[0], quad.size() * sizeof(int));
+
+    make_T_strips();
   }
 
-  void EOS_Ipp::node_err2mesh_err(EOS_Error_Field &err_nodes_prop_ph)
+  void EOS_Ipp::node_err2mesh_err(const EOS_Error_Field &err_nodes_prop_ph)
   {
     int nb_cell = index_conn_ph.size() - 1;
 
@@ -1244,7 +1650,7 @@ namespace NEPTUNE_EOS
     err_cell_ph.push_back(errf);
   }
 
-  void EOS_Ipp::node_err2segm_err(EOS_Error_Field &err_nodes_prop_p, int satlim)
+  void EOS_Ipp::node_err2segm_err(const EOS_Error_Field &err_nodes_prop_p, int satlim)
   {
     int idx, idx2;
 
@@ -1305,9 +1711,50 @@ namespace NEPTUNE_EOS
     if (ih == nb_h_virtual)
       ih--;
 
-    int i = nb_h_virtual * ip + ih;
+    const int *quad = quad_ph.get_ptr();
+    int v = quad[0];
+    for (int s = (int)quad_depth_ph - 1; v > 0; s--)
+      v = quad[v + ((((ip >> s) & 1) << 1) | ((ih >> s) & 1))];
+    return -v;
+  }
 
-    return fnodes2phnodes[i];
+  // les descentes des n points avancent ensemble niveau par niveau : les lectures
+  // independantes de quad_ph se recouvrent au lieu d'attendre chacune la precedente
+  void EOS_Ipp::get_cellidx(int n, const double *p, const double *h, int *cells) const
+  {
+    const int *quad = quad_ph.get_ptr();
+    const int blk = 256;
+    unsigned int ip[blk], ih[blk];
+    for (int i0 = 0; i0 < n; i0 += blk)
+    {
+      const int m = (n - i0 < blk) ? n - i0 : blk;
+      int *v = cells + i0;
+      for (int k = 0; k < m; k++)
+      {
+        ip[k] = (unsigned int)((p[i0 + k] - pmin_ipp) / delta_p_f);
+        ih[k] = (unsigned int)((h[i0 + k] - hmin_ipp) / delta_h_f);
+        if (ip[k] == nb_p_virtual)
+          ip[k]--;
+        if (ih[k] == nb_h_virtual)
+          ih[k]--;
+        v[k] = quad[0];
+      }
+      for (int s = (int)quad_depth_ph - 1; s >= 0 && quad[0] > 0; s--)
+      {
+        int inner = 0;
+        for (int k = 0; k < m; k++)
+        {
+          int vk = v[k] > 0 ? v[k] : 0;
+          int next = quad[vk + ((((ip[k] >> s) & 1) << 1) | ((ih[k] >> s) & 1))];
+          v[k] = v[k] > 0 ? next : v[k];
+          inner |= (v[k] > 0);
+        }
+        if (!inner)
+          break;
+      }
+      for (int k = 0; k < m; k++)
+        v[k] = -v[k];
+    }
   }
 
   /*
@@ -1343,7 +1790,7 @@ namespace NEPTUNE_EOS
 
 
   // recupere les valeurs p, h et "property" pour les 4 points (=coin) de la maille réelle
-  //  idx = indice dans le maillage med = fnodes2phnodes[indice_h + Nb_pts_h * indice_p]
+  //  idx = indice de la maille med, feuille de quad_ph contenant (p,h) (cf. get_cellidx)
   EOS_Internal_Error EOS_Ipp::get_cell_values(int idx, std::map<AString, int>::const_iterator n_prop, EOS_Fields &cell_val) const
   {
     //AString property = n_prop->first; // name of the property
@@ -1645,190 +2092,287 @@ namespace NEPTUNE_EOS
 
   EOS_Internal_Error EOS_Ipp::compute_h_l_pT(double p, double T, double &res) const
   {
-    //    cout << "--- compute_h_l_pT p="<<p<<" T="<<T<<endl;
-    EOS_Internal_Error ierr;
-    double pcal, hcal, h;
-    double a, b, c, d;
-
-    pcal = hcal = h = 0.e0;
-
-    EOS_Fields values(3);
-    AString prop = "T";
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-
-    ArrOfDouble ap(4);
-    ArrOfDouble ah(4);
-    ArrOfDouble ar(4);
-    EOS_Field pf("P", "p", ap);
-    EOS_Field hf("h", "h", ah);
-    EOS_Field rf(prop.aschar(), prop.aschar(), ar);
-    values[0] = pf;
-    values[1] = hf;
-    values[2] = rf;
-
-    // Get all real cells containing p   : TODO: Optimize these lines
-    std::set<unsigned int> cells_containing_p;
-    for (double h = hmin_ipp + delta_h_f / 2; h < hmax_ipp; h += delta_h_f)
-    {
-      unsigned int med_id_cell = get_cellidx(p, h);
-      cells_containing_p.insert(med_id_cell);
-    }
-
-    // read all cells containing p
-    // for each cell compute h if 0<=h*<=1
-    // return first h computed
-    for (auto med_cell : cells_containing_p)
-    {
-      ierr = get_cell_values(med_cell, n_prop, values);
-      pcal = (p - values[0][0]) / (values[0][2] - values[0][0]);
-
-      /* a = values[2][1] - values[2][0];   // This calcul doesn't correspond to the one on the report
-      b = values[2][2] - values[2][0];
-      c = values[2][3] - values[2][2] - a;
-      d = values[2][0]; */ 
-      
-
-      a = values[2][1] - values[2][0];
-      b = values[2][3] - values[2][0];
-      c = values[2][2] - values[2][3] - a;
-      d = values[2][0]; 
-
-
-      hcal = (T - (b * pcal + d)) / (a + c * pcal);
-
-      if (((hcal > 0.0) || (fabs(hcal) < DBL_EPSILON)) && ((hcal < 1.0) || (fabs(hcal - 1.) < DBL_EPSILON)))
-      {
-        // hcal = (h-h1)/(h2-h1)   =>   h = hcal*(h2-h1)+h1;
-        res = hcal * (values[1][1] - values[1][0]) + values[1][0];
-        return EOS_Internal_Error::OK;
-      }
-    }
-    // We didn't find such an h*
-    return EOS_Ipp::INVERT_h_pT;
+    return invert_T_ph(p, T, 1, res);
   }
 
   EOS_Internal_Error EOS_Ipp::compute_h_v_pT(double p, double T, double &res) const
   {
-    EOS_Internal_Error ierr;
-    double pcal, hcal, h;
-    double a, b, c, d;
+    return invert_T_ph(p, T, 0, res);
+  }
 
-    pcal = hcal = h = 0.0;
+  // inversion h(p,T) dans une maille : T est lineaire en h a p fixe
+  //   pcal = (p-p0)/(p2-p0),  T = b*pcal + d + (a + c*pcal)*hcal
+  // renvoie hcal (NAN si pas de solution)
+  static inline double invert_T_cell(const double *np, const double *nv, const int *corn,
+                                     double p, double T)
+  {
+    int c0 = corn[0], c1 = corn[1], c2 = corn[2], c3 = corn[3];
+    double pcal = (p - np[c0]) / (np[c2] - np[c0]);
+    double a = nv[c1] - nv[c0];
+    double b = nv[c3] - nv[c0];
+    double c = nv[c2] - nv[c3] - a;
+    double d = nv[c0];
+    double hcal = (T - (b * pcal + d)) / (a + c * pcal);
+    if (((hcal > 0.0) || (fabs(hcal) < DBL_EPSILON)) && ((hcal < 1.0) || (fabs(hcal - 1.) < DBL_EPSILON)))
+      return hcal;
+    return NAN;
+  }
 
-    EOS_Fields values(3);
-    AString prop = "T";
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
+  // valeur de T a p donne sur le bord h0 (side=0) ou h1 (side=1) de la maille
+  static inline double T_cell_edge(const double *np, const double *nv, const int *corn,
+                                   double p, int side)
+  {
+    double pcal = (p - np[corn[0]]) / (np[corn[2]] - np[corn[0]]);
+    if (side == 0)
+      return nv[corn[0]] + (nv[corn[3]] - nv[corn[0]]) * pcal;
+    return nv[corn[1]] + (nv[corn[2]] - nv[corn[1]]) * pcal;
+  }
 
-    ArrOfDouble ap(4);
-    ArrOfDouble ah(4);
-    ArrOfDouble ar(4);
-    EOS_Field pf("P", "p", ap);
-    EOS_Field hf("h", "h", ah);
-    EOS_Field rf(prop.aschar(), prop.aschar(), ar);
-    values[0] = pf;
-    values[1] = hf;
-    values[2] = rf;
+  // h(p,T) par inversion de la table T(p,h)
+  // la rangee de p virtuelle contenant p donne la liste des mailles par h croissant
+  // (strip_cells_ph) ; si T y est croissant en h, recherche dichotomique puis une
+  // seule inversion bilineaire, sinon parcours de la rangee depuis h min (liquide)
+  // ou h max (vapeur)
+  EOS_Internal_Error EOS_Ipp::invert_T_ph(double p, double T, int liquid, double &res) const
+  {
+    int i_prop = get_prop_ph_slot(NEPTUNE::T);
+    if (i_prop < 0)
+      return PROP_NOT_IN_DB;
+    if (check_p_bounds_ph(p) == OUT_OF_BOUNDS)
+      return OUT_OF_BOUNDS;
 
-    // Get all real cells containing p
-    std::set<unsigned int> cells_containing_p;
-    for (double h = hmin_ipp + delta_h_f / 2; h < hmax_ipp; h += delta_h_f)
+    unsigned int ip = (unsigned int)((p - pmin_ipp) / delta_p_f);
+    if (ip == nb_p_virtual)
+      ip--;
+    if (ip + 1 >= (unsigned int)strip_index_ph.size())
+      return EOS_Ipp::INVERT_h_pT;
+
+    const double *np = nodes_ph[0].get_data().get_ptr();
+    const double *nh = nodes_ph[1].get_data().get_ptr();
+    const double *nv = val_prop_ph[i_prop].get_data().get_ptr();
+    const int *corn = corners.get_ptr();
+    const int *cells = strip_cells_ph.get_ptr() + strip_index_ph[ip];
+    const int n = strip_index_ph[ip + 1] - strip_index_ph[ip];
+    if (n == 0)
+      return EOS_Ipp::INVERT_h_pT;
+
+    double hcal = NAN;
+    int k = -1;
+    if (strip_mono_ph[ip])
+    {
+      int lo = 0, hi = n;
+      if (liquid)
+      { // premiere maille avec T(h1) >= T
+        while (lo < hi)
+        {
+          int mid = (lo + hi) / 2;
+          if (T_cell_edge(np, nv, corn + 4 * cells[mid], p, 1) < T)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        k = (lo < n) ? lo : n - 1;
+      }
+      else
+      { // derniere maille avec T(h0) <= T
+        while (lo < hi)
+        {
+          int mid = (lo + hi) / 2;
+          if (T_cell_edge(np, nv, corn + 4 * cells[mid], p, 0) <= T)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        k = (lo > 0) ? lo - 1 : 0;
+      }
+      // maillage non conforme : on essaie aussi les voisines
+      int cand[3] = {k, liquid ? k - 1 : k + 1, liquid ? k + 1 : k - 1};
+      k = -1;
+      for (int i = 0; i < 3 && k < 0; i++)
+      {
+        if (cand[i] < 0 || cand[i] >= n)
+          continue;
+        hcal = invert_T_cell(np, nv, corn + 4 * cells[cand[i]], p, T);
+        if (!std::isnan(hcal))
+          k = cand[i];
+      }
+    }
+    for (int i = 0; i < n && k < 0; i++)
     {
-      unsigned int med_id_cell = get_cellidx(p, h);
-      cells_containing_p.insert(med_id_cell);
+      int j = liquid ? i : n - 1 - i;
+      hcal = invert_T_cell(np, nv, corn + 4 * cells[j], p, T);
+      if (!std::isnan(hcal))
+        k = j;
     }
+    if (k < 0)
+      return EOS_Ipp::INVERT_h_pT; // We didn't find such an h*
 
-    // read all cells containing p
-    // for each cell compute h if 0<=h*<=1
-    // return first h computed
-    for (auto med_cell : cells_containing_p)
-    {
-      ierr = get_cell_values(med_cell, n_prop, values);
-      pcal = (p - values[0][0]) / (values[0][2] - values[0][0]);
-      /* a = values[2][1] - values[2][0];
-      b = values[2][2] - values[2][0];
-      c = values[2][3] - values[2][2] - a;
-      d = values[2][0];*/ 
-      a = values[2][1] - values[2][0];
-      b = values[2][3] - values[2][0];
-      c = values[2][2] - values[2][3] - a;
-      d = values[2][0]; 
+    // hcal = (h-h1)/(h2-h1)   =>   h = hcal*(h2-h1)+h1;
+    const int *c = corn + 4 * cells[k];
+    res = hcal * (nh[c[1]] - nh[c[0]]) + nh[c[0]];
+    return EOS_Internal_Error::OK;
+  }
 
+  // feuilles du quadtree traversees par la rangee ip, par h croissant (sans repetition)
+  static void quad_row(const int *quad, int v, unsigned int ih0, unsigned int size, unsigned int ip,
+                       unsigned int nb_h, int &last, std::vector<int> &cells)
+  {
+    if (ih0 >= nb_h)
+      return;
+    if (v <= 0)
+    {
+      if (-v != last)
+        cells.push_back(-v);
+      last = -v;
+      return;
+    }
+    unsigned int half = size / 2;
+    int first = v + ((ip & half) ? 2 : 0);
+    quad_row(quad, quad[first], ih0, half, ip, nb_h, last, cells);
+    quad_row(quad, quad[first + 1], ih0 + half, half, ip, nb_h, last, cells);
+  }
 
-      hcal = (T - (b * pcal + d)) / (a + c * pcal);
-      if (((hcal > 0.0) || (fabs(hcal) < DBL_EPSILON)) && ((hcal < 1.0) || (fabs(hcal - 1.) < DBL_EPSILON)))
+  // pour chaque rangee de p virtuelle : liste des mailles reelles par h croissant
+  // et indicateur de monotonie de T(h) le long de la rangee (cf. invert_T_ph)
+  void EOS_Ipp::make_T_strips()
+  {
+    strip_index_ph.resize(nb_p_virtual + 1);
+    strip_index_ph = 0;
+    strip_mono_ph.resize(nb_p_virtual);
+    strip_mono_ph = 0;
+    strip_cells_ph.resize(0);
+    int i_prop = get_prop_ph_slot(NEPTUNE::T);
+    if (i_prop < 0 || quad_ph.size() == 0)
+      return;
+
+    const double *np = nodes_ph[0].get_data().get_ptr();
+    const double *nv = val_prop_ph[i_prop].get_data().get_ptr();
+    std::vector<int> cells;
+    std::vector<int> index(1, 0);
+    for (unsigned int ip = 0; ip < nb_p_virtual; ip++)
+    {
+      int last = -1;
+      quad_row(quad_ph.get_ptr(), quad_ph[0], 0, 1u << quad_depth_ph, ip, nb_h_virtual, last, cells);
+      index.push_back(cells.size());
+
+      // T croissant en h dans chaque maille et d'une maille a la suivante (bords de la rangee)
+      int mono = 1;
+      double p_lo = pmin_ipp + ip * delta_p_f;
+      double p_hi = p_lo + delta_p_f;
+      for (int k = index[ip]; k < index[ip + 1] && mono; k++)
       {
-        // hcal = (h-h1)/(h2-h1)   =>   h = hcal*(h2-h1)+h1;
-        res = hcal * (values[1][1] - values[1][0]) + values[1][0];
-        return EOS_Internal_Error::OK;
+        const int *c = corners.get_ptr() + 4 * cells[k];
+        if (nv[c[1]] < nv[c[0]] || nv[c[2]] < nv[c[3]])
+          mono = 0;
+        else if (k + 1 < index[ip + 1])
+        {
+          const int *cn = corners.get_ptr() + 4 * cells[k + 1];
+          for (int side = 0; side < 2; side++)
+          {
+            double pe = side ? p_hi : p_lo;
+            double t1 = T_cell_edge(np, nv, c, pe, 1);
+            double t0 = T_cell_edge(np, nv, cn, pe, 0);
+            if (t1 > t0 + DBL_EPSILON * (1. + fabs(t0)))
+              mono = 0;
+          }
+        }
       }
+      strip_mono_ph[ip] = mono;
     }
-    // We didn't find such an h*
-    return EOS_Ipp::INVERT_h_pT;
+
+    strip_cells_ph.resize(cells.size());
+    for (unsigned int k = 0; k < cells.size(); k++)
+      strip_cells_ph[k] = cells[k];
+    for (unsigned int ip = 0; ip <= nb_p_virtual; ip++)
+      strip_index_ph[ip] = index[ip];
   }
 
   EOS_Internal_Error EOS_Ipp::compute_prop_ph(const std::map<AString, int>::const_iterator
                                                   n_prop,
                                               double p, double h, double &res) const
   {
-    // changer l'acces au prop
-    EOS_Internal_Error ierr;
-    EOS_Fields values(3);
-
-    //int i_prop = n_prop->second;
-    AString name_prop = n_prop->first;
+    if (n_prop == Ipp_Prop_ph.end())
+      return PROP_NOT_IN_DB;
+    return compute_prop_ph(n_prop->second, p, h, res);
+  }
 
-    ArrOfDouble ap(4);
-    ArrOfDouble ah(4);
-    ArrOfDouble ar(4);
-    EOS_Field pf("P", "p",NEPTUNE::p, ap);
-    EOS_Field hf("h", "h",NEPTUNE::h, ah);
-    EOS_Field rf(name_prop.aschar(), name_prop.aschar(), ar); // transformer prop.
-    // EOS_Field rf(prop,prop,ar)
-    values[0] = pf;
-    values[1] = hf;
-    values[2] = rf;
+  // interpolation bilineaire de la propriete du slot i_prop : les valeurs aux 4 coins
+  // sont lues directement dans nodes_ph et val_prop_ph (aucune allocation)
+  EOS_Internal_Error EOS_Ipp::compute_prop_ph(int i_prop, double p, double h, double &res) const
+  {
+    if (i_prop < 0 || i_prop >= val_prop_ph.size())
+      return PROP_NOT_IN_DB;
 
-    ierr = check_ph_bounds(p, h);
+    EOS_Internal_Error ierr = check_ph_bounds(p, h);
     if (ierr == OUT_OF_BOUNDS)
       return ierr;
 
-    int index = get_cellidx(p, h);
-    ierr = get_cell_values(index, n_prop, values);
+    int idx = get_cellidx(p, h);
+    ierr = err_cell_ph[i_prop][idx].get_code();
     if (ierr != EOS_Internal_Error::OK)
       return ierr;
 
-    res = bilinear_interpolator(p, h, values);
+    const EOS_Field &np = nodes_ph[0];
+    const EOS_Field &nh = nodes_ph[1];
+    const EOS_Field &nv = val_prop_ph[i_prop];
+    int c0 = corners[4 * idx];
+    int c1 = corners[1 + 4 * idx];
+    int c2 = corners[2 + 4 * idx];
+    int c3 = corners[3 + 4 * idx];
+
+    // meme formule que bilinear_interpolator
+    double pcal = (p - np[c0]) / (np[c3] - np[c0]);
+    double hcal = (h - nh[c0]) / (nh[c1] - nh[c0]);
+    double C3 = pcal * hcal;
+    double C4 = pcal - C3;
+    double C2 = hcal - C3;
+    double C1 = 1.e0 - pcal - C2;
+
+    res = (C1 * nv[c0]) + (C2 * nv[c1]) + (C3 * nv[c2]) + (C4 * nv[c3]);
 
     return EOS_Internal_Error::OK;
   }
 
+  int EOS_Ipp::get_prop_ph_slot(const char *const name) const
+  {
+    return get_prop_ph_slot(nam2num_thermprop(name));
+  }
+
+  // resolution une fois pour toutes du slot de chaque propriete du plan ph
+  void EOS_Ipp::init_prop_ph_slots()
+  {
+    prop_ph_slot.resize(lastTProperty + 1);
+    prop_ph_slot = -1;
+    for (int n_prop = 0; n_prop < val_prop_ph.size(); n_prop++)
+    {
+      EOS_thermprop prop = nam2num_thermprop(val_prop_ph[n_prop].get_property_name().aschar());
+      if (prop != NotATProperty)
+        prop_ph_slot[prop] = n_prop;
+    }
+  }
+
   // tag = 0 pour sat et tag = 1 pour lim
   EOS_Internal_Error EOS_Ipp::compute_prop_p(std::map<AString, int>::const_iterator
                                                  n_prop,
                                              double p, int sat_lim, double &res) const
   {
-    EOS_Internal_Error ierr;
-    EOS_Fields values(2);
-
-    ArrOfDouble ap(2);
-    ArrOfDouble ar(2);
-    EOS_Field pf("P", "p", NEPTUNE::p, ap);
-    AString name_prop = n_prop->first;
-    EOS_Field rf(name_prop.aschar(), name_prop.aschar(), ar); // transformer prop.
-
-    values[0] = pf;
-    values[1] = rf;
-
-    ierr = check_p_bounds_satlim(p);
+    EOS_Internal_Error ierr = check_p_bounds_satlim(p);
     if (ierr == OUT_OF_BOUNDS)
       return ierr;
 
+    // lecture directe des noeuds du segment (pas d'EOS_Field temporaire)
+    const std::map<AString, int> &prop_map = (sat_lim == 0) ? Ipp_Prop_sat : Ipp_Prop_lim;
+    const EOS_Fields &val_prop = (sat_lim == 0) ? val_prop_sat : val_prop_lim;
+    if (n_prop == prop_map.end() || n_prop->second >= (int)val_prop.size())
+      return PROP_NOT_IN_DB;
+
+    const EOS_Field &np = (sat_lim == 0) ? nodes_sat[0] : nodes_lim[0];
+    const EOS_Field &nv = val_prop[n_prop->second];
     int index = get_segmidx(p, sat_lim);
-    ierr = get_segm_values(index, n_prop, sat_lim, values);
 
-    res = linear_interpolator(p, values);
+    // meme formule que linear_interpolator
+    double pcal = (p - np[index]) / (np[index + 1] - np[index]);
+    res = (1.e0 - pcal) * nv[index] + pcal * nv[index + 1];
 
     return EOS_Internal_Error::OK;
   }
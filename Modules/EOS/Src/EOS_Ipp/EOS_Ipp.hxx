@@ -23,6 +23,7 @@
 #include "Language/API/Language.hxx"
 #include "EOS_IGen/Src/EOS_Med.hxx"
 #include <vector>
+#include <deque>
 #include <string>
 #include <map>
 using std::vector;
@@ -51,6 +52,32 @@ namespace NEPTUNE_EOS
               //! to initialize an implementation of EOS_Ipp with supplementary parameters
               virtual int init(const Strings &, const Strings &);
 
+              //! to initialize EOS_Ipp from tables held in memory (no MED file, used by EOS_IGen) :
+              //! reset_tables(), set_ph_nodes() / set_p_nodes(), add_ph_prop() / add_p_prop(),
+              //! set_scalar() for each MED scalar, then init_tables()
+              //! (error while the tables are mapped read-only by load_bin : reset_tables() first)
+              void reset_tables();
+              //! nodes of the ph mesh and connectivity of the cells (first index is 0, as read in MED)
+              EOS_Error set_ph_nodes(const EOS_Field &p, const EOS_Field &h, const ArrOfInt &index_conn, const ArrOfInt &connect);
+              //! nodes of the saturation and spinodal curves
+              EOS_Error set_p_nodes(const EOS_Field &p);
+              //! property values and errors at the ph nodes
+              EOS_Error add_ph_prop(const EOS_Field &val, EOS_Error_Field &err);
+              //! property values and errors at the p nodes, sat_lim = 0 for saturation, 1 for spinodal
+              EOS_Error add_p_prop(const EOS_Field &val, EOS_Error_Field &err, int sat_lim);
+              //! scalar pmin, pmax, hmin, hmax, tmin, tmax, delta_p, delta_h, tcrit, pcrit or hcrit
+              EOS_Error set_scalar(const char *const name, double value);
+              EOS_Error init_tables();
+
+              //! binary table : the loaded tables and their pre-processing (corners, virtual grid),
+              //! one page-aligned section per array, mapped read-only by init() when the file
+              //! starts with the binary magic number (shared between the processes of a node)
+              EOS_Error save_bin(const char *const file_name) const;
+              EOS_Error load_bin(const char *const file_name);
+              static bool is_bin(const char *const file_name);
+              //! converter : MED table {DATA}/EOS_Ipp/table_name to the binary file bin_file
+              static EOS_Error convert_med(const char *const table_name, const char *const bin_file);
+
               //! Error handling methods
               void describe_error(const EOS_Internal_Error error, AString &description) const;
 
@@ -81,6 +108,18 @@ namespace NEPTUNE_EOS
 
               virtual EOS_Internal_Error get_nbcell(int &) const;
 
+              //! fallback to the reference fluid (init_model) of the points failed by the interpolation :
+              //! number of field computes concerned, of points recomputed, of points still in error,
+              //! and of fallbacks skipped because no reference fluid was given
+              void get_fallback_counts(long &nb_calls, long &nb_points, long &nb_failed, long &nb_no_model) const;
+              void reset_fallback_counts();
+
+              //! slot of a ph property in the table (resolved at init), -1 if not in db
+              int get_prop_ph_slot(EOS_thermprop prop) const;
+              int get_prop_ph_slot(const char *const name) const;
+              //! interpolation of the ph property stored in slot i_prop (no allocation)
+              EOS_Internal_Error compute_prop_ph(int i_prop, double p, double h, double &res) const;
+
               //
               //  Other methods
               //
@@ -293,12 +332,13 @@ namespace NEPTUNE_EOS
               ArrOfDouble n_p_ph;
               ArrOfDouble n_h_ph;
               ArrOfDouble n_p_satlim;
-              vector<ArrOfDouble> all_prop_val;
-              vector<ArrOfInt> all_err_val;
+              std::deque<ArrOfDouble> all_prop_val; // stockage des champs de val_prop_* et err_* (deque :
+              std::deque<ArrOfInt> all_err_val;     // push_back n'invalide pas les donnees deja referencees)
 
               std::map<AString, int> Ipp_Prop_ph;  // dictionnaire des proprietes dans le plan ph
               std::map<AString, int> Ipp_Prop_sat; // dictionnaire des proprietes dans le plan sat
               std::map<AString, int> Ipp_Prop_lim; // dictionnaire des proprietes dans le plan lim
+              ArrOfInt prop_ph_slot;               // slot dans val_prop_ph de chaque EOS_thermprop (-1 si absente)
               // pre-traitement
               // EOS_Fields fm_ph;
               vector<EOS_Error_Field> err_cell_ph;
@@ -308,8 +348,11 @@ namespace NEPTUNE_EOS
               // void make_f_mesh();
               void f_mesh2r_mesh();
               void f_mesh1r_mesh();
-              void node_err2mesh_err(EOS_Error_Field &val_nodes_ph);
-              void node_err2segm_err(EOS_Error_Field &val_nodes_p, int satlim);
+              void make_T_strips();
+              void node_err2mesh_err(const EOS_Error_Field &val_nodes_ph);
+              void node_err2segm_err(const EOS_Error_Field &val_nodes_p, int satlim);
+              void init_prop_dicts();
+              void init_prop_ph_slots();
 
               EOS_Internal_Error compute_prop_ph(std::map<AString, int>::const_iterator
                                                      n_prop,
@@ -325,12 +368,19 @@ namespace NEPTUNE_EOS
 
               EOS_Internal_Error compute_h_l_pT(double p, double T, double &res) const;
               EOS_Internal_Error compute_h_v_pT(double p, double T, double &res) const;
+              EOS_Internal_Error invert_T_ph(double p, double T, int liquid, double &res) const;
               EOS_Internal_Error check_p_bounds_ph(double p) const;
 
               virtual EOS_Error init_model(const std::string &model_name, const std::string &fluid_name, bool switch_comp_sat, bool swch_calc_deriv_fld); // for the interpolator
               virtual EOS_Error compute(const EOS_Field &p, const EOS_Field &h, EOS_Fields &r,
                                         EOS_Error_Field &errfield) const;
               EOS_Error compute(const EOS_Field &p, EOS_Fields &r, EOS_Error_Field &errfield) const;
+              //! recomputes with obj_fluid only the points of errfield not good (in2 == nullptr : r(p))
+              EOS_Error compute_fallback(const EOS_Field &in1, const EOS_Field *in2, EOS_Fields &r,
+                                         EOS_Error_Field &errfield) const;
+              //! batched interpolation of all the fields r(p,h) stored in the ph table
+              EOS_Error compute_ph_fields(const EOS_Field &p, const EOS_Field &h, EOS_Fields &r,
+                                          EOS_Error_Field &errfield) const;
 
               /* Fonction qui servent a recuperer les bornes d'un jdd (lance les calculs avec le fluid declarer par init model)*/
               virtual EOS_Error compute_(const EOS_Field &p, const EOS_Field &h, EOS_Fields &r,
@@ -341,15 +391,29 @@ namespace NEPTUNE_EOS
        private:
               static int type_Id;
               AString FluidStr;
+              mutable long nb_fallback_calls;
+              mutable long nb_fallback_points;
+              mutable long nb_fallback_failed;
+              mutable long nb_fallback_no_model;
 
               ArrOfInt corners;        // liste des 4 noeuds formant les angles de chaque mailles du
                                        // maillage non conforme. Taille : 4 * nb_cells_med_mesh
                                        // sommet i de la maille j -> corners[i + 4*j]
-              ArrOfInt fnodes2phnodes; // correspondance entre chaque maille du maillage ph et la maille
-                                       // du maillage non conforme (med) dans laquelle elle est
+              ArrOfInt quad_ph;        // quadtree des mailles sur la grille virtuelle (delta_p_f, delta_h_f) :
+                                       // quad_ph[v] > 0 -> noeud interne, fils en v..v+3 (rang = 2*bit_p + bit_h)
+                                       // quad_ph[v] <= 0 -> feuille, maille med -quad_ph[v] ; racine en 0
+              unsigned int quad_depth_ph; // profondeur : 2^quad_depth_ph >= max(nb_p_virtual, nb_h_virtual)
+              ArrOfInt strip_index_ph; // debut dans strip_cells_ph de chaque rangee de p virtuelle (taille nb_p_virtual+1)
+              ArrOfInt strip_cells_ph; // mailles reelles de chaque rangee de p virtuelle, par h croissant
+              ArrOfInt strip_mono_ph;  // 1 si T est croissant en h le long de la rangee
               ArrOfInt fnodes2pnodes; // correspondance entre chaque maille du maillage p et la maille dans regime saturation
               ArrOfInt fnodes2pnodes_lim; // correspondance entre chaque maille du maillage p et la maille dans regime limite
                                        // 
+              void *bin_addr;          // fichier binaire projete en memoire (nullptr si tables MED ou en memoire)
+              size_t bin_size;
+              void release_bin();
+              EOS_Error check_writable(const char *const caller) const;
+
               void load_domain_values(EOS_Med &med);
               EOS_Error load_med_nodes(EOS_Med &med);
               EOS_Error load_med_champ(EOS_Med &med);
@@ -357,6 +421,9 @@ namespace NEPTUNE_EOS
               EOS_Error load_med_scalar(EOS_Med &med);
 
               int get_cellidx(double &p, double &h) const;
+              //! batched get_cellidx : the n descents advance together, one level at a time
+              void get_cellidx(int n, const double *p, const double *h, int *cells) const;
+              unsigned int ph_quad_depth() const;
               int get_segmidx(double &p, int sat_lim) const;
               void linear_interpolator(double p, double &res) const;
               double linear_interpolator(double p, EOS_Fields &segmval) const;
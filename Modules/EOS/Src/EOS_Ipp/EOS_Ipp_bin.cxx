@@ -0,0 +1,503 @@
+/****************************************************************************
+ * Copyright (c) 2023, CEA
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *****************************************************************************/
+
+/*
+ * EOS_Ipp_bin.cxx
+ *
+ * Tables EOS_Ipp au format binaire projete en memoire
+ */
+
+#include "EOS_Ipp.hxx"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace NEPTUNE_EOS
+{
+  // Format (version 2, quadtree quad_ph au lieu de la grille fnodes2phnodes) :
+  //   entete + table des sections, puis les sections, chacune alignee sur une page,
+  //   tableaux bruts de double ou d'int dans l'ordre des octets de la machine qui a ecrit.
+  //   Sommes de controle FNV-1a 64 bits de la table des sections (verifiee a chaque chargement)
+  //   et des donnees (verifiee si NEPTUNE_EOS_IPP_CHECK est defini : lit tout le fichier).
+  //   Sections "ph/<prop>", "ph_err/<prop>", "sat/...", "sat_err/...", "lim/...", "lim_err/..."
+  //   dans l'ordre de val_prop_* / err_* ; les autres portent le nom du membre.
+  static const char ipp_bin_magic[8] = {'E', 'O', 'S', '_', 'I', 'P', 'P', 'B'};
+  static const uint32_t ipp_bin_version = 2;
+  static const uint32_t ipp_bin_endian = 0x01020304;
+  static const uint64_t ipp_bin_page = 4096;
+  static const int ipp_bin_nb_scal = 11;
+  static const char *const ipp_bin_scal[ipp_bin_nb_scal] = {"pmin", "pmax", "hmin", "hmax", "tmin", "tmax",
+                                                            "delta_p", "delta_h", "tcrit", "pcrit", "hcrit"};
+  static const uint64_t ipp_bin_double = 0;
+  static const uint64_t ipp_bin_int = 1;
+
+  struct Ipp_bin_header
+  {
+    char magic[8];
+    uint32_t version;
+    uint32_t endian;
+    uint64_t page;
+    uint64_t file_size;
+    uint64_t data_offset;
+    uint64_t nb_sections;
+    uint64_t table_sum;
+    uint64_t data_sum;
+    double scal[ipp_bin_nb_scal];
+    char base_method[64];
+    char base_reference[64];
+  };
+
+  struct Ipp_bin_section
+  {
+    char name[48];
+    uint64_t type;
+    uint64_t offset;
+    uint64_t count;
+  };
+
+  struct Ipp_bin_array
+  {
+    std::string name;
+    uint64_t type;
+    uint64_t count;
+    const void *ptr;
+  };
+
+  static const uint64_t fnv_basis = 14695981039346656037ULL;
+
+  static uint64_t fnv1a(const void *buf, uint64_t n, uint64_t sum)
+  {
+    const unsigned char *c = (const unsigned char *)buf;
+    for (uint64_t i = 0; i < n; i++)
+    {
+      sum ^= c[i];
+      sum *= 1099511628211ULL;
+    }
+    return sum;
+  }
+
+  static uint64_t page_align(uint64_t n)
+  {
+    return (n + ipp_bin_page - 1) / ipp_bin_page * ipp_bin_page;
+  }
+
+  static uint64_t elt_size(uint64_t type)
+  {
+    return (type == ipp_bin_double) ? sizeof(double) : sizeof(int);
+  }
+
+  static void add_array(std::vector<Ipp_bin_array> &arrays, const std::string &name, const ArrOfDouble &x)
+  {
+    Ipp_bin_array a = {name, ipp_bin_double, (uint64_t)x.size(), x.get_ptr()};
+    arrays.push_back(a);
+  }
+
+  static void add_array(std::vector<Ipp_bin_array> &arrays, const std::string &name, const ArrOfInt &x)
+  {
+    Ipp_bin_array a = {name, ipp_bin_int, (uint64_t)x.size(), x.get_ptr()};
+    arrays.push_back(a);
+  }
+
+  static uint64_t lib_count(const Ipp_bin_section *sections, int nb_sections)
+  {
+    for (int k = 0; k < nb_sections; k++)
+      if (strcmp(sections[k].name, "library_codes") == 0)
+        return sections[k].count;
+    return 0;
+  }
+
+  bool EOS_Ipp::is_bin(const char *const file_name)
+  {
+    char magic[sizeof(ipp_bin_magic)];
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in.read(magic, sizeof(magic)))
+      return false;
+    return memcmp(magic, ipp_bin_magic, sizeof(magic)) == 0;
+  }
+
+  EOS_Error EOS_Ipp::save_bin(const char *const file_name) const
+  {
+    std::vector<Ipp_bin_array> arrays;
+    add_array(arrays, "p_ph", nodes_ph[0].get_data());
+    add_array(arrays, "h_ph", nodes_ph[1].get_data());
+    add_array(arrays, "index_conn_ph", index_conn_ph);
+    add_array(arrays, "connect_ph", connect_ph);
+    add_array(arrays, "p_sat", nodes_sat[0].get_data());
+    add_array(arrays, "p_lim", nodes_lim[0].get_data());
+    add_array(arrays, "connect_sat", connect_sat);
+    add_array(arrays, "connect_lim", connect_lim);
+    add_array(arrays, "corners", corners);
+    add_array(arrays, "quad_ph", quad_ph);
+    add_array(arrays, "strip_index_ph", strip_index_ph);
+    add_array(arrays, "strip_cells_ph", strip_cells_ph);
+    add_array(arrays, "strip_mono_ph", strip_mono_ph);
+    add_array(arrays, "fnodes2pnodes", fnodes2pnodes);
+    add_array(arrays, "fnodes2pnodes_lim", fnodes2pnodes_lim);
+
+    // codes bibliotheque des champs d'erreur : tous nuls, une seule section
+    uint64_t nb_lib = 0;
+    for (unsigned int i = 0; i < err_cell_ph.size(); i++)
+      nb_lib = std::max(nb_lib, (uint64_t)err_cell_ph[i].size());
+    for (unsigned int i = 0; i < err_segm_sat.size(); i++)
+      nb_lib = std::max(nb_lib, (uint64_t)err_segm_sat[i].size());
+    for (unsigned int i = 0; i < err_segm_lim.size(); i++)
+      nb_lib = std::max(nb_lib, (uint64_t)err_segm_lim[i].size());
+    Ipp_bin_array lib = {"library_codes", ipp_bin_int, nb_lib, nullptr};
+    arrays.push_back(lib);
+
+    const EOS_Fields *val_prop[3] = {&val_prop_ph, &val_prop_sat, &val_prop_lim};
+    const vector<EOS_Error_Field> *err_prop[3] = {&err_cell_ph, &err_segm_sat, &err_segm_lim};
+    const char *const domain[3] = {"ph", "sat", "lim"};
+    for (int d = 0; d < 3; d++)
+    {
+      for (int i = 0; i < val_prop[d]->size(); i++)
+      {
+        const EOS_Field &f = (*val_prop[d])[i];
+        add_array(arrays, std::string(domain[d]) + "/" + f.get_property_name().aschar(), f.get_data());
+      }
+      for (unsigned int i = 0; i < err_prop[d]->size(); i++)
+      {
+        const EOS_Error_Field &f = (*err_prop[d])[i];
+        add_array(arrays, std::string(domain[d]) + "_err/" + f.get_name().aschar(), f.get_data());
+      }
+    }
+
+    // placement des sections
+    Ipp_bin_header head;
+    memset(&head, 0, sizeof(head));
+    memcpy(head.magic, ipp_bin_magic, sizeof(ipp_bin_magic));
+    head.version = ipp_bin_version;
+    head.endian = ipp_bin_endian;
+    head.page = ipp_bin_page;
+    head.nb_sections = arrays.size();
+    head.data_offset = page_align(sizeof(Ipp_bin_header) + arrays.size() * sizeof(Ipp_bin_section));
+    const double scal[ipp_bin_nb_scal] = {pmin, pmax, hmin, hmax, tmin, tmax,
+                                          delta_p_f, delta_h_f, tcrit, pcrit, hcrit};
+    memcpy(head.scal, scal, sizeof(scal));
+    strncpy(head.base_method, base_method.aschar(), sizeof(head.base_method) - 1);
+    strncpy(head.base_reference, base_reference.aschar(), sizeof(head.base_reference) - 1);
+
+    std::vector<Ipp_bin_section> sections(arrays.size());
+    uint64_t offset = head.data_offset;
+    for (unsigned int k = 0; k < arrays.size(); k++)
+    {
+      Ipp_bin_section &s = sections[k];
+      memset(&s, 0, sizeof(s));
+      if (arrays[k].name.size() >= sizeof(s.name))
+      {
+        cerr << "EOS_Ipp::save_bin : section name too long " << arrays[k].name << endl;
+        return EOS_Error::error;
+      }
+      strcpy(s.name, arrays[k].name.c_str());
+      s.type = arrays[k].type;
+      s.offset = offset;
+      s.count = arrays[k].count;
+      offset = page_align(offset + s.count * elt_size(s.type));
+    }
+    head.file_size = offset;
+    head.table_sum = fnv1a(&sections[0], sections.size() * sizeof(Ipp_bin_section), fnv_basis);
+
+    // ecriture : entete provisoire, sections, puis entete avec la somme des donnees
+    std::ofstream out(file_name, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+      cerr << "EOS_Ipp::save_bin : cannot open " << file_name << endl;
+      return EOS_Error::error;
+    }
+    static const char zeros[ipp_bin_page] = {0};
+    out.write((const char *)&head, sizeof(head));
+    out.write((const char *)&sections[0], sections.size() * sizeof(Ipp_bin_section));
+    out.write(zeros, head.data_offset - sizeof(head) - sections.size() * sizeof(Ipp_bin_section));
+
+    uint64_t sum = fnv_basis;
+    for (unsigned int k = 0; k < arrays.size(); k++)
+    {
+      uint64_t nbytes = sections[k].count * elt_size(sections[k].type);
+      if (arrays[k].ptr != nullptr)
+      {
+        out.write((const char *)arrays[k].ptr, nbytes);
+        sum = fnv1a(arrays[k].ptr, nbytes, sum);
+      }
+      else
+      {
+        for (uint64_t n = 0; n < nbytes; n += ipp_bin_page)
+        {
+          uint64_t m = std::min(ipp_bin_page, nbytes - n);
+          out.write(zeros, m);
+          sum = fnv1a(zeros, m, sum);
+        }
+      }
+      uint64_t pad = page_align(nbytes) - nbytes;
+      out.write(zeros, pad);
+      sum = fnv1a(zeros, pad, sum);
+    }
+    head.data_sum = sum;
+    out.seekp(0);
+    out.write((const char *)&head, sizeof(head));
+    out.close();
+    if (!out)
+    {
+      cerr << "EOS_Ipp::save_bin : error writing " << file_name << endl;
+      return EOS_Error::error;
+    }
+    return EOS_Error::good;
+  }
+
+  EOS_Error EOS_Ipp::load_bin(const char *const file_name)
+  {
+    AString save_method = method;
+    AString save_reference = reference;
+    reset_tables();
+    method = save_method;
+    reference = save_reference;
+
+    int fd = open(file_name, O_RDONLY);
+    if (fd < 0)
+    {
+      cerr << "EOS_Ipp::load_bin : cannot open " << file_name << endl;
+      return EOS_Error::error;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(Ipp_bin_header))
+    {
+      close(fd);
+      cerr << "EOS_Ipp::load_bin : bad file " << file_name << endl;
+      return EOS_Error::error;
+    }
+    // MAP_SHARED : une seule copie physique (cache de pages) pour tous les processus du noeud
+    void *addr = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+      cerr << "EOS_Ipp::load_bin : mmap failed for " << file_name << endl;
+      return EOS_Error::error;
+    }
+    bin_addr = addr;
+    bin_size = st.st_size;
+
+    const char *base = (const char *)addr;
+    const Ipp_bin_header &head = *(const Ipp_bin_header *)base;
+    const char *bad = nullptr;
+    if (memcmp(head.magic, ipp_bin_magic, sizeof(ipp_bin_magic)) != 0)
+      bad = "not an EOS_Ipp binary table";
+    else if (head.version != ipp_bin_version)
+      bad = "unsupported version";
+    else if (head.endian != ipp_bin_endian)
+      bad = "byte order differs from this machine";
+    else if (head.file_size != bin_size || head.page != ipp_bin_page)
+      bad = "truncated file";
+    else if (head.data_offset > bin_size
+             || sizeof(Ipp_bin_header) + head.nb_sections * sizeof(Ipp_bin_section) > head.data_offset)
+      bad = "corrupted header";
+    if (bad != nullptr)
+    {
+      cerr << "EOS_Ipp::load_bin : " << bad << " : " << file_name << endl;
+      release_bin();
+      return EOS_Error::error;
+    }
+
+    const Ipp_bin_section *sections = (const Ipp_bin_section *)(base + sizeof(Ipp_bin_header));
+    const int nb_sections = (int)head.nb_sections;
+    if (fnv1a(sections, nb_sections * sizeof(Ipp_bin_section), fnv_basis) != head.table_sum)
+      bad = "section table checksum mismatch";
+    else if (getenv("NEPTUNE_EOS_IPP_CHECK")
+             && fnv1a(base + head.data_offset, bin_size - head.data_offset, fnv_basis) != head.data_sum)
+      bad = "data checksum mismatch";
+    for (int k = 0; k < nb_sections && bad == nullptr; k++)
+    {
+      const Ipp_bin_section &s = sections[k];
+      if (memchr(s.name, 0, sizeof(s.name)) == nullptr || s.type > ipp_bin_int
+          || s.offset % ipp_bin_page != 0 || s.offset < head.data_offset || s.count > INT_MAX
+          || s.offset + s.count * elt_size(s.type) > bin_size)
+        bad = "corrupted section table";
+    }
+    for (int k = 0; k < nb_sections && bad == nullptr; k++)
+      if (strstr(sections[k].name, "_err/") != nullptr && sections[k].count > lib_count(sections, nb_sections))
+        bad = "error field larger than library_codes";
+    if (bad != nullptr)
+    {
+      cerr << "EOS_Ipp::load_bin : " << bad << " : " << file_name << endl;
+      release_bin();
+      return EOS_Error::error;
+    }
+
+    // les tableaux sont des vues sur le fichier (lecture seule)
+    std::map<std::string, const Ipp_bin_section *> named;
+    for (int k = 0; k < nb_sections; k++)
+      named[sections[k].name] = &sections[k];
+    struct
+    {
+      const char *name;
+      ArrOfInt *arr;
+    } int_arrays[] = {{"index_conn_ph", &index_conn_ph}, {"connect_ph", &connect_ph}, {"connect_sat", &connect_sat}, {"connect_lim", &connect_lim}, {"corners", &corners}, {"quad_ph", &quad_ph}, {"strip_index_ph", &strip_index_ph}, {"strip_cells_ph", &strip_cells_ph}, {"strip_mono_ph", &strip_mono_ph}, {"fnodes2pnodes", &fnodes2pnodes}, {"fnodes2pnodes_lim", &fnodes2pnodes_lim}};
+    const char *const double_arrays[] = {"p_ph", "h_ph", "p_sat", "p_lim"};
+    for (unsigned int k = 0; k < sizeof(int_arrays) / sizeof(int_arrays[0]) && bad == nullptr; k++)
+      if (named.count(int_arrays[k].name) == 0 || named[int_arrays[k].name]->type != ipp_bin_int)
+        bad = int_arrays[k].name;
+    for (unsigned int k = 0; k < 4 && bad == nullptr; k++)
+      if (named.count(double_arrays[k]) == 0 || named[double_arrays[k]]->type != ipp_bin_double)
+        bad = double_arrays[k];
+    if (bad == nullptr && (named.count("library_codes") == 0 || named["library_codes"]->type != ipp_bin_int))
+      bad = "library_codes";
+    if (bad != nullptr)
+    {
+      cerr << "EOS_Ipp::load_bin : missing section " << bad << " : " << file_name << endl;
+      release_bin();
+      return EOS_Error::error;
+    }
+
+    for (unsigned int k = 0; k < sizeof(int_arrays) / sizeof(int_arrays[0]); k++)
+    {
+      const Ipp_bin_section *s = named[int_arrays[k].name];
+      int_arrays[k].arr->set_ptr((int)s->count, (const int *)(base + s->offset));
+    }
+    const Ipp_bin_section *s_p = named["p_ph"];
+    const Ipp_bin_section *s_h = named["h_ph"];
+    const Ipp_bin_section *s_sat = named["p_sat"];
+    const Ipp_bin_section *s_lim = named["p_lim"];
+    n_p_ph.set_ptr((int)s_p->count, (const double *)(base + s_p->offset));
+    n_h_ph.set_ptr((int)s_h->count, (const double *)(base + s_h->offset));
+    n_p_satlim.set_ptr((int)s_sat->count, (const double *)(base + s_sat->offset));
+    nodes_ph[0] = EOS_Field("P", "p", n_p_ph.size(), (double *)n_p_ph.get_ptr());
+    nodes_ph[1] = EOS_Field("h", "h", n_h_ph.size(), (double *)n_h_ph.get_ptr());
+    nodes_sat[0] = EOS_Field("P", "p", n_p_satlim.size(), (double *)n_p_satlim.get_ptr());
+    nodes_lim[0] = EOS_Field("P", "p", (int)s_lim->count, (double *)(base + s_lim->offset));
+
+    const Ipp_bin_section *s_lib = named["library_codes"];
+    int *lib = (int *)(base + s_lib->offset);
+    EOS_Fields *val_prop[3] = {&val_prop_ph, &val_prop_sat, &val_prop_lim};
+    vector<EOS_Error_Field> *err_prop[3] = {&err_cell_ph, &err_segm_sat, &err_segm_lim};
+    const char *const domain[3] = {"ph/", "sat/", "lim/"};
+    const char *const domain_err[3] = {"ph_err/", "sat_err/", "lim_err/"};
+    for (int k = 0; k < nb_sections; k++)
+    {
+      const Ipp_bin_section &s = sections[k];
+      for (int d = 0; d < 3; d++)
+      {
+        if (strncmp(s.name, domain[d], strlen(domain[d])) == 0 && s.type == ipp_bin_double)
+        {
+          const char *name = s.name + strlen(domain[d]);
+          int nprop = val_prop[d]->size();
+          val_prop[d]->resize(nprop + 1);
+          (*val_prop[d])[nprop] = EOS_Field(name, name, (int)s.count, (double *)(base + s.offset));
+        }
+        else if (strncmp(s.name, domain_err[d], strlen(domain_err[d])) == 0 && s.type == ipp_bin_int)
+        {
+          EOS_Error_Field errf((int)s.count, (int *)(base + s.offset), lib);
+          errf.set_name(s.name + strlen(domain_err[d]));
+          err_prop[d]->push_back(errf);
+        }
+      }
+    }
+
+    for (int k = 0; k < ipp_bin_nb_scal; k++)
+      set_scalar(ipp_bin_scal[k], head.scal[k]);
+    base_method = AString(std::string(head.base_method, strnlen(head.base_method, sizeof(head.base_method))).c_str());
+    base_reference = AString(std::string(head.base_reference, strnlen(head.base_reference, sizeof(head.base_reference))).c_str());
+
+    // memes grandeurs que init_tables(), les pretraitements sont deja dans le fichier
+    nb_p_virtual = round((pmax - pmin) / delta_p_f);
+    nb_h_virtual = (delta_h_f > 0.e0) ? round((hmax - hmin) / delta_h_f) : 0;
+    hmin_ipp = hmin;
+    hmax_ipp = hmax;
+    tmin_ipp = tmin;
+    tmax_ipp = tmax;
+    pmin_ipp = pmin;
+    pmax_ipp = pmax;
+
+    int nb_cell = index_conn_ph.size() - 1;
+    if (nb_cell > 0 && (corners.size() != 4 * nb_cell
+                        || quad_ph.size() == 0
+                        || strip_index_ph.size() != (int)nb_p_virtual + 1))
+    {
+      cerr << "EOS_Ipp::load_bin : virtual grid inconsistent with the scalars : " << file_name << endl;
+      reset_tables();
+      return EOS_Error::error;
+    }
+
+    quad_depth_ph = ph_quad_depth();
+    init_prop_dicts();
+    init_prop_ph_slots();
+    return EOS_Error::good;
+  }
+
+  // detache les vues sur le fichier avant de le liberer
+  void EOS_Ipp::release_bin()
+  {
+    if (bin_addr == nullptr)
+      return;
+    val_prop_ph.resize(0);
+    val_prop_sat.resize(0);
+    val_prop_lim.resize(0);
+    err_cell_ph.clear();
+    err_segm_sat.clear();
+    err_segm_lim.clear();
+    nodes_ph[0] = EOS_Field();
+    nodes_ph[1] = EOS_Field();
+    nodes_sat[0] = EOS_Field();
+    nodes_lim[0] = EOS_Field();
+    n_p_ph.resize(0);
+    n_h_ph.resize(0);
+    n_p_satlim.resize(0);
+    index_conn_ph.resize(0);
+    connect_ph.resize(0);
+    connect_sat.resize(0);
+    connect_lim.resize(0);
+    corners.resize(0);
+    quad_ph.resize(0);
+    strip_index_ph.resize(0);
+    strip_cells_ph.resize(0);
+    strip_mono_ph.resize(0);
+    fnodes2pnodes.resize(0);
+    fnodes2pnodes_lim.resize(0);
+    munmap(bin_addr, bin_size);
+    bin_addr = nullptr;
+    bin_size = 0;
+  }
+
+  // tables projetees en lecture seule (PROT_READ) : les remplir ou les pretraiter
+  // ecrirait dans la projection, reset_tables() les detache d'abord
+  EOS_Error EOS_Ipp::check_writable(const char *const caller) const
+  {
+    if (bin_addr == nullptr)
+      return EOS_Error::good;
+    cerr << "EOS_Ipp::" << caller << " : tables mapped read-only from a binary file, call reset_tables() first" << endl;
+    return EOS_Error::error;
+  }
+
+  EOS_Error EOS_Ipp::convert_med(const char *const table_name, const char *const bin_file)
+  {
+    EOS_Ipp ipp;
+    Strings strings(1);
+    strings[0] = table_name;
+    int err = ipp.init(strings);
+    if (err != EOS_Error::good && err != EOS_Error::ok)
+    {
+      cerr << "EOS_Ipp::convert_med : cannot load " << table_name << endl;
+      return EOS_Error::error;
+    }
+    return ipp.save_bin(bin_file);
+  }
+}
@@ -33,6 +33,13 @@ namespace NEPTUNE_EOS
     return EOS_Internal_Error::OK;
   }
 
+  inline int EOS_Ipp::get_prop_ph_slot(EOS_thermprop prop) const
+  {
+    if (prop < firstTProperty || prop >= prop_ph_slot.size())
+      return -1;
+    return prop_ph_slot[prop];
+  }
+
   //! tcrit
   inline EOS_Internal_Error EOS_Ipp::get_T_crit(double &T_crit) const
   {
@@ -99,35 +106,22 @@ namespace NEPTUNE_EOS
 
   inline EOS_Internal_Error EOS_Ipp::compute_T_ph(double p, double h, double &res) const
   {
-    AString prop("T");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    // std::map<AString, int>::const_iterator   n_prop=Ipp_Prop_ph["T"]
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::T], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_T_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_T_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_T_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_T_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_T_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_T_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_rho_ph(double p, double h, double &res) const
   {
-    AString prop("rho");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::rho], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_rho_pT(double p, double T, double &res) const
@@ -142,26 +136,17 @@ namespace NEPTUNE_EOS
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_rho_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_rho_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_rho_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_rho_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_rho_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_rho_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_u_ph(double p, double h, double &res) const
   {
-    AString prop("u");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::u], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_u_pT(double p, double T, double &res) const
@@ -176,26 +161,17 @@ namespace NEPTUNE_EOS
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_u_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_u_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_u_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_u_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_u_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_u_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_s_ph(double p, double h, double &res) const
   {
-    AString prop("s");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::s], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_s_pT(double p, double T, double &res) const
@@ -210,26 +186,17 @@ namespace NEPTUNE_EOS
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_s_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_s_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_s_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_s_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_s_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_s_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_mu_ph(double p, double h, double &res) const
   {
-    AString prop("mu");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::mu], p, h, res);
   }
   inline EOS_Internal_Error EOS_Ipp::compute_mu_pT(double p, double T, double &res) const
   {
@@ -249,10 +216,7 @@ namespace NEPTUNE_EOS
       if (err==EOS_Error::good)
         return EOS_Internal_Error::OK;
     }
-    AString prop("d_mu_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_mu_d_p_h], p, h, res);
   }
   inline EOS_Internal_Error EOS_Ipp::compute_d_mu_d_h_p_ph(double p, double h, double &res) const
   {
@@ -262,18 +226,12 @@ namespace NEPTUNE_EOS
       if (err==EOS_Error::good)
         return EOS_Internal_Error::OK;
     }
-    AString prop("d_mu_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_mu_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_lambda_ph(double p, double h, double &res) const
   {
-    AString prop("lambda");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::lambda], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_lambda_pT(double p, double T, double &res) const
@@ -288,16 +246,13 @@ namespace NEPTUNE_EOS
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_lambda_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_lambda_d_p_h");
     if ( swch_calc_deriv_fld_==true)
     {
         EOS_Error err = obj_fluid->compute_d_lambda_d_p_h_ph(p, h, res); // Warning, not a goodway to return the error but here to debug 
         if (err==EOS_Error::good)
           return EOS_Internal_Error::OK;
     }
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_lambda_d_p_h], p, h, res);
   }
 
 
@@ -341,24 +296,18 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_lambda_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_lambda_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
     if ( swch_calc_deriv_fld_==true)
     {
       EOS_Error err = obj_fluid->compute_d_lambda_d_h_p_ph(p,h,res);
       if (err==EOS_Error::good)
         return EOS_Internal_Error::OK;
     }
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_lambda_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_cp_ph(double p, double h, double &res) const
   {
-    AString prop("cp");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::cp], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_cp_pT(double p, double T, double &res) const
@@ -373,38 +322,29 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_cp_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_cp_d_p_h");
     if ( swch_calc_deriv_fld_==true)
     {
         obj_fluid->compute_d_cp_d_p_h_ph(p, h, res); // Warning, not a goodway to return the error but here to debug 
         return EOS_Internal_Error::OK;
     }
 
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_cp_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_cp_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_cp_d_h_p");
     if ( swch_calc_deriv_fld_==true)
     {
         obj_fluid->compute_d_cp_d_h_p_ph(p, h, res); // Warning, not a goodway to return the error but here to debug 
         return EOS_Internal_Error::OK;
     }
 
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_cp_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_sigma_ph(double p, double h, double &res) const
   {
-    AString prop("sigma");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::sigma], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_sigma_pT(double p, double T, double &res) const
@@ -419,38 +359,29 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_sigma_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_sigma_d_p_h");
     /*if ( swch_calc_deriv_fld_==true)
     {
       EOS_Error err = obj_fluid->compute_d_sigma_d_p_h_ph(p,h,res);
       if (err==EOS_Error::good)
         return EOS_Internal_Error::OK;
     }*/
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_sigma_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_sigma_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_sigma_d_h_p");
     /*if ( swch_calc_deriv_fld_==true)
     {
       EOS_Error err = obj_fluid->compute_d_sigma_d_h_p_ph(p,h,res);
       if (err==EOS_Error::good)
         return EOS_Internal_Error::OK;
     }*/
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_sigma_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_w_ph(double p, double h, double &res) const
   {
-    AString prop("w");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::w], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_w_pT(double p, double T, double &res) const
@@ -465,26 +396,17 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_w_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_w_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_w_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_w_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_w_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_w_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_g_ph(double p, double h, double &res) const
   {
-    AString prop("g");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::g], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_g_pT(double p, double T, double &res) const
@@ -499,26 +421,17 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_g_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_g_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_g_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_g_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_g_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_g_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_f_ph(double p, double h, double &res) const
   {
-    AString prop("f");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::f], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_f_pT(double p, double T, double &res) const
@@ -533,26 +446,17 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_f_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_f_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_f_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_f_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_f_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_f_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_pr_ph(double p, double h, double &res) const
   {
-    AString prop("pr");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::pr], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_pr_pT(double p, double T, double &res) const
@@ -567,25 +471,16 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_pr_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_pr_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_pr_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_pr_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_pr_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_pr_d_h_p], p, h, res);
   }
   inline EOS_Internal_Error EOS_Ipp::compute_beta_ph(double p, double h, double &res) const
   {
-    AString prop("beta");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::beta], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_beta_pT(double p, double T, double &res) const
@@ -606,26 +501,17 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
       if (err==EOS_Error::good)
         return EOS_Internal_Error::OK;
     }
-    AString prop("d_beta_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_beta_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_beta_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_beta_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_beta_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_gamma_ph(double p, double h, double &res) const
   {
-    AString prop("gamma");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::gamma], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_gamma_pT(double p, double T, double &res) const
@@ -640,18 +526,12 @@ inline EOS_Internal_Error EOS_Ipp:: compute_d_h_d_T_p_pT(double p, double T, dou
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_gamma_d_p_h_ph(double p, double h, double &res) const
   {
-    AString prop("d_gamma_d_p_h");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_gamma_d_p_h], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_d_gamma_d_h_p_ph(double p, double h, double &res) const
   {
-    AString prop("d_gamma_d_h_p");
-    std::map<AString, int>::const_iterator n_prop;
-    find(n_prop, prop, Ipp_Prop_ph);
-    return compute_prop_ph(n_prop, p, h, res);
+    return compute_prop_ph(prop_ph_slot[NEPTUNE::d_gamma_d_h_p], p, h, res);
   }
 
   inline EOS_Internal_Error EOS_Ipp::compute_T_sat_p(double p, double &res) const
@@ -19,6 +19,8 @@
 #include "Language/API/RegisterType.hxx"
 #include "Language/API/Object_i.hxx"
 #include "Language/API/Types_Info.hxx"
+#include <algorithm>
+#include <vector>
 #ifdef WITH_PLUGIN_CATHARE2
 #include "EOS/Src/EOS_Cathare2/EOS_Cathare2Vapor.hxx"
 #include "EOS/Src/EOS_Cathare2/EOS_CathareIncondensableGas.hxx"
@@ -40,6 +42,52 @@ static void totab(ArrOfDouble& C
   if(n > 4)  C[4] = C_4 ;
 }
 
+// sizes (in doubles) of the workspace of EOS_Mixing::compute_perfect_gas
+// plan (p,h) : 139 fields of nsca points + 2 arrays of nb_fluids
+static inline int work_size_ph(int nsca, int nb_fluids)
+{ return 139*nsca + 2*nb_fluids ;
+}
+// plan (p,T) : 10 fields + 1 array (its (p,h) computes have their own)
+static inline int work_size_pT(int nsca, int nb_fluids)
+{ return 10*nsca + nb_fluids ;
+}
+
+// scratch buffers of the calling thread, one per nesting level of the
+// compute calls (the (p,T) plan calls the (p,h) one), kept between calls
+static thread_local std::vector< std::vector<double> > mixing_buffers ;
+static thread_local int mixing_depth = 0 ;
+
+//! size doubles set to 0, owned by the calling thread until destruction
+class Mixing_Workspace
+{ public :
+    explicit Mixing_Workspace(int size)
+    { ptr = reserve(mixing_depth++, size) ;
+      std::fill(ptr, ptr + size, 0.e0) ;
+    }
+    ~Mixing_Workspace()
+    { mixing_depth-- ;
+    }
+    double* get() const
+    { return ptr ;
+    }
+    //! buffer of the calling thread at nesting level depth, at least size doubles
+    static double* reserve(int depth, int size)
+    { if ((int)mixing_buffers.size() <= depth)
+         mixing_buffers.resize(depth+1) ;
+      std::vector<double>& w = mixing_buffers[depth] ;
+      if ((int)w.size() < size)
+         { int nsz = std::max(size, 2*(int)w.size()) ;
+           std::vector<double>().swap(w) ;  // no copy of the old content
+           w.resize(nsz) ;
+         }
+      return w.data() ;
+    }
+  private :
+    double* ptr ;
+    Mixing_Workspace(const Mixing_Workspace&) ;
+    Mixing_Workspace& operator=(const Mixing_Workspace&) ;
+} ;
+
 namespace NEPTUNE_EOS
 {
   const AString EOS_Mixing::tablename("EOS_Mixing") ;
@@ -144,6 +192,13 @@ namespace NEPTUNE_EOS
   { return *(the_fluids[i]) ;
   }
 
+  // workspaces belong to the calling thread : thread safe as the components
+  bool EOS_Mixing::is_thread_safe() const
+  { for (int i=0; i<nb_fluids; i++)
+       if (!the_fluids[i]->fluid().is_thread_safe())  return false ;
+    return true ;
+  }
+
   void EOS_Mixing::set_component(int i, const EOS& fluid)
   { the_fluids[i]=&((EOS&)(fluid));
     if (compute_mode == MixingType::Unsupported) {
@@ -183,6 +238,25 @@ namespace NEPTUNE_EOS
     return compute(input, output, errfield) ;
   }
 
+  void EOS_Mixing::reserve_workspace(int nsca) const
+  { switch(compute_mode) {
+        case MixingType::Cathare:
+            Mixing_Workspace::reserve(0, 8*4) ;
+            break ;
+        case MixingType::Cathare2:
+            Mixing_Workspace::reserve(0, 16*(nb_fluids-1)) ;
+            break ;
+        case MixingType::WithPerfectGas:
+            // the (p,T) plan (level 0) calls the (p,h) one (level 1)
+            Mixing_Workspace::reserve(0, std::max(work_size_ph(nsca, nb_fluids),
+                                                  work_size_pT(nsca, nb_fluids))) ;
+            Mixing_Workspace::reserve(1, work_size_ph(nsca, nb_fluids)) ;
+            break ;
+        case MixingType::Unsupported:
+            break ;
+    }
+  }
+
   EOS_Error EOS_Mixing::compute(const EOS_Fields& input,
                                 EOS_Fields& r,
                                 EOS_Error_Field& errfield) const
@@ -208,22 +282,26 @@ namespace NEPTUNE_EOS
     //int nb_infields = input.size() ;
     // provisional for EOS_Mixing
 #ifdef WITH_PLUGIN_CATHARE2
-     ArrOfDouble tprxr  (nb_fluids - 1) ;
-     ArrOfDouble tprxcp0(nb_fluids - 1) ;
-     ArrOfDouble tprxcp1(nb_fluids - 1) ;
-     ArrOfDouble tprxcp2(nb_fluids - 1) ;
-     ArrOfDouble tprxcp3(nb_fluids - 1) ;
-     ArrOfDouble tprxcp4(nb_fluids - 1) ;
-     ArrOfDouble tprxcp5(nb_fluids - 1) ;
-     ArrOfDouble tprxcp6(nb_fluids - 1) ;
-     ArrOfDouble tprxm  (nb_fluids - 1) ;
-     ArrOfDouble tprxl0 (nb_fluids - 1) ;
-     ArrOfDouble tprxl1 (nb_fluids - 1) ;
-     ArrOfDouble tprxl2 (nb_fluids - 1) ;
-     ArrOfDouble tprxm0 (nb_fluids - 1) ;
-     ArrOfDouble tprxm1 (nb_fluids - 1) ;
-     ArrOfDouble tprxm2 (nb_fluids - 1) ;
-     ArrOfDouble tprxdv (nb_fluids - 1) ;
+     // mixing properties are views on the thread workspace
+     int nincon = nb_fluids - 1 ;
+     Mixing_Workspace wsp(16*nincon) ;
+     double* ws = wsp.get() ;
+     ArrOfDouble tprxr  (nincon, ws +  0*nincon) ;
+     ArrOfDouble tprxcp0(nincon, ws +  1*nincon) ;
+     ArrOfDouble tprxcp1(nincon, ws +  2*nincon) ;
+     ArrOfDouble tprxcp2(nincon, ws +  3*nincon) ;
+     ArrOfDouble tprxcp3(nincon, ws +  4*nincon) ;
+     ArrOfDouble tprxcp4(nincon, ws +  5*nincon) ;
+     ArrOfDouble tprxcp5(nincon, ws +  6*nincon) ;
+     ArrOfDouble tprxcp6(nincon, ws +  7*nincon) ;
+     ArrOfDouble tprxm  (nincon, ws +  8*nincon) ;
+     ArrOfDouble tprxl0 (nincon, ws +  9*nincon) ;
+     ArrOfDouble tprxl1 (nincon, ws + 10*nincon) ;
+     ArrOfDouble tprxl2 (nincon, ws + 11*nincon) ;
+     ArrOfDouble tprxm0 (nincon, ws + 12*nincon) ;
+     ArrOfDouble tprxm1 (nincon, ws + 13*nincon) ;
+     ArrOfDouble tprxm2 (nincon, ws + 14*nincon) ;
+     ArrOfDouble tprxdv (nincon, ws + 15*nincon) ;
      for (int i=1; i<nb_fluids; i++)
         {  if ((*the_fluids[i]).table_name() != AString("CathareIncondensableGas"))
               { errfield = EOS_Internal_Error::NOT_IMPLEMENTED ;
@@ -273,14 +351,16 @@ namespace NEPTUNE_EOS
         int nb_infields = input.size() ;
         if ((nb_infields >= 4) && (nb_infields <= 7) ) 
         { int nincx = 4 ;
-          ArrOfDouble tprxr(nincx)  ;
-          ArrOfDouble tprxcp(nincx) ;
-          ArrOfDouble tprxl0(nincx) ;
-          ArrOfDouble tprxl1(nincx) ;
-          ArrOfDouble tprxl2(nincx) ;
-          ArrOfDouble tprxm0(nincx) ;
-          ArrOfDouble tprxm1(nincx) ;
-          ArrOfDouble tprxm2(nincx) ;
+          Mixing_Workspace wsp(8*nincx) ;
+          double* ws = wsp.get() ;
+          ArrOfDouble tprxr (nincx, ws + 0*nincx) ;
+          ArrOfDouble tprxcp(nincx, ws + 1*nincx) ;
+          ArrOfDouble tprxl0(nincx, ws + 2*nincx) ;
+          ArrOfDouble tprxl1(nincx, ws + 3*nincx) ;
+          ArrOfDouble tprxl2(nincx, ws + 4*nincx) ;
+          ArrOfDouble tprxm0(nincx, ws + 5*nincx) ;
+          ArrOfDouble tprxm1(nincx, ws + 6*nincx) ;
+          ArrOfDouble tprxm2(nincx, ws + 7*nincx) ;
           for (int i=1; i<nb_fluids; i++)
              { tprxr(i-1)  = (*the_fluids[i]).get_prxr()  ;
                tprxcp(i-1) = (*the_fluids[i]).get_prxcp() ;
@@ -418,12 +498,17 @@ namespace NEPTUNE_EOS
       // algorithme complet c2
       //
 
+      // temporaries are views on the thread workspace (set to 0), no allocation per call
+      Mixing_Workspace wsp(work_size_ph(nsca, nb_fluids)) ;
+      double* ws = wsp.get() ;
+      auto work = [&ws](int n) { double* x = ws ; ws += n ; return x ; } ;
+
       // calcul Pv, hv = f(P, h)
-      ArrOfDouble xc0(nsca,0.e0);
-      ArrOfDouble xc1(nsca,0.e0);
-      ArrOfDouble xc2(nsca,0.e0);
-      ArrOfDouble xc3(nsca,0.e0);
-      ArrOfDouble xc4(nsca,0.e0);
+      ArrOfDouble xc0(nsca, work(nsca));
+      ArrOfDouble xc1(nsca, work(nsca));
+      ArrOfDouble xc2(nsca, work(nsca));
+      ArrOfDouble xc3(nsca, work(nsca));
+      ArrOfDouble xc4(nsca, work(nsca));
       EOS_Field C0("c_0","c_0",NEPTUNE::c_0,xc0);
       EOS_Field C1("c_1","c_1",NEPTUNE::c_1,xc1);
       EOS_Field C2("c_2","c_2",NEPTUNE::c_2,xc2);
@@ -436,9 +521,9 @@ namespace NEPTUNE_EOS
       if (ic[3] != -1) C3 = input[ic[3]];
       if (ic[4] != -1) C4 = input[ic[4]];
 
-      ArrOfDouble xPv(nsca);
+      ArrOfDouble xPv(nsca, work(nsca));
       EOS_Field Pv("Pv","p",NEPTUNE::p,xPv);
-      ArrOfDouble xhv(nsca);
+      ArrOfDouble xhv(nsca, work(nsca));
       EOS_Field hv("hv","h",NEPTUNE::h,xhv);
 
       for (int i=0; i<nsca; i++)
@@ -453,10 +538,10 @@ namespace NEPTUNE_EOS
       fsin_vap[1] = hv;
 
       // calcul saturation Tsat, Hsat = f(P)
-      ArrOfDouble xtsatp(nsca), xhlsatp(nsca), xhvsatp(nsca), xrholsatp(nsca);
-      ArrOfDouble xrhovsatp(nsca), xcplsatp(nsca), xcpvsatp(nsca);
-      ArrOfDouble xdtsatdp(nsca), xdhlsatdp(nsca), xdhvsatdp(nsca), xdrholsatdp(nsca);
-      ArrOfDouble xdrhovsatdp(nsca), xdcplsatdp(nsca), xdcpvsatdp(nsca), xd2tsatdp(nsca);
+      ArrOfDouble xtsatp(nsca, work(nsca)), xhlsatp(nsca, work(nsca)), xhvsatp(nsca, work(nsca)), xrholsatp(nsca, work(nsca));
+      ArrOfDouble xrhovsatp(nsca, work(nsca)), xcplsatp(nsca, work(nsca)), xcpvsatp(nsca, work(nsca));
+      ArrOfDouble xdtsatdp(nsca, work(nsca)), xdhlsatdp(nsca, work(nsca)), xdhvsatdp(nsca, work(nsca)), xdrholsatdp(nsca, work(nsca));
+      ArrOfDouble xdrhovsatdp(nsca, work(nsca)), xdcplsatdp(nsca, work(nsca)), xdcpvsatdp(nsca, work(nsca)), xd2tsatdp(nsca, work(nsca));
       EOS_Fields fsout_satp (15);
       EOS_Field tsatp ("out_satp1", "T_sat",NEPTUNE::T_sat, xtsatp);
       EOS_Field hlsatp ("out_satp2", "h_l_sat",NEPTUNE::h_l_sat, xhlsatp);
@@ -492,10 +577,10 @@ namespace NEPTUNE_EOS
       (*this)[0].fluid().compute(input[0],fsout_satp,errfield);
 
       // calcul saturation Tsatpv, Hsatpv = f(Pv)
-      ArrOfDouble xtsatpv(nsca), xhlsatpv(nsca), xhvsatpv(nsca), xrholsatpv(nsca);
-      ArrOfDouble xrhovsatpv(nsca), xcplsatpv(nsca), xcpvsatpv(nsca);
-      ArrOfDouble xdtsatdpv(nsca), xdhlsatdpv(nsca), xdhvsatdpv(nsca), xdrholsatdpv(nsca);
-      ArrOfDouble xdrhovsatdpv(nsca), xdcplsatdpv(nsca), xdcpvsatdpv(nsca), xd2tsatdpv(nsca);
+      ArrOfDouble xtsatpv(nsca, work(nsca)), xhlsatpv(nsca, work(nsca)), xhvsatpv(nsca, work(nsca)), xrholsatpv(nsca, work(nsca));
+      ArrOfDouble xrhovsatpv(nsca, work(nsca)), xcplsatpv(nsca, work(nsca)), xcpvsatpv(nsca, work(nsca));
+      ArrOfDouble xdtsatdpv(nsca, work(nsca)), xdhlsatdpv(nsca, work(nsca)), xdhvsatdpv(nsca, work(nsca)), xdrholsatdpv(nsca, work(nsca));
+      ArrOfDouble xdrhovsatdpv(nsca, work(nsca)), xdcplsatdpv(nsca, work(nsca)), xdcpvsatdpv(nsca, work(nsca)), xd2tsatdpv(nsca, work(nsca));
       EOS_Fields fsout_satpv (15);
       EOS_Field tsatpv ("out_satpv1", "T_sat",NEPTUNE::T_sat ,xtsatpv);
       EOS_Field hlsatpv ("out_satpv2", "h_l_sat",NEPTUNE::h_l_sat ,xhlsatpv);
@@ -531,10 +616,10 @@ namespace NEPTUNE_EOS
       (*this)[0].fluid().compute(fsin_vap[0],fsout_satpv,errfield);
 
       // calcul des proprietes vapeur
-      ArrOfDouble xtg(nsca),xdtgpv(nsca),xdtghv(nsca),xrv(nsca),xdrvpv(nsca),xdrvhv(nsca);
-      ArrOfDouble xcpv(nsca), xdcpvpv(nsca), xdcpvhv(nsca);
-      ArrOfDouble xlambdav(nsca), xdlambdavpv(nsca), xdlambdavhv(nsca);
-      ArrOfDouble xmuv(nsca), xdmuvpv(nsca), xdmuvhv(nsca), xsigma(nsca), xdsigmapv(nsca);
+      ArrOfDouble xtg(nsca, work(nsca)),xdtgpv(nsca, work(nsca)),xdtghv(nsca, work(nsca)),xrv(nsca, work(nsca)),xdrvpv(nsca, work(nsca)),xdrvhv(nsca, work(nsca));
+      ArrOfDouble xcpv(nsca, work(nsca)), xdcpvpv(nsca, work(nsca)), xdcpvhv(nsca, work(nsca));
+      ArrOfDouble xlambdav(nsca, work(nsca)), xdlambdavpv(nsca, work(nsca)), xdlambdavhv(nsca, work(nsca));
+      ArrOfDouble xmuv(nsca, work(nsca)), xdmuvpv(nsca, work(nsca)), xdmuvhv(nsca, work(nsca)), xsigma(nsca, work(nsca)), xdsigmapv(nsca, work(nsca));
       EOS_Fields fsout_vap (17);
       EOS_Field tg ("out_vap1", "T",NEPTUNE::T, xtg);
       EOS_Field dtgpv ("out_vap2", "d_T_d_p_h",NEPTUNE::d_T_d_p_h, xdtgpv);
@@ -577,27 +662,27 @@ namespace NEPTUNE_EOS
       //
       // Calcul des proprietes de melange
       //
-      ArrOfDouble xdpvdp(nsca), xdpvdh(nsca), xdhvdp(nsca), xdhvdh(nsca);
-      ArrOfDouble xdtgdp(nsca), xdtgdh(nsca), xrg(nsca), xdrgdp(nsca), xdrgdh(nsca), xdrvdp(nsca), xdrvdh(nsca);
-      ArrOfDouble xcpg(nsca), xdcpdp(nsca), xdcpdh(nsca);
-      ArrOfDouble xlambdag(nsca), xdlambdagdp(nsca), xdlambdagdh(nsca);
-      ArrOfDouble xmug(nsca), xdmudp(nsca), xdmudh(nsca), xdsigmadp(nsca), xdsigmadh(nsca);
-      ArrOfDouble xprgr(nsca), xxnc(nsca), xmnc(nsca), xrnc(nsca), xdncv(nsca), xddncv1(nsca), xddncv3(nsca);
+      ArrOfDouble xdpvdp(nsca, work(nsca)), xdpvdh(nsca, work(nsca)), xdhvdp(nsca, work(nsca)), xdhvdh(nsca, work(nsca));
+      ArrOfDouble xdtgdp(nsca, work(nsca)), xdtgdh(nsca, work(nsca)), xrg(nsca, work(nsca)), xdrgdp(nsca, work(nsca)), xdrgdh(nsca, work(nsca)), xdrvdp(nsca, work(nsca)), xdrvdh(nsca, work(nsca));
+      ArrOfDouble xcpg(nsca, work(nsca)), xdcpdp(nsca, work(nsca)), xdcpdh(nsca, work(nsca));
+      ArrOfDouble xlambdag(nsca, work(nsca)), xdlambdagdp(nsca, work(nsca)), xdlambdagdh(nsca, work(nsca));
+      ArrOfDouble xmug(nsca, work(nsca)), xdmudp(nsca, work(nsca)), xdmudh(nsca, work(nsca)), xdsigmadp(nsca, work(nsca)), xdsigmadh(nsca, work(nsca));
+      ArrOfDouble xprgr(nsca, work(nsca)), xxnc(nsca, work(nsca)), xmnc(nsca, work(nsca)), xrnc(nsca, work(nsca)), xdncv(nsca, work(nsca)), xddncv1(nsca, work(nsca)), xddncv3(nsca, work(nsca));
       // proprietes incondensables
-      ArrOfDouble px[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble hx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dpvdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dhvdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dtgdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble drgdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble drvdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dcpdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dlambdadx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dmudx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dsigmadx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble ddncvdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble drncdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
-      ArrOfDouble dmncdx[4] = {ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0),ArrOfDouble(nsca,0.e0)};
+      ArrOfDouble px[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble hx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dpvdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dhvdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dtgdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble drgdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble drvdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dcpdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dlambdadx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dmudx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dsigmadx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble ddncvdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble drncdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
+      ArrOfDouble dmncdx[4] = {ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca)),ArrOfDouble(nsca, work(nsca))};
       EOS_Field dpv1("dpvdp", "d_p_0_d_p_h", NEPTUNE::d_p_0_d_p_h, xdpvdp);
       EOS_Field dpv3("dpvdh", "d_p_0_d_h_p", NEPTUNE::d_p_0_d_h_p, xdpvdh);
       EOS_Field dhv1("dhvdp", "d_h_0_d_p_h", NEPTUNE::d_h_0_d_p_h, xdhvdp);
@@ -690,10 +775,12 @@ namespace NEPTUNE_EOS
       err = (*this)[0].fluid().get_mm(mm0);
       double fldr = rPerfectGas/mm0;
       double flddv = 13.1e0; //TODO : attention ! valable pour l'eau, quid des autres fluides ??
+      ArrOfDouble dncvj(nb_fluids, work(nb_fluids)) ;
+      ArrOfDouble c(nb_fluids, work(nb_fluids)) ;
+      assert(ws == wsp.get() + work_size_ph(nsca, nb_fluids)) ;
       for (int i=0; i<nsca; i++)
       {
-        ArrOfDouble dncvj(nb_fluids,0.e0) ;
-        ArrOfDouble c(nb_fluids) ;
+        dncvj = 0.e0 ;
         totab(c, C0[i] ,C1[i], C2[i], C3[i], C4[i]) ;
         //
         double mmj;
@@ -1242,11 +1329,16 @@ namespace NEPTUNE_EOS
     {
       //cout << "EOS_Mixing fields : plan pT" << endl;
 
-      ArrOfDouble xc0(nsca,0.e0);
-      ArrOfDouble xc1(nsca,0.e0);
-      ArrOfDouble xc2(nsca,0.e0);
-      ArrOfDouble xc3(nsca,0.e0);
-      ArrOfDouble xc4(nsca,0.e0);
+      // temporaries are views on the thread workspace (set to 0), no allocation per call
+      Mixing_Workspace wsp(work_size_pT(nsca, nb_fluids)) ;
+      double* ws = wsp.get() ;
+      auto work = [&ws](int n) { double* x = ws ; ws += n ; return x ; } ;
+
+      ArrOfDouble xc0(nsca, work(nsca));
+      ArrOfDouble xc1(nsca, work(nsca));
+      ArrOfDouble xc2(nsca, work(nsca));
+      ArrOfDouble xc3(nsca, work(nsca));
+      ArrOfDouble xc4(nsca, work(nsca));
       EOS_Field C0("c_0","c_0",NEPTUNE::c_0,xc0);
       EOS_Field C1("c_1","c_1",NEPTUNE::c_1,xc1);
       EOS_Field C2("c_2","c_2",NEPTUNE::c_2,xc2);
@@ -1259,7 +1351,7 @@ namespace NEPTUNE_EOS
       if (ic[3] != -1) C3 = input[ic[3]];
       if (ic[4] != -1) C4 = input[ic[4]];
 
-      ArrOfDouble xhg(nsca,0.e0);
+      ArrOfDouble xhg(nsca, work(nsca));
       EOS_Field hg("hg","h",NEPTUNE::h,xhg);
 
       EOS_Fields fsin_ph (nb_infields);
@@ -1271,7 +1363,7 @@ namespace NEPTUNE_EOS
       }
 
       // calcul saturation Tsatp,hvsatp = f(P)
-      ArrOfDouble xtsatp(nsca),xhvsatp(nsca);
+      ArrOfDouble xtsatp(nsca, work(nsca)),xhvsatp(nsca, work(nsca));
       EOS_Field tsatp("tsatp","T_sat",NEPTUNE::T_sat,xtsatp);
       EOS_Field hvsatp("hvsatp","h_v_sat",NEPTUNE::h_v_sat,xhvsatp);
 
@@ -1282,7 +1374,7 @@ namespace NEPTUNE_EOS
       (*this)[0].fluid().compute(input[iP],fsout_sat,errfield);
 
       // initialisation hg
-      ArrOfDouble c(nb_fluids) ;
+      ArrOfDouble c(nb_fluids, work(nb_fluids)) ;
       EOS_Internal_Error err ;
       for (int i=0; (i < nsca); i++)
       {
@@ -1302,7 +1394,8 @@ namespace NEPTUNE_EOS
       err =(*this)[0].fluid().get_h_max(hmax);
       //err =(*this)[0].fluid().get_h_min(hmin);
 
-      ArrOfDouble xtg(nsca),xdtg3(nsca);
+      ArrOfDouble xtg(nsca, work(nsca)),xdtg3(nsca, work(nsca));
+      assert(ws == wsp.get() + work_size_pT(nsca, nb_fluids)) ;
       EOS_Field tg("tg","T",NEPTUNE::T,xtg);
       EOS_Field dtg3("dtg3","d_T_d_h_p",NEPTUNE::d_T_d_h_p,xdtg3);
 
@@ -1381,7 +1474,9 @@ namespace NEPTUNE_EOS
   { T = 0.e0 ;
     double Ti = 0.e0 ;
     EOS_Internal_Error err = EOS_Internal_Error::OK ;
-    ArrOfDouble C(nb_fluids) ;
+    assert(nb_fluids <= 5) ;
+    double xC[5] = { 0., 0., 0., 0., 0. } ;
+    ArrOfDouble C(nb_fluids, xC) ;
     totab(C, C_0 ,C_1, C_2, C_3, C_4) ;
     for(int i=0; i<nb_fluids; i++)
        { EOS_Internal_Error err2 = (*this)[i].fluid().compute_T_ph(p, h, Ti) ;
@@ -1400,7 +1495,9 @@ namespace NEPTUNE_EOS
   int EOS_Mixing::compute_pv_hv_ph(double P, double h, double &Pv, double &hv,
                  double c_0, double c_1, double c_2, double c_3, double c_4) const
   {
-    ArrOfDouble c(nb_fluids) ;
+    assert(nb_fluids <= 5) ;
+    double xc[5] = { 0., 0., 0., 0., 0. } ;
+    ArrOfDouble c(nb_fluids, xc) ;
     totab(c, c_0 ,c_1, c_2, c_3, c_4) ;
     //
     // compute cpsum=sum(Ci*cpi)
@@ -1443,9 +1540,12 @@ namespace NEPTUNE_EOS
     // calcul saturation Tsatpv, Hsatpv = f(Pv)
     double Tsatpv, hvsatpv;
     int n=1;
-    ArrOfDouble xpv(n),xtsatpv(n),xhvsatpv(n);
-    ArrOfDouble xhv(n),xtg(n),xdtgpv(n),xdtghv(n),xrv(n),xdrvpv(n),xdrvhv(n);
-    ArrOfInt xerr(n);
+    // one point fields : views on local storage
+    double xw[10] ;
+    int xerr0 ;
+    ArrOfDouble xpv(n,xw),xtsatpv(n,xw+1),xhvsatpv(n,xw+2);
+    ArrOfDouble xhv(n,xw+3),xtg(n,xw+4),xdtgpv(n,xw+5),xdtghv(n,xw+6),xrv(n,xw+7),xdrvpv(n,xw+8),xdrvhv(n,xw+9);
+    ArrOfInt xerr(n,&xerr0);
     xpv[0]=Pv;
     EOS_Field fin_sat ("in_sat1", "p",NEPTUNE::p, xpv);
     EOS_Field fout_sat1 ("out_sat1", "T_sat",NEPTUNE::T_sat, xtsatpv);
@@ -1485,29 +1585,31 @@ namespace NEPTUNE_EOS
     int k;
     //int ierr;
     int nb_iter_max = 50 ;
+    // the fields of the Newton iterations are views on xpv, xhv, ...
+    // built once
+    EOS_Field fin_tmp1 ("in_tmp1", "p",NEPTUNE::p, xpv);
+    EOS_Field fin_tmp2 ("in_tmp2", "h",NEPTUNE::h, xhv);
+    EOS_Field fout_tmp1 ("out_tmp1", "T",NEPTUNE::T, xtg);
+    EOS_Field fout_tmp2 ("out_tmp2", "d_T_d_p_h",NEPTUNE::d_T_d_p_h, xdtgpv);
+    EOS_Field fout_tmp3 ("out_tmp3", "d_T_d_h_p",NEPTUNE::d_T_d_h_p, xdtghv);
+    EOS_Field fout_tmp4 ("out_tmp4", "rho",NEPTUNE::rho, xrv);
+    EOS_Field fout_tmp5 ("out_tmp5", "d_rho_d_p_h",NEPTUNE::d_rho_d_p_h, xdrvpv);
+    EOS_Field fout_tmp6 ("out_tmp6", "d_rho_d_h_p",NEPTUNE::d_rho_d_h_p, xdrvhv);
+    EOS_Error_Field ferr_tmp(xerr);
+
+    EOS_Fields fsin_tmp (2);
+    fsin_tmp[0] = fin_tmp1;
+    fsin_tmp[1] = fin_tmp2;
+    EOS_Fields fsout_tmp (6);
+    fsout_tmp[0] = fout_tmp1;
+    fsout_tmp[1] = fout_tmp2;
+    fsout_tmp[2] = fout_tmp3;
+    fsout_tmp[3] = fout_tmp4;
+    fsout_tmp[4] = fout_tmp5;
+    fsout_tmp[5] = fout_tmp6;
+
     for(k = 0; (k < nb_iter_max) && ((fabs(dpvr) > valp) || (fabs(dhvr) > valh)); k++) // Tests convergence
     {
-      EOS_Field fin_tmp1 ("in_tmp1", "p",NEPTUNE::p, xpv);
-      EOS_Field fin_tmp2 ("in_tmp2", "h",NEPTUNE::h, xhv);
-      EOS_Field fout_tmp1 ("out_tmp1", "T",NEPTUNE::T, xtg);
-      EOS_Field fout_tmp2 ("out_tmp2", "d_T_d_p_h",NEPTUNE::d_T_d_p_h, xdtgpv);
-      EOS_Field fout_tmp3 ("out_tmp3", "d_T_d_h_p",NEPTUNE::d_T_d_h_p, xdtghv);
-      EOS_Field fout_tmp4 ("out_tmp4", "rho",NEPTUNE::rho, xrv);
-      EOS_Field fout_tmp5 ("out_tmp5", "d_rho_d_p_h",NEPTUNE::d_rho_d_p_h, xdrvpv);
-      EOS_Field fout_tmp6 ("out_tmp6", "d_rho_d_h_p",NEPTUNE::d_rho_d_h_p, xdrvhv);
-      EOS_Error_Field ferr_tmp(xerr);
-
-      EOS_Fields fsin_tmp (2);
-      fsin_tmp[0] = fin_tmp1;
-      fsin_tmp[1] = fin_tmp2;
-      EOS_Fields fsout_tmp (6);
-      fsout_tmp[0] = fout_tmp1;
-      fsout_tmp[1] = fout_tmp2;
-      fsout_tmp[2] = fout_tmp3;
-      fsout_tmp[3] = fout_tmp4;
-      fsout_tmp[4] = fout_tmp5;
-      fsout_tmp[5] = fout_tmp6;
-
       (*this)[0].fluid().compute(fsin_tmp,fsout_tmp,ferr_tmp);
       Tg = xtg[0];
       dtgpv = xdtgpv[0];
@@ -23,6 +23,7 @@
 #include "EOS/API/EOS_Field.hxx"
 #include "EOS/API/EOS_Fields.hxx"
 #include "EOS/API/EOS_Config.hxx"
+#include <vector>
 #ifdef WITH_PLUGIN_CATHARE
 #include "EOS/Src/EOS_Cathare/CATHARE_Water.hxx"
 #endif
@@ -61,6 +62,7 @@ namespace NEPTUNE_EOS
       int set_alpha(int, double) ;
       double get_alpha(int) const ;
       // EOS_Fluid methods :
+      virtual bool is_thread_safe() const ;
       virtual EOS_Error compute( const EOS_Fields& input, 
                                  EOS_Field& r,
                                  EOS_Error_Field& errfield) const;
@@ -89,6 +91,9 @@ namespace NEPTUNE_EOS
                                      ) const ;
       virtual int compute_pv_hv_ph(double P, double h, double &Pv, double &hv,
                  double c_0, double c_1, double c_2, double c_3, double c_4) const;
+      //! pre-size the compute workspace of the calling thread for fields of
+      //! nsca points (call it from each thread, e.g. in a parallel region)
+      void reserve_workspace(int nsca) const ;
 
 //! use for surcharged operator<<
       void fluid_description(std::ostream& flux) const
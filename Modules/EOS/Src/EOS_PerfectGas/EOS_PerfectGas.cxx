@@ -18,11 +18,15 @@
 #include "EOS_PerfectGas.hxx"
 #include "EOS/API/EOS.hxx"
 #include "EOS/API/EOS_Field.hxx"
+#include "EOS/API/EOS_FieldView.hxx"
+#include "EOS/API/EOS_Error_Field.hxx"
 #include "Language/API/RegisterType.hxx"
 #include "Language/API/Types_Info.hxx"
 #include "EOS/API/EOS_Config.hxx"
 #include "EOS/API/EOS_eosdatadir.hxx"
+#include "EOS/API/EOS_Index.hxx"
 #include <fstream>
+#include <sstream>
 
 namespace NEPTUNE_EOS
 {
@@ -62,6 +66,15 @@ namespace NEPTUNE_EOS
   { return FluidStr ;
   }
 
+  // analytical laws : the computes do not modify the object
+  bool EOS_PerfectGas::is_thread_safe() const
+  { return true ;
+  }
+
+  bool EOS_PerfectGas::fuses_fields() const
+  { return false ;
+  }
+
   int EOS_PerfectGas::init(const Strings& strings)
   {
     FluidStr=AString("unknown") ;   
@@ -78,8 +91,11 @@ namespace NEPTUNE_EOS
          data_file_name += "/EOS_PerfectGas/" ;
          AString& file_name  = strings[0] ;
          data_file_name     += file_name ;
-         std::ifstream data_file(data_file_name.aschar()) ;
-         if (!data_file)
+         // file content read once per process, see EOS_Index
+         std::string data_content ;
+         int iread = EOS_Index::data_file(data_file_name.aschar(), data_content) ;
+         std::istringstream data_file(data_content) ;
+         if (!iread)
             { cerr << data_file_name << " not found!" << endl;
               assert(0) ;
               exit(-1)  ;
@@ -429,8 +445,11 @@ namespace NEPTUNE_EOS
          data_file_name += "/EOS_PerfectGas/" ;
          AString& file_name  = strings[0] ;
          data_file_name     += file_name ;
-         std::ifstream data_file(data_file_name.aschar()) ;
-         if (!data_file)
+         // file content read once per process, see EOS_Index
+         std::string data_content ;
+         int iread = EOS_Index::data_file(data_file_name.aschar(), data_content) ;
+         std::istringstream data_file(data_content) ;
+         if (!iread)
             { cerr << data_file_name << " not found!" << endl;
               assert(0) ;
               exit(-1)  ;
@@ -526,4 +545,78 @@ namespace NEPTUNE_EOS
     Tref = t ;
     Pref = p ;
   }
+
+  // - --- Fields --- -
+  // Same expressions as the point methods (EOS_PerfectGas_i.hxx) : same
+  // results, bit for bit. No branch in the loops, they vectorize.
+
+  bool EOS_PerfectGas::compute_ph_array(int prop, int n, const double* p, const double* h, double* res) const
+  { switch(prop)
+       { case NEPTUNE::T :
+            for (int i=0; i<n; i++)
+               res[i] = (h[i]-href)/cp + Tref ;
+            return true ;
+         case NEPTUNE::rho :
+            for (int i=0; i<n; i++)
+               { double T = (h[i]-href)/cp + Tref ;
+                 res[i] = p[i]/(r*T) ;
+               }
+            return true ;
+         case NEPTUNE::cp :
+            for (int i=0; i<n; i++)
+               res[i] = cp ;
+            return true ;
+         case NEPTUNE::mu :
+            for (int i=0; i<n; i++)
+               { double T = (h[i]-href)/cp + Tref ;
+                 res[i] = prxm0+T*(prxm1+T*prxm2) ;
+               }
+            return true ;
+         case NEPTUNE::lambda :
+            for (int i=0; i<n; i++)
+               { double T = (h[i]-href)/cp + Tref ;
+                 res[i] = prxl0+T*(prxl1+T*prxl2) ;
+               }
+            return true ;
+         default :
+            return false ;
+       }
+  }
+
+  EOS_Error EOS_PerfectGas::compute(const EOS_FieldView& p, 
+                                    const EOS_FieldView& h, 
+                                    EOS_FieldView& r, 
+                                    EOS_Error_Field& errfield) const
+  { const int sz     = p.size() ;
+    const int prop_r = r.get_property_number() ;
+    const bool in_T  = (h.get_property_number() == NEPTUNE::T) ;
+    if (   (p.get_property_number() != NEPTUNE::p)
+        || (!in_T && (h.get_property_number() != NEPTUNE::h))
+        || (p.get_stride() != 1) || (h.get_stride() != 1) || (r.get_stride() != 1)
+        || (in_T && (prop_r == NEPTUNE::T)) )
+       return EOS_Fluid::compute(p, h, r, errfield) ;
+
+    const double* pp = p.get_ptr() ;
+    const double* hh = h.get_ptr() ;
+    ArrOfDouble hh_data ;
+    if (in_T)
+       { // h(p,T) first, as EOS_Fluid::compute
+         if (prop_r != NEPTUNE::h)
+            { hh_data = ArrOfDouble(sz, LANGUAGE_KERNEL::uninitialized) ;
+              hh = hh_data.get_ptr() ;
+            }
+         double* ht = (prop_r == NEPTUNE::h) ? r.get_ptr() : (double*) hh ;
+         const double* tt = h.get_ptr() ;
+         for (int i=0; i<sz; i++)
+            ht[i] = href + cp*(tt[i] - Tref) ;
+         if (prop_r == NEPTUNE::h)
+            { errfield = EOS_Internal_Error::OK ;
+              return EOS_Error::good ;
+            }
+       }
+    if (!compute_ph_array(prop_r, sz, pp, hh, r.get_ptr()))
+       return EOS_Fluid::compute(p, h, r, errfield) ;
+    errfield = EOS_Internal_Error::OK ;
+    return EOS_Error::good ;
+  }
 }
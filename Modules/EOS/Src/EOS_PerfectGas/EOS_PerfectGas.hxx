@@ -39,6 +39,16 @@ namespace NEPTUNE_EOS
     virtual int init(const Strings&) ;
     virtual int init(const Strings&, const Strings&, double, double, double, double);
     virtual const AString& fluid_name() const ;
+    virtual bool is_thread_safe() const ;
+    //! false : the array kernels below replace the shared intermediates
+    virtual bool fuses_fields() const ;
+    using EOS_Fluid::compute ;
+    //! fields : closed-form laws evaluated on whole arrays (one loop per
+    //! property, no virtual call per point), EOS_Fluid::compute otherwise
+    virtual EOS_Error compute(const EOS_FieldView& p, 
+                              const EOS_FieldView& h, 
+                              EOS_FieldView& r, 
+                              EOS_Error_Field& errfield) const ;
     // molar mass (kg/mol)
     virtual EOS_Internal_Error get_mm(double&) const;
     //! T(p,h)               Temperature
@@ -112,6 +122,8 @@ namespace NEPTUNE_EOS
     double prxdv ;
     // Cathare-like perfect gas
   private:
+    //! r(p,h) on n points, false if the property is not closed-form
+    bool compute_ph_array(int prop, int n, const double* p, const double* h, double* r) const ;
     static int type_Id ;
     AString FluidStr ;
     double r     ;
@@ -679,8 +679,8 @@ namespace NEPTUNE_EOS
 
     EOS_Internal_Error err;
     double rhol, rhov, q, e, h, s, cv, cp, w;
-    double *x = new double[nbcomp];
-    double *y = new double[nbcomp];
+    double x[NBCOMPMAX];
+    double y[NBCOMPMAX];
 
     double p_refprop = pa2kpa(p);
     double rho = 0.e0;
@@ -696,8 +696,6 @@ namespace NEPTUNE_EOS
       (T, p_refprop, arr_molfrac, rho, rhol, rhov,
        x, y, q, e, h, s, cv, cp, w, ierr, herr, sizeof(herr)-1);
 
-    delete[] x;
-    delete[] y;
     if (ierr != 0)
       return generate_error(ierr, herr);
 
@@ -734,8 +732,8 @@ namespace NEPTUNE_EOS
   {
     EOS_Internal_Error err;
     double rho, rhol, rhov, q, e, h, T, cv, cp, w;
-    double *x = new double[nbcomp];
-    double *y = new double[nbcomp];
+    double x[NBCOMPMAX];
+    double y[NBCOMPMAX];
 
     double p_refprop = pa2kpa(p);
     double s_refprop = eos_nrj_2_refprop(s);
@@ -755,8 +753,6 @@ namespace NEPTUNE_EOS
      (p_refprop, s_refprop, arr_molfrac, T, rho, rhol, rhov, x, y, q, e, h, cv, cp, w,
       ierr, herr, sizeof(herr)-1);
 
-    delete[] x;
-    delete[] y;
     if (ierr != 0)
       return generate_error(ierr, herr);
 
@@ -776,53 +772,31 @@ namespace NEPTUNE_EOS
   EOS_Internal_Error EOS_Refprop9::call_phflsh(EOS_thermprop prop,
                                                 double p, double h, double& value) const
   {
-    EOS_Internal_Error err;
-    double t, rho, rhol, rhov, q, e, s, cv, cp, w;
-    double *xl = new double[nbcomp];
-    double *xv = new double[nbcomp];
-
-    double p_refprop = pa2kpa(p);
-    double h_refprop = eos_nrj_2_refprop(h);
-    int ierr;
-    char herr[HC255];
-    memset(herr, '\0', sizeof(herr));
-
-    ierr = 0;
+    double t, rho, e, s, cv, cp, w, q;
     value = 0.e0;
-
-    //... reset fluid with setup
-    err = callSetup();
-    if (err.generic_error() != EOS_Error::good)
+    EOS_Internal_Error err = call_phflsh(p, h, t, rho, e, s, cv, cp, w, q);
+    if (err != EOS_Internal_Error::OK)
       return err;
 
-    F77NAME(phflsh_rp9)
-       (p_refprop, h_refprop, arr_molfrac, t, rho, rhol, rhov, xl, xv, q, e, s, cv, cp, w,
-        ierr, herr, sizeof(herr)-1);
-
-    delete[] xl;
-    delete[] xv;
-    if (ierr != 0)
-      return generate_error(ierr, herr);
-
     switch (prop)
     {
     case NEPTUNE::T:
       value = t;
       break;
     case NEPTUNE::rho:
-      value = refprop_rho_2_eos(rho);
+      value = rho;
       break;
     case NEPTUNE::u:
-      value = refprop_nrj_2_eos(e);
+      value = e;
       break;
     case NEPTUNE::s:
-      value = refprop_nrj_2_eos(s);
+      value = s;
       break;
     case NEPTUNE::cp:
-      value = refprop_nrj_2_eos(cp);
+      value = cp;
       break;
     case NEPTUNE::cv:
-      value = refprop_nrj_2_eos(cv);
+      value = cv;
       break;
     case NEPTUNE::w:
       value = w;
@@ -835,6 +809,42 @@ namespace NEPTUNE_EOS
     return EOS_Internal_Error::OK;
   }
 
+  EOS_Internal_Error EOS_Refprop9::call_phflsh(double p, double h, double& t, double& rho,
+                                               double& e, double& s, double& cv, double& cp,
+                                               double& w, double& q) const
+  {
+    double rhol, rhov;
+    double xl[NBCOMPMAX];
+    double xv[NBCOMPMAX];
+
+    double p_refprop = pa2kpa(p);
+    double h_refprop = eos_nrj_2_refprop(h);
+    int ierr;
+    char herr[HC255];
+    memset(herr, '\0', sizeof(herr));
+
+    ierr = 0;
+
+    //... reset fluid with setup
+    EOS_Internal_Error err = callSetup();
+    if (err.generic_error() != EOS_Error::good)
+      return err;
+
+    F77NAME(phflsh_rp9)
+       (p_refprop, h_refprop, arr_molfrac, t, rho, rhol, rhov, xl, xv, q, e, s, cv, cp, w,
+        ierr, herr, sizeof(herr)-1);
+    if (ierr != 0)
+      return generate_error(ierr, herr);
+
+    rho = refprop_rho_2_eos(rho);
+    e   = refprop_nrj_2_eos(e);
+    s   = refprop_nrj_2_eos(s);
+    cv  = refprop_nrj_2_eos(cv);
+    cp  = refprop_nrj_2_eos(cp);
+
+    return EOS_Internal_Error::OK;
+  }
+
 
   EOS_Internal_Error EOS_Refprop9::call_dhd1(EOS_thermprop prop, 
                                               double p, double h, double& value) const
@@ -1341,7 +1351,7 @@ namespace NEPTUNE_EOS
     const int nb_fields = r.size();
     for (int k = 0; k < nb_fields; k++)
     {
-      EOS_Field rk = r[k];
+      const EOS_Field &rk = r[k];
       EOS_Property prop = rk.get_property_number();
       if (prop >= NEPTUNE::T)
         indic[0] = 1;
@@ -1489,10 +1499,14 @@ namespace NEPTUNE_EOS
       tab_prop[NEPTUNE::rho] = refprop_rho_2_eos(rho_refprop);
     }
 
-    F77NAME(therm2_rp9)
-     (T, rho_refprop, arr_molfrac, pi, e, h0, s, cv, cp, w, Z, hjt, A, G,
-      xkappa, beta, dPdrho, d2PdD2, dPT, drhodT, drhodP, spare1, spare2,
-      spare3, spare4);
+    // therm2 : u, s, cp, cv, w, beta and drhodT, drhodP for the derivatives
+    if (indic[1] == 1 || indic[5] == 1)
+    {
+      F77NAME(therm2_rp9)
+       (T, rho_refprop, arr_molfrac, pi, e, h0, s, cv, cp, w, Z, hjt, A, G,
+        xkappa, beta, dPdrho, d2PdD2, dPT, drhodT, drhodP, spare1, spare2,
+        spare3, spare4);
+    }
     if (indic[1] == 1)
     {
       tab_prop[NEPTUNE::u] = refprop_nrj_2_eos(e);
@@ -1705,8 +1719,8 @@ namespace NEPTUNE_EOS
           F77NAME(enthal_rp9)(t, rho_refprop, arr_molfrac, h);*/
 
     double rho, rhol, rhov, q, e, T, cv, cp, w;
-    double *x = new double[nbcomp];
-    double *y = new double[nbcomp];
+    double x[NBCOMPMAX];
+    double y[NBCOMPMAX];
 
     ierr = 0;
     F77NAME(psflsh_rp9)
@@ -1726,9 +1740,6 @@ namespace NEPTUNE_EOS
       err = worst_internal_error(err, generate_error(ierr, herr));
     tab_propder[NEPTUNE::d_h_d_p_s] = refprop_nrj_2_eos(hp - h) / delta;
 
-    delete[] x;
-    delete[] y;
-
     return err;
   }
 
@@ -1748,7 +1759,6 @@ namespace NEPTUNE_EOS
     vector<double> vec_propder(NUMAXPROP, 0.e0);
     double *tab_propder = &vec_propder[0];
     int indic[11];
-    EOS_Field rk;
     EOS_Property prop ;
     EOS_Property tab_pos[NBMAXFIELD], tab_posder[NBMAXFIELD] ;
 
@@ -1760,7 +1770,7 @@ namespace NEPTUNE_EOS
     // tab_pos sert a etablir une correspondance entre la liste de champs "r" et les proprietes
     for (int k = 0; k < nb_fields; k++)
     {
-      rk = r[k];
+      EOS_Field &rk = r[k];
       prop = rk.get_property_number() ;
       if (prop != NEPTUNE::NotATProperty)
       {
@@ -1791,7 +1801,7 @@ namespace NEPTUNE_EOS
         err = calrp_optim_pt(pp[i], hh[i], tab_prop, tab_propder, indic);
         for (int k = 0; k < nb_fields; k++)
         {
-          rk = r[k];
+          EOS_Field &rk = r[k];
           if (tab_pos[k] != NEPTUNE::NotATProperty)
             rk[i] = tab_prop[tab_pos[k]];
           else if (tab_posder[k] != NEPTUNE::NotATProperty)
@@ -1817,7 +1827,7 @@ namespace NEPTUNE_EOS
 
         for (int k = 0; k < nb_fields; k++)
         {
-          rk = r[k];
+          EOS_Field &rk = r[k];
           if (tab_pos[k] != NEPTUNE::NotATProperty)
             rk[i] = tab_prop[tab_pos[k]];
           else if (tab_posder[k] != NEPTUNE::NotATProperty)
@@ -1834,7 +1844,7 @@ namespace NEPTUNE_EOS
         err = calrp_optim_ps(pp[i], hh[i], tab_prop, tab_propder);
         for (int k = 0; k < nb_fields; k++)
         {
-          rk = r[k];
+          EOS_Field &rk = r[k];
           if (tab_pos[k] != NEPTUNE::NotATProperty)
             rk[i] = tab_prop[tab_pos[k]];
           else if (tab_posder[k] != NEPTUNE::NotATProperty)
@@ -1867,7 +1877,7 @@ namespace NEPTUNE_EOS
     const int nb_fields = r.size();
     for (int k = 0; k < nb_fields; k++)
     {
-      EOS_Field rk = r[k];
+      const EOS_Field &rk = r[k];
       EOS_Property prop = rk.get_property_number();
          if (prop >= NEPTUNE::firstSatProperty && prop <= NEPTUNE::lastSatProperty)
            indic[0] = 1;
@@ -2051,14 +2061,13 @@ namespace NEPTUNE_EOS
         return errfield.find_worst_error().generic_error();
 
       calrp_indic_sat_p(r, indic);
-      EOS_Field rk;
          EOS_Property prop ;
          EOS_Property tab_pos[NBMAXFIELD], tab_posder[NBMAXFIELD], tab_der2_pos[NBMAXFIELD] ;
 
       // tab_pos sert a etablir une correspondance entre la liste de champs "r" et les proprietes
       for (int k = 0; k < nb_fields; k++)
       {
-      rk = r[k];
+      EOS_Field &rk = r[k];
       prop = rk.get_property_number();
       if (prop >= NEPTUNE::firstSatProperty && prop <= NEPTUNE::lastSatProperty)
         { if (prop < EOS_TSATPROPDER)
@@ -2094,7 +2103,7 @@ namespace NEPTUNE_EOS
         errfield.set(i, err);
         for (int k = 0; k < nb_fields; k++)
         {
-          rk = r[k];
+          EOS_Field &rk = r[k];
           if (tab_pos[k] != NEPTUNE::NotASatProperty)
             rk[i] = tab_prop[tab_pos[k]];
           else if (tab_posder[k] != NEPTUNE::NotASatProperty)
@@ -2123,7 +2132,7 @@ namespace NEPTUNE_EOS
     const int nb_fields = r.size();
     for (int k = 0; k < nb_fields; k++)
     {
-      EOS_Field rk = r[k];
+      const EOS_Field &rk = r[k];
       EOS_Property prop = rk.get_property_number();
       indic[0] = 1;
       switch (prop)
@@ -350,6 +350,10 @@ namespace NEPTUNE_EOS
     //! call_phflsh : units of p, h  and value parameters : EOS unit
     EOS_Internal_Error call_phflsh(EOS_thermprop prop, double p, double h, double& value) const;
 
+    //! call_phflsh : one PHFLSH call, every output in EOS unit
+    EOS_Internal_Error call_phflsh(double p, double h, double& t, double& rho, double& e,
+                                   double& s, double& cv, double& cp, double& w, double& q) const;
+
     //! call_psflsh : call PSFLSH REFPROP subroutine
     //! call_psflsh : units of p, s  and value parameters : EOS unit
     EOS_Internal_Error call_psflsh(EOS_thermprop prop, double p, double s, double& value) const;
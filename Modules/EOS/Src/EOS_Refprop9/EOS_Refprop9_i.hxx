@@ -470,7 +470,7 @@ namespace NEPTUNE_EOS
   inline EOS_Internal_Error EOS_Refprop9::compute_sigma_pT(double p, double T, double& sigma) const
   { EOS_Internal_Error err ;
     double rho, rhol, rhov, q, e, h, s, cv, cp, w;
-    std::vector<double> xl(nbcomp), xv(nbcomp);
+    double xl[NBCOMPMAX], xv[NBCOMPMAX] ;
 
     double p_refprop = pa2kpa(p) ;
 
@@ -482,10 +482,10 @@ namespace NEPTUNE_EOS
     char herr[HC255];
     memset(herr, '\0', sizeof(herr));
     
-    F77NAME(tpflsh_rp9)(T,p_refprop,arr_molfrac, rho, rhol, rhov, xl.data(), xv.data(), q, e, h, s, cv, cp, w, ierr, herr, sizeof(herr));
+    F77NAME(tpflsh_rp9)(T,p_refprop,arr_molfrac, rho, rhol, rhov, xl, xv, q, e, h, s, cv, cp, w, ierr, herr, sizeof(herr));
     if (ierr!=0)  return generate_error(ierr, herr) ;
 
-    F77NAME(surten_rp9)(T,rhol,rhov,xl.data(),xv.data(),sigma,ierr,herr, sizeof(herr));
+    F77NAME(surten_rp9)(T,rhol,rhov,xl,xv,sigma,ierr,herr, sizeof(herr));
     if (ierr!=0)  return generate_error(ierr, herr) ;
 
     return EOS_Internal_Error::OK ;
@@ -555,10 +555,8 @@ namespace NEPTUNE_EOS
 
     lambda = 0.e0 ;
 
-    err = call_phflsh(EOS_thermprop::rho, p, h, rho) ;
-    if (err.generic_error() == EOS_Error::bad)  return err ;
-
-    err = call_phflsh(EOS_thermprop::T, p, h, t) ;
+    double e, s, cv, cp, w, q ;
+    err = call_phflsh(p, h, t, rho, e, s, cv, cp, w, q) ;
     if (err.generic_error() == EOS_Error::bad)  return err ;
 
     int ierr;
@@ -578,11 +576,9 @@ namespace NEPTUNE_EOS
         double hjt,A, G, xkappa,dPdrho,d2PdD2,dPT,drhodT,drhodP,spare1,spare2,spare3, spare4;
     EOS_Internal_Error err ;
 
-    err = call_phflsh(EOS_thermprop::rho, p, h, rho) ;
-    if (err.generic_error() == EOS_Error::bad)  return err;
-
-    err = call_phflsh(EOS_thermprop::T, p, h, t);
-    if (err.generic_error() == EOS_Error::bad)  return err;
+    double q ;
+    err = call_phflsh(p, h, t, rho, e, s, cv, cp, w, q) ;
+    if (err.generic_error() == EOS_Error::bad)  return err ;
 
     rho = eos_rho_2_refprop(rho) ;
     F77NAME(therm2_rp9)(t,rho,arr_molfrac,pi,e,h,s,cv,cp,w, Z, hjt,A, G, xkappa, beta,
@@ -598,10 +594,8 @@ namespace NEPTUNE_EOS
     EOS_Internal_Error err ;
     mu = 0.e0 ;
 
-    err = call_phflsh(EOS_thermprop::rho, p, h, rho) ;
-    if (err.generic_error() == EOS_Error::bad)  return err ;
-
-    err = call_phflsh(EOS_thermprop::T, p, h, t) ;
+    double e, s, cv, cp, w, q ;
+    err = call_phflsh(p, h, t, rho, e, s, cv, cp, w, q) ;
     if (err.generic_error() == EOS_Error::bad)  return err ;
 
     int ierr;
@@ -620,7 +614,7 @@ namespace NEPTUNE_EOS
   EOS_Refprop9::compute_sigma_ph(double p, double h, double& sigma) const
   { EOS_Internal_Error err ;
     double t, rho, rhol, rhov, q, e, s, cv, cp, w;
-    std::vector<double> xl(nbcomp), xv(nbcomp) ;
+    double xl[NBCOMPMAX], xv[NBCOMPMAX] ;
 
     double p_refprop = pa2kpa(p) ;
     double h_refprop = eos_nrj_2_refprop(h) ;
@@ -633,10 +627,10 @@ namespace NEPTUNE_EOS
     char herr[HC255];
     memset(herr, '\0', sizeof(herr));
     
-    F77NAME(phflsh_rp9)(p_refprop,h_refprop, arr_molfrac, t, rho, rhol, rhov, xl.data(), xv.data(), q, e, s, cv, cp, w, ierr, herr, sizeof(herr)) ;
+    F77NAME(phflsh_rp9)(p_refprop,h_refprop, arr_molfrac, t, rho, rhol, rhov, xl, xv, q, e, s, cv, cp, w, ierr, herr, sizeof(herr)) ;
     if (ierr!=0) return generate_error(ierr, herr) ;
 
-    F77NAME(surten_rp9)(t,rhol,rhov,xl.data(),xv.data(),sigma,ierr,herr, sizeof(herr)) ;
+    F77NAME(surten_rp9)(t,rhol,rhov,xl,xv,sigma,ierr,herr, sizeof(herr)) ;
     if (ierr!=0) return generate_error(ierr, herr) ;
 
     return EOS_Internal_Error::OK ;
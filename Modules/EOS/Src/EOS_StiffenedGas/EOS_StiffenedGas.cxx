@@ -18,11 +18,15 @@
 #include "EOS_StiffenedGas.hxx"
 #include "EOS/API/EOS.hxx"
 #include "EOS/API/EOS_Field.hxx"
+#include "EOS/API/EOS_FieldView.hxx"
+#include "EOS/API/EOS_Error_Field.hxx"
 #include "Language/API/RegisterType.hxx"
 #include "Language/API/Types_Info.hxx"
 #include "EOS/API/EOS_Config.hxx"
 #include "EOS/API/EOS_eosdatadir.hxx"
+#include "EOS/API/EOS_Index.hxx"
 #include <fstream>
+#include <sstream>
 
 namespace NEPTUNE_EOS
 {
@@ -60,6 +64,15 @@ namespace NEPTUNE_EOS
   const AString& EOS_StiffenedGas::fluid_name() const
   { return FluidStr ;
   }
+
+  // analytical laws : the computes do not modify the object
+  bool EOS_StiffenedGas::is_thread_safe() const
+  { return true ;
+  }
+
+  bool EOS_StiffenedGas::fuses_fields() const
+  { return false ;
+  }
   
   int EOS_StiffenedGas::init(const Strings& strings)
   { FluidStr = AString("Unknown") ;
@@ -72,8 +85,11 @@ namespace NEPTUNE_EOS
          AString& file_name = strings[0] ;
          data_file_name += file_name ;
          int iok = 0 ;
-         std::ifstream data_file(data_file_name.aschar()) ;
-         if (!data_file)
+         // file content read once per process, see EOS_Index
+         std::string data_content ;
+         int iread = EOS_Index::data_file(data_file_name.aschar(), data_content) ;
+         std::istringstream data_file(data_content) ;
+         if (!iread)
             { cerr << data_file_name << " not found!" << endl ;
               assert(0) ;
               exit(-1)  ;
@@ -212,4 +228,172 @@ namespace NEPTUNE_EOS
          return EOS_Error::error ;
        }
   }
+
+  // - --- Fields --- -
+  // Same expressions as the point methods (EOS_StiffenedGas_i.hxx) : same
+  // results, bit for bit. No branch in the loops, they vectorize.
+
+  bool EOS_StiffenedGas::compute_ph_array(int prop, int n, const double* p, const double* h, double* r) const
+  { const double gcv  = SGgamma*SGcv ;
+    const double g1cv = (SGgamma-1.e0)*SGcv ;
+    switch(prop)
+       { case NEPTUNE::T :
+            for (int i=0; i<n; i++)
+               r[i] = (h[i]-SGq)/gcv ;
+            return true ;
+         case NEPTUNE::rho :
+            for (int i=0; i<n; i++)
+               { double T = (h[i]-SGq)/gcv ;
+                 r[i] = (p[i]+SGpinf)/(g1cv*T) ;
+               }
+            return true ;
+         case NEPTUNE::u :
+            for (int i=0; i<n; i++)
+               { double T   = (h[i]-SGq)/gcv ;
+                 double rho = (p[i]+SGpinf)/(g1cv*T) ;
+                 r[i] = (p[i]+SGgamma*SGpinf)/(rho*(SGgamma-1.e0))+SGq ;
+               }
+            return true ;
+         case NEPTUNE::s :
+            for (int i=0; i<n; i++)
+               { double T = (h[i]-SGq)/gcv ;
+                 double s = pow(T,SGgamma)/pow(p[i]+SGpinf,SGgamma-1.e0) ;
+                 r[i] = SGcv*log(s)+SGqp ;
+               }
+            return true ;
+         case NEPTUNE::w :
+            for (int i=0; i<n; i++)
+               { double T = (h[i]-SGq)/gcv ;
+                 r[i] = pow(SGgamma*(SGgamma-1.e0)*SGcv*T,0.5e0) ;
+               }
+            return true ;
+         case NEPTUNE::cp :
+            for (int i=0; i<n; i++)
+               r[i] = SGcp ;
+            return true ;
+         case NEPTUNE::d_cp_d_p_h :
+         case NEPTUNE::d_cp_d_h_p :
+            for (int i=0; i<n; i++)
+               r[i] = 0.e0 ;
+            return true ;
+         default :
+            return false ;
+       }
+  }
+
+  EOS_Error EOS_StiffenedGas::compute(const EOS_FieldView& p, 
+                                      const EOS_FieldView& h, 
+                                      EOS_FieldView& r, 
+                                      EOS_Error_Field& errfield) const
+  { const int sz     = p.size() ;
+    const int prop_r = r.get_property_number() ;
+    const bool in_T  = (h.get_property_number() == NEPTUNE::T) ;
+    if (   (p.get_property_number() != NEPTUNE::p)
+        || (!in_T && (h.get_property_number() != NEPTUNE::h))
+        || (p.get_stride() != 1) || (h.get_stride() != 1) || (r.get_stride() != 1)
+        || (in_T && (prop_r == NEPTUNE::T)) )
+       return EOS_Fluid::compute(p, h, r, errfield) ;
+
+    const double* pp = p.get_ptr() ;
+    const double* hh = h.get_ptr() ;
+    ArrOfDouble hh_data ;
+    if (in_T)
+       { // h(p,T) first, as EOS_Fluid::compute
+         if (prop_r != NEPTUNE::h)
+            { hh_data = ArrOfDouble(sz, LANGUAGE_KERNEL::uninitialized) ;
+              hh = hh_data.get_ptr() ;
+            }
+         double* ht = (prop_r == NEPTUNE::h) ? r.get_ptr() : (double*) hh ;
+         const double* tt = h.get_ptr() ;
+         for (int i=0; i<sz; i++)
+            ht[i] = SGgamma*SGcv*tt[i]+SGq ;
+         if (prop_r == NEPTUNE::h)
+            { errfield = EOS_Internal_Error::OK ;
+              return EOS_Error::good ;
+            }
+       }
+    if (!compute_ph_array(prop_r, sz, pp, hh, r.get_ptr()))
+       return EOS_Fluid::compute(p, h, r, errfield) ;
+    errfield = EOS_Internal_Error::OK ;
+    return EOS_Error::good ;
+  }
+
+  // Newton of compute_T_sat_p on the n points together : a point stops
+  // as soon as it has converged, the loop stops when they all have
+  // (a NaN iterate never converges, as in compute_T_sat_p).
+  void EOS_StiffenedGas::compute_T_sat_array(int n, const double* p, double* T, int* ok) const
+  { const int nb_iter_max = 50 ;
+    const double epsn = 1.e-3 ;
+    double v[sat_block] ;
+    double func[sat_block] ;
+    assert(n <= sat_block) ;
+    for (int i=0; i<n; i++)
+       { v[i]    = log(p[i]+SGpinfv)-SGd*log(p[i]+SGpinfl)-SGa ;
+         func[i] = 1.e0 ;
+         T[i]    = 300.e0 ;
+       }
+    for (int iteration_Newton=0; iteration_Newton<nb_iter_max; iteration_Newton++)
+       { int nb_active = 0 ;
+         for (int i=0; i<n; i++)
+            { const bool active = !(fabs(func[i]) <= epsn) ;
+              double f  = SGb/T[i]+SGc*log(T[i])-v[i] ;
+              double df = (SGc - SGb/T[i])/T[i] ;
+              func[i] = active ? f : func[i] ;
+              T[i]    = active ? T[i]+(-f/df) : T[i] ;
+              nb_active += active ;
+            }
+         if (nb_active == 0)  break ;
+       }
+    for (int i=0; i<n; i++)
+       ok[i] = (fabs(func[i]) <= epsn) ;
+  }
+
+  EOS_Error EOS_StiffenedGas::compute(const EOS_FieldView& p,
+                                      EOS_FieldView& r, 
+                                      EOS_Error_Field& errfield) const
+  { const int prop_r = r.get_property_number() ;
+    const bool sat =    (prop_r == NEPTUNE::T_sat)
+                     || (prop_r == NEPTUNE::h_l_sat)   || (prop_r == NEPTUNE::h_v_sat)
+                     || (prop_r == NEPTUNE::rho_l_sat) || (prop_r == NEPTUNE::rho_v_sat) ;
+    if (   !sat
+        || (   (p.get_property_number() != NEPTUNE::p) 
+            && (p.get_property_number() != NEPTUNE::p_sat)
+            && (p.get_property_number() != NEPTUNE::p_lim) ) )
+       return EOS_Fluid::compute(p, r, errfield) ;
+
+    const int sz = p.size() ;
+    double pb[sat_block] ;
+    double T[sat_block] ;
+    int    ok[sat_block] ;
+    for (int b=0; b<sz; b+=sat_block)
+       { const int n = (sz-b < sat_block) ? sz-b : sat_block ;
+         for (int i=0; i<n; i++)
+            pb[i] = p[b+i] ;
+         compute_T_sat_array(n, pb, T, ok) ;
+         for (int i=0; i<n; i++)
+            { // as the point methods : T unchanged (1) if no convergence
+              const double Ts = ok[i] ? T[i] : 1.e0 ;
+              const double pi = pb[i] ;
+              switch(prop_r)
+                 { case NEPTUNE::T_sat :
+                      if (ok[i])  r[b+i] = Ts ;
+                      break ;
+                   case NEPTUNE::h_l_sat :
+                      r[b+i] = SGgammal*SGcvl*Ts+SGql ;
+                      break ;
+                   case NEPTUNE::h_v_sat :
+                      r[b+i] = SGgammav*SGcvv*Ts+SGqv ;
+                      break ;
+                   case NEPTUNE::rho_l_sat :
+                      r[b+i] = (pi+SGpinfl)/((SGgammal-1.e0)*SGcvl*Ts) ;
+                      break ;
+                   default :
+                      r[b+i] = (pi+SGpinfv)/((SGgammav-1.e0)*SGcvv*Ts) ;
+                      break ;
+                 }
+              errfield.set(b+i, ok[i] ? EOS_Internal_Error::OK : STIFF_GAS_NEWTON_FAILED) ;
+            }
+       }
+    return errfield.find_worst_error().generic_error() ;
+  }
 }
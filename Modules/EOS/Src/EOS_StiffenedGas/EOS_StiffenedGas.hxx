@@ -37,6 +37,21 @@ namespace NEPTUNE_EOS
     
     virtual int init(const Strings&) ;
     virtual const AString& fluid_name() const ;
+    virtual bool is_thread_safe() const ;
+    //! false : the array kernels below replace the shared intermediates
+    virtual bool fuses_fields() const ;
+    using EOS_Fluid::compute ;
+    //! fields : closed-form laws evaluated on whole arrays (one loop per
+    //! property, no virtual call per point), EOS_Fluid::compute otherwise
+    virtual EOS_Error compute(const EOS_FieldView& p, 
+                              const EOS_FieldView& h, 
+                              EOS_FieldView& r, 
+                              EOS_Error_Field& errfield) const ;
+    //! fields : saturation from T_sat(p) computed by a Newton on all the
+    //! points at once, EOS_Fluid::compute otherwise
+    virtual EOS_Error compute(const EOS_FieldView& p,
+                              EOS_FieldView& r, 
+                              EOS_Error_Field& errfield) const ;
     //! T_sat(p)           Temperature at saturation
     virtual EOS_Internal_Error compute_T_sat_p(double p, double& Tsat) const;
     //! d(T_sat)/dp (p)    at constant specific enthalpy
@@ -121,6 +136,11 @@ namespace NEPTUNE_EOS
     //virtual int can_compute(const char* const property_name) const;
 
     private: 
+    //! r(p,h) on n points, false if the property is not closed-form
+    bool compute_ph_array(int prop, int n, const double* p, const double* h, double* r) const ;
+    //! T_sat(p) on n points (n <= sat_block), ok[i]=0 if no convergence
+    void compute_T_sat_array(int n, const double* p, double* T, int* ok) const ;
+    static const int sat_block = 64 ;
     static int type_Id ;
     AString FluidStr ;
     double SGpinfl, SGcpl, SGcvl, SGgammal, SGql, SGqpl ;
@@ -79,15 +79,16 @@ namespace NEPTUNE_EOS
     double v = log(p+SGpinfv)-SGd*log(p+SGpinfl)-SGa ;
     double T = 300.e0 ;
 
+    // !(|func| <= epsn) : a NaN iterate (no root, p out of range) is not converged
     for(iteration_Newton = 0;
-        (iteration_Newton < nb_iter_max) && (fabs(func) > epsn); 
+        (iteration_Newton < nb_iter_max) && !(fabs(func) <= epsn); 
         iteration_Newton++ ) 
       { func   = SGb/T+SGc*log(T)-v ;
         dfunc  = (SGc - SGb/T)/T ;
         deltaT = -func/dfunc ;
         T      = T+deltaT ;
       }
-    if (iteration_Newton>=nb_iter_max && (fabs(func) > epsn) )  return STIFF_GAS_NEWTON_FAILED ;
+    if (!(fabs(func) <= epsn))  return STIFF_GAS_NEWTON_FAILED ;
     Tsat = T ;
     return EOS_Internal_Error::OK ;
   }
@@ -17,12 +17,155 @@
 
 #include "EOS/API/EOS.hxx"
 #include "EOS/API/EOS_Fields.hxx"
+#include "EOS/API/EOS_FieldView.hxx"
 #include "EOS/API/EOS_Error_Field.hxx"
 #include "EOS/API/EOS_Std_Error_Handler.hxx"
+#include "EOS/API/EOS_Fluid.hxx"
 #include <stdio.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
 
 using namespace NEPTUNE; 
 
+// Small closed-form fluid with a tabulated pr (not mu*cp/lambda), as
+// EOS_Ipp : compute(p, h, EOS_Fields&) must keep its compute_pr_ph
+class Test_Pr_Fluid : public EOS_Fluid
+{ public :
+    Test_Pr_Fluid() {}
+    const Type_Info& get_Type_Info() const
+    { return (Types_Info::instance())[type_Id] ;
+    }
+    ostream& print_On(ostream& stream) const
+    { return stream ;
+    }
+    istream& read_On(istream& stream)
+    { return stream ;
+    }
+    EOS_Internal_Error compute_T_ph(double p, double h, double& r) const
+    { if (h <= 0.e0)  return EOS_Internal_Error::EOS_BAD_COMPUTE ;
+      r = h/1.e3 ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_h_pT(double p, double T, double& r) const
+    { r = 1.e3*T ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_rho_ph(double p, double h, double& r) const
+    { r = p*1.e3/(287.e0*h) ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_mu_ph(double p, double h, double& r) const
+    { r = 1.e-5*(1.e0 + h*1.e-6) ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_cp_ph(double p, double h, double& r) const
+    { r = 1.e3 ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_lambda_ph(double p, double h, double& r) const
+    { r = 2.e-2 + h*1.e-8 ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_pr_ph(double p, double h, double& r) const
+    { r = 0.7e0 + h*1.e-9 ;
+      return EOS_Internal_Error::OK ;
+    }
+    EOS_Internal_Error compute_d_rho_d_T_p_pT(double p, double T, double& r) const
+    { r = -p/(287.e0*T*T) ;
+      return EOS_Internal_Error::OK ;
+    }
+  private :
+    static int type_Id ;
+} ;
+
+static RegisteredClass& Test_Pr_Fluid_create()
+{ return *(new Test_Pr_Fluid()) ;
+}
+
+int Test_Pr_Fluid::type_Id = (RegisterType("Test_Pr_Fluid", "EOS_Fluid",
+                              "closed-form fluid with a tabulated pr",
+                              sizeof(Test_Pr_Fluid),
+                              Test_Pr_Fluid_create)) ;
+
+// One property on n points by EOS_FieldView (block kernels of the
+// fluid) and point by point (compute_*_ph, compute_*_sat_p) : number of
+// points whose value (NaN included) or generic error code differ.
+// h == NULL : saturation property of p.
+static int compare_block_point(const EOS& eos, const char* const prop,
+                               int n, double* p, double* h)
+{ vector<double> xb(n, -1.e0), xs(n, -1.e0) ;
+  vector<int>    xe(n) ;
+  const EOS_Property iprop = EOS::property_number(prop) ;
+  const EOS_FieldView vp(NEPTUNE::p, n, p) ;
+  EOS_FieldView vr(iprop, n, &xb[0]) ;
+  EOS_Error_Field ef(n, &xe[0]) ;
+  if (h)
+     { const EOS_FieldView vh(NEPTUNE::h, n, h) ;
+       eos.compute(vp, vh, vr, ef) ;
+     }
+  else
+     eos.compute(vp, vr, ef) ;
+  int ndiff = 0 ;
+  for (int i=0; i<n; i++)
+     { EOS_Error cr = h ? eos.compute(prop, p[i], h[i], xs[i])
+                        : eos.compute(prop, p[i], xs[i]) ;
+       const bool same = (xb[i] == xs[i]) || (std::isnan(xb[i]) && std::isnan(xs[i])) ;
+       if (!same || (ef[i].generic_error() != cr))
+          { if (ndiff == 0)
+               cout << " " << prop << "[" << i << "](differ : "
+                    << xb[i] << "/" << xs[i] << ")" ;
+            ndiff++ ;
+          }
+     }
+  return ndiff ;
+}
+
+#ifdef WITH_PLUGIN_CATHARE2
+// nf properties on np points computed together (the last one a transport
+// property : full CATHARE2 pipeline) and one at a time (calc2_needs prunes
+// fhpfld, ftliqfld, ftrafld, calc2_lim) : number of differences, values of
+// the points not in error and error of the points (worst of the singles)
+static int compare_fused_single(const EOS& eos, const EOS_Field& fp,
+                                const EOS_Field& fx, int nf,
+                                const char* const* xnm, int np)
+{ vector<double> xr(nf*np), xs(np) ;
+  vector<int>    xe(np), xes(np), xew(np) ;
+  EOS_Fields fr(nf) ;
+  for (int k=0; k<nf; k++)
+     fr[k] = EOS_Field(xnm[k], xnm[k], np, &xr[k*np]) ;
+  EOS_Error_Field ef(np, &xe[0]) ;
+  EOS_Error_Field efs(np, &xes[0]) ;
+  EOS_Error_Field efw(np, &xew[0]) ;
+  EOS_Error crf = eos.compute(fp, fx, fr, ef) ;
+  EOS_Error crw = EOS_Error::good ;
+  efw = EOS_Internal_Error::OK ;
+  int ndiff = 0 ;
+  for (int k=0; k<nf; k++)
+     { EOS_Field fs(xnm[k], xnm[k], np, &xs[0]) ;
+       crw = worst_generic_error(crw, eos.compute(fp, fx, fs, efs)) ;
+       efw.set_worst_error(efs) ;
+       for (int i=0; i<np; i++)
+          if ((efs[i].generic_error() < EOS_Error::bad) && (xs[i] != xr[k*np+i]))
+             { if (ndiff == 0)
+                  cout << " " << xnm[k] << "[" << i << "](differ : "
+                       << xr[k*np+i] << "/" << xs[i] << ")" ;
+               ndiff++ ;
+             }
+     }
+  for (int i=0; i<np; i++)
+     if (ef[i] != efw[i])
+        { cout << " err[" << i << "](differ)" ;
+          ndiff++ ;
+        }
+  if (crf != crw)
+     { cout << " cr(differ : " << crf << "/" << crw << ")" ;
+       ndiff++ ;
+     }
+  return ndiff ;
+}
+#endif
+
 
 const char *list_prop1[] = {
   "p",
@@ -741,6 +884,118 @@ int main()
     cr=gas.compute_cp_ph(1.e5,1.e6,cp);
     cout<<"[cr="<<cr<<"] cp : " << cp << endl;
 
+    // EOS_FieldView : (p,h) interlaced in one array (stride 2)
+    { double xph[6] = { 1.e5, 1.e6, 2.e5, 1.1e6, 3.e5, 1.2e6 } ;
+      double xtv[3], xtf[3] ;
+      double xpf[3] = { xph[0], xph[2], xph[4] } ;
+      double xhf[3] = { xph[1], xph[3], xph[5] } ;
+      int    xev[3], xef[3] ;
+      const EOS_FieldView vp(NEPTUNE::p, 3, xph,   2) ;
+      const EOS_FieldView vh(NEPTUNE::h, 3, xph+1, 2) ;
+      EOS_FieldView vt(NEPTUNE::T, 3, xtv) ;
+      EOS_Error_Field ev(3, xev) ;
+      EOS_Error crv = gas.compute(vp, vh, vt, ev) ;
+      EOS_Field fp("Pressure", "p", NEPTUNE::p, 3, xpf) ;
+      EOS_Field fh("Enthalpy", "h", NEPTUNE::h, 3, xhf) ;
+      EOS_Field ft("Temperature", "T", NEPTUNE::T, 3, xtf) ;
+      EOS_Error_Field ef(3, xef) ;
+      EOS_Error crf = gas.compute(fp, fh, ft, ef) ;
+      cout<<"[cr="<<crv<<"/"<<crf<<"] T view/field :" ;
+      for (int i=0; i<3; i++)
+         cout << " " << xtv[i] << "/" << xtf[i] << (xtv[i] == xtf[i] ? "" : " (differ)") ;
+      cout << endl ;
+    }
+
+    // EOS_Fields : fused evaluation against one field at a time
+    { const int nf = 6 ;
+      const char* const xnm[nf] = { "T", "mu", "cp", "lambda", "pr", "d_rho_d_T_p" } ;
+      double xp[3] = { 1.e5, 2.e5, 3.e5 } ;
+      double xt[3] = { 300., 400., 500. } ;
+      double xr[nf][3], xs[3] ;
+      int    xe[3], xes[3] ;
+      EOS_Field fp("Pressure", "p", NEPTUNE::p, 3, xp) ;
+      EOS_Field ft("Temperature", "T", NEPTUNE::T, 3, xt) ;
+      EOS_Fields fr(nf) ;
+      for (int k=0; k<nf; k++)
+         fr[k] = EOS_Field(xnm[k], xnm[k], 3, xr[k]) ;
+      EOS_Error_Field ef(3, xe) ;
+      EOS_Error_Field efs(3, xes) ;
+      EOS_Error crf = gas.compute(fp, ft, fr, ef) ;
+      cout<<"[cr="<<crf<<"] fused/single (p,T) :" ;
+      for (int k=0; k<nf; k++)
+         { EOS_Field fs(xnm[k], xnm[k], 3, xs) ;
+           gas.compute(fp, ft, fs, efs) ;
+           for (int i=0; i<3; i++)
+              if (xs[i] != xr[k][i])  cout << " " << xnm[k] << "(differ)" ;
+         }
+      cout << endl ;
+    }
+
+    // EOS_Fields : fused evaluation keeps the per-point overrides (pr)
+    { Test_Pr_Fluid tpr ;
+      const EOS_Fluid& fl = tpr ;
+      const int nf = 7 ;
+      const char* const xnm[nf] = { "mu", "cp", "lambda", "pr", "T", "d_rho_d_T_p", "sigma" } ;
+      const int np = 4 ;
+      double xp[np] = { 1.e5, 2.e5, 3.e5, 4.e5 } ;
+      double xh[np] = { 3.e5, 4.e5, -1.e0, 5.e5 } ;
+      double xr[nf][np], xs[np] ;
+      int    xe[np], xes[np], xew[np] ;
+      EOS_Field fp("Pressure", "p", NEPTUNE::p, np, xp) ;
+      EOS_Field fh("Enthalpy", "h", NEPTUNE::h, np, xh) ;
+      EOS_Fields fr(nf) ;
+      for (int k=0; k<nf; k++)
+         fr[k] = EOS_Field(xnm[k], xnm[k], np, xr[k]) ;
+      EOS_Error_Field ef(np, xe) ;
+      EOS_Error_Field efs(np, xes) ;
+      EOS_Error_Field efw(np, xew) ;
+      EOS_Error crf = fl.compute(fp, fh, fr, ef) ;
+      EOS_Error crw = EOS_Error::good ;
+      efw = EOS_Internal_Error::OK ;
+      int ndiff = 0 ;
+      for (int k=0; k<nf; k++)
+         { EOS_Field fs(xnm[k], xnm[k], np, xs) ;
+           crw = worst_generic_error(crw, fl.compute(fp, fh, fs, efs)) ;
+           efw.set_worst_error(efs) ;
+           for (int i=0; i<np; i++)
+              if ((efs[i].generic_error() < EOS_Error::bad) && (xs[i] != xr[k][i]))
+                 { cout << " " << xnm[k] << "(differ)" ;
+                   ndiff++ ;
+                 }
+         }
+      for (int i=0; i<np; i++)
+         if (ef[i] != efw[i])
+            { cout << " err[" << i << "](differ)" ;
+              ndiff++ ;
+            }
+      cout<<"[cr="<<crf<<"/"<<crw<<"] fused/single pr override (p,h) : " << xr[3][0] << endl ;
+      if ((ndiff > 0) || (crf != crw) || (xr[3][0] != 0.7e0 + 3.e5*1.e-9))
+         { cerr << "fused compute ignores an override" << endl ;
+           return 1 ;
+         }
+    }
+
+    // EOS_FieldView : block kernels against the point methods,
+    // n not a multiple of the block size
+    { const int np = 131 ;
+      const int nf = 5 ;
+      const char* const xnm[nf] = { "T", "rho", "cp", "mu", "lambda" } ;
+      double xp[np], xh[np] ;
+      for (int i=0; i<np; i++)
+         { xp[i] = 1.e5 + 1.e4*i ;
+           xh[i] = 3.e5 + 5.e3*i ;
+         }
+      int ndiff = 0 ;
+      cout << "block/point (p,h) :" ;
+      for (int k=0; k<nf; k++)
+         ndiff += compare_block_point(gas, xnm[k], np, xp, xh) ;
+      cout << " " << ndiff << " difference(s)" << endl ;
+      if (ndiff > 0)
+         { cerr << "perfect gas block kernel differs from the point method" << endl ;
+           return 1 ;
+         }
+    }
+
     cout<<endl<<endl;
     cout<<"--------------------------------------- "<<endl;
     cout<<"------ Test 2.1 ----------------------- "<<endl<<endl;
@@ -1412,6 +1667,18 @@ int main()
     cr=liquid.compute_p_sat_T(t, p);
     cout<<"[cr="<<cr<<"] in T "<<t<<"             out p_sat " <<p<<endl<<endl;
 
+    // Newton p_sat(T) : cold start, sampled guess, warm start
+    { int nit0, nit1, nit2 ;
+      double p0, p1, p2 ;
+      t=547.08;
+      liquid.newton_p_sat_T(t, p0, -1., nit0) ;
+      liquid.init_p_sat_T_guess(1.e3, 2.e7) ;
+      liquid.newton_p_sat_T(t, p1, -1., nit1) ;
+      cr=liquid.newton_p_sat_T(t+0.1, p2, p1, nit2) ;
+      cout<<"[cr="<<cr<<"] newton p_sat iterations cold/guess/warm : "
+          <<nit0<<"/"<<nit1<<"/"<<nit2<<(fabs(p1-p0) < 1.e-6*p0 ? "" : " (differ)")<<endl<<endl;
+    }
+
     // other tests
     p=1.e5;
     t=50.+273.15;
@@ -1448,6 +1715,49 @@ int main()
     cr=liquid.compute_w_ph(p, h, w);
     cout<<"[cr="<<cr<<"] in p "<<p<<" in h "<<h<<" out w " <<w<<endl;
     w=-1.;
+
+    // EOS_FieldView : block kernels against the point methods, n not a
+    // multiple of the block size (64) ; p < 0 : no saturation root, the
+    // T_sat Newton fails on these points only
+    { EOS_Std_Error_Handler sg_handler;
+      sg_handler.set_exit_on_error(EOS_Std_Error_Handler::disable_feature);
+      sg_handler.set_throw_on_error(EOS_Std_Error_Handler::disable_feature);
+      sg_handler.set_dump_on_error(EOS_Std_Error_Handler::disable_feature);
+      liquid.set_error_handler(sg_handler);
+      const int np = 131 ;
+      const int nf = 8 ;
+      const char* const xnm[nf] = { "T", "rho", "u", "s", "w", "cp",
+                                    "d_cp_d_p_h", "d_cp_d_h_p" } ;
+      const int ns = 5 ;
+      const char* const xns[ns] = { "T_sat", "h_l_sat", "h_v_sat",
+                                    "rho_l_sat", "rho_v_sat" } ;
+      double xp[np], xh[np] ;
+      for (int i=0; i<np; i++)
+         { xp[i] = (i%29 == 7) ? -1.e5 : 1.e4 + 1.5e5*i ;
+           xh[i] = 1.e5 + 1.e4*i ;
+         }
+      int ndiff = 0 ;
+      cout << "block/point (p,h) and (p) :" ;
+      for (int k=0; k<nf; k++)
+         ndiff += compare_block_point(liquid, xnm[k], np, xp, xh) ;
+      for (int k=0; k<ns; k++)
+         ndiff += compare_block_point(liquid, xns[k], np, xp, NULL) ;
+      double xt[np] ;
+      int    xe[np] ;
+      const EOS_FieldView vp(NEPTUNE::p, np, xp) ;
+      EOS_FieldView vt(NEPTUNE::T_sat, np, xt) ;
+      EOS_Error_Field ef(np, xe) ;
+      liquid.compute(vp, vt, ef) ;
+      int nfail = 0 ;
+      for (int i=0; i<np; i++)
+         nfail += (ef[i].generic_error() == EOS_Error::bad) ;
+      cout << " " << ndiff << " difference(s), T_sat failed on "
+           << nfail << " point(s)" << endl ;
+      if ((ndiff > 0) || (nfail != 5))
+         { cerr << "stiffened gas block kernel differs from the point method" << endl ;
+           return 1 ;
+         }
+    }
   }
 
 
@@ -6595,6 +6905,45 @@ int main()
       (void) er;
     }
 
+    // calc2_needs : the pruned pipeline (T only, rho only, saturation
+    // only, ...) gives the values of the full one (mu : transport)
+    { EOS_Std_Error_Handler c2_handler ;
+      c2_handler.set_exit_on_error(EOS_Std_Error_Handler::disable_feature) ;
+      c2_handler.set_throw_on_error(EOS_Std_Error_Handler::disable_feature) ;
+      c2_handler.set_dump_on_error(EOS_Std_Error_Handler::disable_feature) ;
+      EOS c2liq("EOS_Cathare2","WaterLiquid") ;
+      EOS c2vap("EOS_Cathare2","WaterVapor") ;
+      c2liq.set_error_handler(c2_handler) ;
+      c2vap.set_error_handler(c2_handler) ;
+      const int nf = 9 ;
+      const char* const xph[nf] = { "T", "rho", "cp", "d_rho_d_T_p", "h_l_lim",
+                                    "T_sat", "rho_v_sat", "lambda", "mu" } ;
+      const char* const xpt[nf] = { "h", "rho", "cp", "d_rho_d_T_p", "h_v_lim",
+                                    "h_l_sat", "rho_l_sat", "lambda", "mu" } ;
+      const int np = 20 ;
+      double xp[np], xhl[np], xhv[np], xtl[np] ;
+      for (int i=0; i<np; i++)
+         { xp[i]  = 1.e5 + 8.e5*i ;
+           xhl[i] = 2.e5 + 4.e4*i ;
+           xhv[i] = 2.75e6 + 1.e4*i ;
+           xtl[i] = 300.e0 + 8.e0*i ;
+         }
+      EOS_Field fp("Pressure", "p", NEPTUNE::p, np, xp) ;
+      EOS_Field fhl("Enthalpy", "h", NEPTUNE::h, np, xhl) ;
+      EOS_Field fhv("Enthalpy", "h", NEPTUNE::h, np, xhv) ;
+      EOS_Field ftl("Temperature", "T", NEPTUNE::T, np, xtl) ;
+      int ndiff = 0 ;
+      cout << "calc2_needs, pruned/full :" ;
+      ndiff += compare_fused_single(c2liq, fp, fhl, nf, xph, np) ;
+      ndiff += compare_fused_single(c2vap, fp, fhv, nf, xph, np) ;
+      ndiff += compare_fused_single(c2liq, fp, ftl, nf, xpt, np) ;
+      cout << " " << ndiff << " difference(s)" << endl ;
+      if (ndiff > 0)
+         { cerr << "CATHARE2 pruned computation differs from the full one" << endl ;
+           return 1 ;
+         }
+    }
+
   }
 
 #endif
@@ -7002,7 +7351,71 @@ int main()
 
   }
 #endif //WITH_PLUGIN_NAK
-   
+
+#ifdef WITH_PLUGIN_COOLPROP
+  {
+    cout<<endl<<endl;
+    cout<<"--------------------------------------- "<<endl;
+    cout<<"------ Test COOLPROP batch ------------ "<<endl<<endl;
+
+    Strings args(2);
+    args[0] = "Water";
+    args[1] = "phase_liquid";
+    EOS water("EOS_CoolProp", args);
+    EOS_Std_Error_Handler cp_handler;
+    cp_handler.set_exit_on_error(EOS_Std_Error_Handler::disable_feature);
+    cp_handler.set_throw_on_error(EOS_Std_Error_Handler::disable_feature);
+    cp_handler.set_dump_on_error(EOS_Std_Error_Handler::disable_feature);
+    water.set_error_handler(cp_handler);
+
+    // 6 outputs : one group of 5 and one of 1 ; point 4 is bad, the batch is redone point by point
+    const int n = 10;
+    const int nprop = 6;
+    ArrOfDouble xp(n), xh(n);
+    for (int i=0; i<n; i++)
+      { xp[i] = 1.e5*(i+1);
+        xh[i] = 1.e5 + 3.e4*i;
+      }
+    xp[4] = -1.;
+    EOS_Field P("Pressure", "p", NEPTUNE::p, xp);
+    EOS_Field H("Enthalpy", "h", NEPTUNE::h, xh);
+    const char* names[nprop] = { "T", "rho", "cp", "mu", "lambda", "w" };
+    int props[nprop] = { NEPTUNE::T, NEPTUNE::rho, NEPTUNE::cp, NEPTUNE::mu, NEPTUNE::lambda, NEPTUNE::w };
+    std::vector<ArrOfDouble> vals(nprop, ArrOfDouble(n));
+    EOS_Fields out(nprop);
+    for (int k=0; k<nprop; k++)
+      out[k] = EOS_Field(names[k], names[k], props[k], vals[k]);
+    ArrOfInt ierr(n);
+    EOS_Error_Field err(ierr);
+    water.compute(P, H, out, err);
+
+    // reference : the point by point computes
+    double maxdev = 0.;
+    int nbad = 0;
+    for (int i=0; i<n; i++)
+      { double ref[nprop];
+        EOS_Error cr = water.compute_T_ph(xp[i], xh[i], ref[0]);
+        water.compute_rho_ph(xp[i], xh[i], ref[1]);
+        water.compute_cp_ph(xp[i], xh[i], ref[2]);
+        water.compute_mu_ph(xp[i], xh[i], ref[3]);
+        water.compute_lambda_ph(xp[i], xh[i], ref[4]);
+        water.compute_w_ph(xp[i], xh[i], ref[5]);
+        if ((cr == EOS_Error::good) != (err[i].generic_error() == EOS_Error::good))
+          nbad++;
+        if (cr != EOS_Error::good)
+          continue;
+        for (int k=0; k<nprop; k++)
+          maxdev = std::max(maxdev, std::fabs(vals[k][i] - ref[k]) / std::max(1.e-30, std::fabs(ref[k])));
+      }
+    cout << "batch / point by point : max relative deviation " << maxdev
+         << ", " << nbad << " points with a different error" << endl;
+    if (nbad != 0 || maxdev > 1.e-12)
+      { cout << "COOLPROP batch : FAILED" << endl;
+        return 1;
+      }
+  }
+#endif //WITH_PLUGIN_COOLPROP
+
   cout<<endl<<endl;
   cout<<"--------------------------------------- "<<endl;
   cout<<"---------------- End ------------------ "<<endl;
@@ -359,8 +359,42 @@ void test_point_2parameters(EOS &eos, int iSample, bool dump, int nThreads)
   }
 }
 
-void test_features(EOS &eos, int test, int nSamples, bool dump, int nThreads)
+// field compute cut in chunks on the threads (EOS::set_parallel_chunk) :
+// same values and error codes as the serial compute
+int test_field_chunks(EOS &eos, int nSamples)
 {
+  const int n = nSamples * 100;
+  ArrOfDouble p(n), h(n), r1(n), r2(n);
+  ArrOfInt e1(n), e2(n);
+  for (int i = 0; i < n; i++)
+  {
+    p[i] = 1e5 + i * 3e1;
+    h[i] = 210000. + (i % 100) * 25000.;
+  }
+  EOS_Field fp("p", "p", NEPTUNE::p, p);
+  EOS_Field fh("h", "h", NEPTUNE::h, h);
+  EOS_Error_Field err1(e1);
+  EOS_Error_Field err2(e2);
+  int nb_diff = 0;
+  for (long unsigned int i = 0; i < thermprop_r.size(); i++)
+  {
+    EOS_Field fr1(thermprop_r[i].c_str(), thermprop_r[i].c_str(), n_thermprop_r[i], r1);
+    EOS_Field fr2(thermprop_r[i].c_str(), thermprop_r[i].c_str(), n_thermprop_r[i], r2);
+    eos.set_parallel_chunk(0);
+    eos.compute(fp, fh, fr1, err1);
+    eos.set_parallel_chunk(64);
+    eos.compute(fp, fh, fr2, err2);
+    for (int j = 0; j < n; j++)
+      if (e1[j] != e2[j] || (e1[j] == EOS_Internal_Error::OK && r1[j] != r2[j]))
+        nb_diff++;
+  }
+  eos.set_parallel_chunk(0);
+  return nb_diff;
+}
+
+int test_features(EOS &eos, int test, int nSamples, bool dump, int nThreads)
+{
+  int nb_failed = 0;
   // Configure eos to return to client on any error.
   std::cout << eos << std::endl;
 
@@ -459,8 +493,25 @@ void test_features(EOS &eos, int test, int nSamples, bool dump, int nThreads)
     std::cout << T << std::endl;
   }
 
+  if (test == 5)
+  {
+    handler.set_dump_on_error(EOS_Std_Error_Handler::disable_feature);
+    eos.set_error_handler(handler);
+
+    Timer T("Testing field methods by chunks         :");
+
+    T.start();
+    int nb_diff = test_field_chunks(eos, nSamples);
+    T.stop();
+    std::cout << T << std::endl;
+    std::cout << nb_diff << " point(s) differ from the serial compute" << std::endl;
+    if (nb_diff != 0)
+      nb_failed++;
+  }
+
   // Reset to previous handler
   eos.restore_error_handler();
+  return nb_failed;
 }
 
 int main(int argc, char **argv)
@@ -515,8 +566,9 @@ int main(int argc, char **argv)
 
   EOS eos(plugin.c_str(), fluid.c_str());
 
-  for (int test=1; test <= 4; test++)
-    test_features(eos, test, nSamples, dump, nTh);
+  int nb_failed = 0;
+  for (int test=1; test <= 5; test++)
+    nb_failed += test_features(eos, test, nSamples, dump, nTh);
   
-  return 0;
+  return nb_failed == 0 ? 0 : 1;
 }
@@ -19,6 +19,8 @@
 #include "EOS/API/EOS_Std_Error_Handler.hxx"
 #include "EOS/API/EOS_Config.hxx"
 #include "EOS_IGen/API/EOS_IGen.hxx"
+#include "EOS/Src/EOS_Ipp/EOS_Ipp.hxx"
+#include <cmath>
 
 using namespace NEPTUNE;
 using namespace NEPTUNE_EOS_IGEN;
@@ -338,6 +340,96 @@ int main()
          }
       
     }
+
+    cout<<endl<<"Test table binaire"<<endl<<endl;
+    // sans_raffinement_<method>.bin is written by EOSIGenTest (EOS_IGen::write_bin) :
+    // same values and error fields as the MED table, inside and outside the domain
+    {
+      AString med_file = "sans_raffinement_";
+      med_file+=methodes[m];
+      AString bin_file = med_file;
+      bin_file+=".bin";
+
+      EOS obj_med("EOS_Ipp",med_file.aschar());
+      EOS obj_bin("EOS_Ipp",bin_file.aschar());
+      EOS_Std_Error_Handler handler;
+      handler.set_exit_on_error(EOS_Std_Error_Handler::disable_feature);
+      handler.set_throw_on_error(EOS_Std_Error_Handler::disable_feature);
+      handler.set_dump_on_error(EOS_Std_Error_Handler::disable_feature);
+      obj_med.set_error_handler(handler);
+      obj_bin.set_error_handler(handler);
+
+      double pmin, pmax, hmin, hmax;
+      obj_med.get_p_min(pmin);
+      obj_med.get_p_max(pmax);
+      obj_med.get_h_min(hmin);
+      obj_med.get_h_max(hmax);
+
+      // 1.2 x the domain in p and h : some points are out of the table
+      int np=23;
+      int nh=17;
+      int n=np*nh;
+      ArrOfDouble p_i(n);
+      ArrOfDouble h_i(n);
+      for (int i=0 ; i<np ; i++)
+        for (int j=0 ; j<nh ; j++)
+        { p_i[i*nh+j]=pmin-0.1*(pmax-pmin)+1.2*(pmax-pmin)*i/(np-1);
+          h_i[i*nh+j]=hmin-0.1*(hmax-hmin)+1.2*(hmax-hmin)*j/(nh-1);
+        }
+      EOS_Field p_f("p","p",NEPTUNE::p,p_i);
+      EOS_Field h_f("h","h",NEPTUNE::h,h_i);
+
+      const int nprop=6;
+      const char* const props[nprop]={"T","rho","cp","mu","lambda","d_rho_d_h_p"};
+      const int nsat=3;
+      const char* const props_sat[nsat]={"T_sat","h_l_sat","rho_l_sat"};
+      int ndiff=0;
+      for (int k=0 ; k<nprop+nsat ; k++)
+      { const char* const prop = (k<nprop) ? props[k] : props_sat[k-nprop];
+        ArrOfDouble r_med(n,-1.);
+        ArrOfDouble r_bin(n,-1.);
+        ArrOfInt ierr_med(n);
+        ArrOfInt ierr_bin(n);
+        EOS_Field f_med(prop,prop,r_med);
+        EOS_Field f_bin(prop,prop,r_bin);
+        EOS_Error_Field err_med(ierr_med);
+        EOS_Error_Field err_bin(ierr_bin);
+        if (k<nprop)
+        { obj_med.compute(p_f,h_f,f_med,err_med);
+          obj_bin.compute(p_f,h_f,f_bin,err_bin);
+        }
+        else
+        { obj_med.compute(p_f,f_med,err_med);
+          obj_bin.compute(p_f,f_bin,err_bin);
+        }
+        for (int i=0 ; i<n ; i++)
+          if (!(r_med[i]==r_bin[i] || (std::isnan(r_med[i]) && std::isnan(r_bin[i])))
+              || err_med[i]!=err_bin[i])
+          { if (ndiff==0)
+              cout<<prop<<" p "<<p_i[i]<<" h "<<h_i[i]<<" med "<<r_med[i]<<" [cr="<<err_med[i].generic_error()
+                  <<"] bin "<<r_bin[i]<<" [cr="<<err_bin[i].generic_error()<<"]"<<endl;
+            ndiff++;
+          }
+      }
+      cout<<"med/bin : "<<ndiff<<" difference(s) on "<<n<<" points"<<endl;
+
+      // the mapping is read-only : filling the tables again is refused
+      NEPTUNE_EOS::EOS_Ipp ipp;
+      Strings args(1);
+      args[0]=bin_file;
+      int err_init=ipp.init(args);
+      ArrOfDouble vv(p_i.size(),0.);
+      ArrOfInt ee(p_i.size());
+      EOS_Field val("T","T",NEPTUNE::T,vv);
+      EOS_Error_Field err_val(ee);
+      EOS_Error err_add=ipp.add_ph_prop(val,err_val);
+      EOS_Error err_tab=ipp.init_tables();
+      cout<<"bin init [cr="<<err_init<<"] add_ph_prop [cr="<<err_add<<"] init_tables [cr="<<err_tab<<"]"<<endl;
+      if (ndiff>0 || err_init!=EOS_Error::good || err_add==EOS_Error::good || err_tab==EOS_Error::good)
+      { cerr<<"binary table differs from the MED table"<<endl;
+        return 1;
+      }
+    }
     
   }
 
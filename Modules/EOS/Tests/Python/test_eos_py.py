@@ -150,3 +150,32 @@ result2 = eos.compute_sat("p",tab_P,outputs_string)
 print("Résultat du calcul à saturation :")
 affiche_sat(tab_P, result2, outputs_string)
 
+
+
+# compute_arrays / compute_sat_arrays : les resultats sont ecrits dans les
+# tableaux de l'appelant et doivent etre ceux de compute / compute_sat
+import array
+import sys
+
+def ecart_tableaux(result, out, nb_pts, nb_prop):
+    return max(abs(out[j][i] - result[i][j]) for i in range(nb_pts) for j in range(nb_prop))
+
+outputs_ph = ["T", "rho", "cp", "mu"]
+nb_pts = len(tab_P)
+p_arr = array.array('d', tab_P)
+h_arr = array.array('d', tab_H)
+out_ph = [array.array('d', [-1.0] * nb_pts) for _ in outputs_ph]
+err_ph = array.array('i', [-1] * nb_pts)
+worst = eos.compute_arrays("p", "h", p_arr, h_arr, outputs_ph, out_ph, err_ph)
+ecart_ph = ecart_tableaux(eos.compute("p", "h", tab_P, tab_H, outputs_ph), out_ph, nb_pts, len(outputs_ph))
+print("compute_arrays : worst", worst, "erreurs", list(err_ph), "ecart max avec compute", ecart_ph)
+
+out_sat = [array.array('d', [-1.0] * nb_pts) for _ in outputs_string]
+err_sat = array.array('i', [-1] * nb_pts)
+worst_sat = eos.compute_sat_arrays("p", p_arr, outputs_string, out_sat, err_sat)
+ecart_sat = ecart_tableaux(result2, out_sat, nb_pts, len(outputs_string))
+print("compute_sat_arrays : worst", worst_sat, "erreurs", list(err_sat), "ecart max avec compute_sat", ecart_sat)
+
+if ecart_ph != 0.0 or ecart_sat != 0.0 or -1 in err_ph or -1 in err_sat:
+    print("ERROR : compute_arrays / compute_sat_arrays")
+    sys.exit(1)
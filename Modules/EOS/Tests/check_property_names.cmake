@@ -0,0 +1,44 @@
+# reference_names of EOS_properties.cxx (hash table of the property names)
+# against the names of the lists of the *_properties_i.hxx files :
+# a name of the lists missing in reference_names is still found, only by
+# the lists (slower), a reference name no list knows is a dead entry.
+# usage : cmake -DAPI_DIR=<EOS source>/Modules/EOS/API -P check_property_names.cmake
+
+file(READ ${API_DIR}/EOS_properties.cxx src)
+string(REGEX MATCH "reference_names\\[\\] *=[^;]*;" ref_block "${src}")
+if (NOT ref_block)
+  message(FATAL_ERROR "reference_names not found in ${API_DIR}/EOS_properties.cxx")
+endif()
+string(REGEX MATCHALL "\"[^\"]*\"" ref_names "${ref_block}")
+string(REPLACE "\"" "" ref_names "${ref_names}")
+
+set(list_names "")
+foreach(family therm satur splim camix c2iap)
+  file(READ ${API_DIR}/${family}_properties_i.hxx src)
+  string(REGEX MATCHALL "eostp_strcmp\\(name *, *\"[^\"]*\"" names "${src}")
+  string(REGEX REPLACE "eostp_strcmp\\(name *, *\"([^\"]*)\"" "\\1" names "${names}")
+  list(APPEND list_names ${names})
+endforeach()
+
+set(nerr 0)
+foreach(name ${list_names})
+  list(FIND ref_names ${name} k)
+  if (k LESS 0)
+    message("missing in reference_names : ${name}")
+    math(EXPR nerr "${nerr}+1")
+  endif()
+endforeach()
+foreach(name ${ref_names})
+  list(FIND list_names ${name} k)
+  if (k LESS 0)
+    message("reference name in no list : ${name}")
+    math(EXPR nerr "${nerr}+1")
+  endif()
+endforeach()
+
+list(LENGTH list_names nlist)
+list(LENGTH ref_names nref)
+message("property names : ${nlist} in the lists, ${nref} reference names, ${nerr} difference(s)")
+if (nerr GREATER 0)
+  message(FATAL_ERROR "reference_names of EOS_properties.cxx differs from the *_properties_i.hxx lists")
+endif()
@@ -23,6 +23,7 @@
  */
 #include "EOS_IGen.hxx"
 #include "EOS/API/EOS_Config.hxx"
+#include "EOS/Src/EOS_Ipp/EOS_Ipp.hxx"
 
 #include <fstream>
 #include <string>
@@ -34,6 +35,7 @@ namespace NEPTUNE_EOS_IGEN
   method("unknown"),
   reference("unknown"),
   memory_max(-1),
+  nb_threads(1),
   IGen_handler(),
   test_qualities(false),
   refine(false)
@@ -55,6 +57,7 @@ namespace NEPTUNE_EOS_IGEN
   mesh_p(right.mesh_p),
   mesh_ph(right.mesh_ph),
   fluid(right.fluid),
+  nb_threads(right.nb_threads),
   IGen_handler(right.IGen_handler),
   qualities(right.qualities),
   test_qualities(right.test_qualities),
@@ -66,6 +69,7 @@ namespace NEPTUNE_EOS_IGEN
   method(meth),
   reference(ref),
   memory_max(-1),
+  nb_threads(1),
   IGen_handler(),
   test_qualities(false),
   refine(false)
@@ -75,7 +79,9 @@ namespace NEPTUNE_EOS_IGEN
         
   
   EOS_IGen::~EOS_IGen()
-   { /*
+   { for (unsigned int i=0; i<fluid_thr.size(); i++)
+        delete fluid_thr[i] ;
+   /*
    if (mesh_p != nullptr) 
    {
        delete mesh_p;
@@ -148,18 +154,13 @@ namespace NEPTUNE_EOS_IGEN
 
     set_mesh_ph(nb_node_p, nb_node_h, level_max) ;
     set_mesh_p(nb_node_p, level_max) ;
-    err = write_tempory_med() ;
-    if (err != EOS_Error::good)
-       { cerr<< "Error EOS_IGen::make_mesh : no temporary MED file writed" <<endl ;
-         return err ;
-       }
-    err = write_index(true) ;
+
+    set_obj_Ipp() ;
+    err = make_obj_Ipp() ;
     if (err != EOS_Error::good)
-       { cerr<< "Error EOS_IGen::make_mesh : no index.eos file writed" <<endl ;
+       { cerr<< "Error EOS_IGen::make_mesh : interpolator not built" <<endl ;
          return err ;
        }
-       
-    set_obj_Ipp() ;
     
     return good ;
   }
@@ -212,19 +213,14 @@ namespace NEPTUNE_EOS_IGEN
        }
 
     set_mesh_ph(nb_node_p, nb_node_h, level_max) ;
-    err = write_tempory_med() ;
-    if (err != EOS_Error::good)
-       { cerr<< "Error EOS_IGen::make_mesh_ph : no temporary MED file writed" <<endl ;
-         return err ;
-       }
-    err = write_index(true) ;
+
+    set_obj_Ipp() ;
+    err = make_obj_Ipp() ;
     if (err != EOS_Error::good)
-       { cerr<< "Error EOS_IGen::make_mesh_ph : no index.eos file writed" <<endl ;
+       { cerr<< "Error EOS_IGen::make_mesh_ph : interpolator not built" <<endl ;
          return err ;
        }
        
-    set_obj_Ipp() ;
-       
     return EOS_Error::good ;
   }
   
@@ -240,18 +236,13 @@ namespace NEPTUNE_EOS_IGEN
     set_fluid() ;
         
     set_mesh_p(nb_node_p, level_max) ;
-    err = write_tempory_med() ;
-    if (err != EOS_Error::good)
-       { cerr<< "Error EOS_IGen::make_mesh_p : no temporary MED file writed" <<endl ;
-         return err ;
-       }
-    err = write_index(true) ;
+
+    set_obj_Ipp() ;
+    err = make_obj_Ipp() ;
     if (err != EOS_Error::good)
-       { cerr<< "Error EOS_IGen::make_mesh_p : no index.eos file writed" <<endl ;
+       { cerr<< "Error EOS_IGen::make_mesh_p : interpolator not built" <<endl ;
          return err ;
        }
-
-    set_obj_Ipp() ;
     
     return EOS_Error::good ;
   }
@@ -311,6 +302,35 @@ namespace NEPTUNE_EOS_IGEN
   }
   
   
+  EOS_Error EOS_IGen::write_bin()
+  { EOS_Error err ;
+
+    if (strlen(file_med_name.aschar())     == 0)  set_file_med_name() ;
+    if (strlen(path_environement.aschar()) == 0)  set_path_environement() ;
+
+    AString med_file = file_med_name ;
+    med_file += ".med"               ;
+    AString bin_file = ""            ;
+    bin_file += path_environement    ;
+    bin_file += "/EOS_Ipp/"          ;
+    bin_file += file_med_name        ;
+    bin_file += ".bin"               ;
+    err = NEPTUNE_EOS::EOS_Ipp::convert_med(med_file.aschar(), bin_file.aschar()) ;
+    if (err != EOS_Error::good)
+       { cerr<< " Error EOS_IGen::write_bin : impossible to convert MED file" <<endl ;
+         return err ;
+       }
+
+    err = write_index(false, ".bin") ;
+    if (err != EOS_Error::good)
+       { cerr<< " Error EOS_IGen::write_bin : impossible to write index.eos file" <<endl ;
+         return err ;
+       }
+
+    return EOS_Error::good ;
+  }
+
+
   EOS_Error EOS_IGen::write_tempory_med()
   { EOS_Error err ;
   
@@ -418,25 +438,8 @@ namespace NEPTUNE_EOS_IGEN
 
     // 2D diagram P-h
     if (mesh_ph->get_exist())
-       { // couple of floats
-         double tp1 = mesh_ph->get_domain()[1][0] ;
-         double tp2 = mesh_ph->get_domain()[0][0] ;
-
-         // properties list effectively used : str_properties
-         vector<string>  str_properties ;
-         int nb_lps = list_propi.size() ;
-         if (nb_lps == 0)
-            { // use thermprop
-              int sz = thermprop.size() ;
-              vector<string>  list_propt ;
-              for(int i=0; i<sz; i++)
-                 list_propt.push_back(thermprop[i].name) ;
-              str_properties  = fluid->is_implemented("P", "h", list_propt, tp1, tp2) ;
-            }
-         else
-            { // use list_propi
-              str_properties = fluid->is_implemented("P", "h", list_propi, tp1, tp2) ;
-            }
+       { // properties list effectively used : str_properties
+         vector<string>  str_properties = properties_ph() ;
 
 //       ArrOfInt nerr(mesh_ph->get_nb_node());
 //       ArrOfInt fnodes(mesh_ph->get_nb_node());
@@ -457,6 +460,7 @@ namespace NEPTUNE_EOS_IGEN
          ArrOfInt nerr(nb_nc) ;
          EOS_Error_Field err_field(nerr) ;
 
+         set_cache(cache_ph, str_properties) ;
          int nb_sp = str_properties.size() ;
          if (!refine)
             { err = med.add_Connectivity_NoRef_2D(mesh_name, mesh_ph->get_nb_mesh(), 
@@ -466,8 +470,8 @@ namespace NEPTUNE_EOS_IGEN
                  { const char *pprop = str_properties[i].c_str() ;
                    EOS_Field field(pprop, pprop, x) ;//TODO: eos_strcp 
 
-                   fluid->compute(mesh_ph->get_domain_continuity()[1], 
-                                  mesh_ph->get_domain_continuity()[0], field, err_field) ;
+                   compute_nodes(cache_ph, mesh_ph->get_domain_continuity()[1], 
+                                 &mesh_ph->get_domain_continuity()[0], field, err_field) ;
                    err = med.add_Champ_Noeud(mesh_name,field) ;
 
                    AString err_name = pprop ;
@@ -494,25 +498,9 @@ namespace NEPTUNE_EOS_IGEN
     
     // 1D curve
     if (mesh_p->get_exist())
-       { double tp = mesh_p->get_domain()[0][0] ;  // float
-         
-         // saturation curve
-         { int nb_lpss = list_propi_sat.size() ;
-
-           // properties list effectively used : str_properties_sat
-           vector<string>  str_properties_sat ;
-           if (nb_lpss == 0)
-              { // use saturprop
-                int sz = saturprop.size() ;
-                vector<string>  list_propt_sat ;
-                for(int i=0; i<sz; i++)
-                   list_propt_sat.push_back(saturprop[i].name) ;
-                str_properties_sat  = fluid->is_implemented("Psat", list_propt_sat, tp) ;
-              }
-           else
-              { // use list_propi_sat
-                str_properties_sat = fluid->is_implemented("Psat", list_propi_sat, tp) ;
-              }
+       { // saturation curve
+         { // properties list effectively used : str_properties_sat
+           vector<string>  str_properties_sat = properties_sat() ;
 
            AString mesh_name("sat_domain") ;
            AString description("saturation mesh") ;
@@ -525,12 +513,13 @@ namespace NEPTUNE_EOS_IGEN
            ArrOfDouble x(mesh_p->get_nb_node()) ;
            ArrOfInt nerr(mesh_p->get_nb_node()) ;
            EOS_Error_Field err_field(nerr) ;
+           set_cache(cache_sat, str_properties_sat) ;
            int nb_sps = str_properties_sat.size() ;
            for (int i=0; i<nb_sps; i++)
               { const char *pprop = str_properties_sat[i].c_str() ;
                 EOS_Field field(pprop, pprop, x) ;//TODO: eos_strcp 
 
-                fluid->compute(mesh_p->get_domain()[0], field, err_field) ;
+                compute_nodes(cache_sat, mesh_p->get_domain()[0], NULL, field, err_field) ;
                 err = med.add_Champ_Noeud(mesh_name,field) ;
                 
                 AString err_name = pprop ;
@@ -540,22 +529,8 @@ namespace NEPTUNE_EOS_IGEN
          }
 
          // spinodal curves
-         { int nb_lpls = list_propi_lim.size() ;
-
-           // properties list effectively used : str_properties_lim
-           vector<string>  str_properties_lim ;
-           if (nb_lpls == 0)
-              { // use splimprop
-                int sz = splimprop.size() ;
-                vector<string>  list_propt_lim ;
-                for(int i=0; i<sz; i++)
-                   list_propt_lim.push_back(splimprop[i].name) ;
-                str_properties_lim  = fluid->is_implemented("Plim", list_propt_lim, tp) ;
-              }
-           else
-              { // use list_propi_lim
-                str_properties_lim = fluid->is_implemented("Plim", list_propi_lim, tp) ;
-              }
+         { // properties list effectively used : str_properties_lim
+           vector<string>  str_properties_lim = properties_lim() ;
 
            AString mesh_name("lim_domain");
            AString description("spinodal mesh");
@@ -568,12 +543,13 @@ namespace NEPTUNE_EOS_IGEN
            ArrOfDouble x(mesh_p->get_nb_node()) ;
            ArrOfInt nerr(mesh_p->get_nb_node()) ;
            EOS_Error_Field err_field(nerr) ;
+           set_cache(cache_lim, str_properties_lim) ;
            int nb_spl = str_properties_lim.size() ;
            for (int i=0; i<nb_spl; i++)
               { const char *pprop = str_properties_lim[i].c_str() ;
                 EOS_Field field(pprop, pprop, x) ; //TODO: eos_strcp 
 
-                fluid->compute(mesh_p->get_domain()[0], field, err_field) ;
+                compute_nodes(cache_lim, mesh_p->get_domain()[0], NULL, field, err_field) ;
                 err = med.add_Champ_Noeud(mesh_name,field) ;
                 
                 AString err_name = pprop ;
@@ -649,12 +625,331 @@ namespace NEPTUNE_EOS_IGEN
     return EOS_Error::good ;
   }
   
+  // properties list effectively used in ph domain (list_propi, or all thermprop)
+  vector<string> EOS_IGen::properties_ph() const
+  { double tp1 = mesh_ph->get_domain()[1][0] ;
+    double tp2 = mesh_ph->get_domain()[0][0] ;
+
+    if (list_propi.size() != 0)
+       return fluid->is_implemented("P", "h", list_propi, tp1, tp2) ;
+
+    int sz = thermprop.size() ;
+    vector<string>  list_propt ;
+    for(int i=0; i<sz; i++)
+       list_propt.push_back(thermprop[i].name) ;
+    return fluid->is_implemented("P", "h", list_propt, tp1, tp2) ;
+  }
+
+  // properties list effectively used on saturation curve (list_propi_sat, or all saturprop)
+  vector<string> EOS_IGen::properties_sat() const
+  { double tp = mesh_p->get_domain()[0][0] ;
+
+    if (list_propi_sat.size() != 0)
+       return fluid->is_implemented("Psat", list_propi_sat, tp) ;
+
+    int sz = saturprop.size() ;
+    vector<string>  list_propt_sat ;
+    for(int i=0; i<sz; i++)
+       list_propt_sat.push_back(saturprop[i].name) ;
+    return fluid->is_implemented("Psat", list_propt_sat, tp) ;
+  }
+
+  // properties list effectively used on spinodal curves (list_propi_lim, or all splimprop)
+  vector<string> EOS_IGen::properties_lim() const
+  { double tp = mesh_p->get_domain()[0][0] ;
+
+    if (list_propi_lim.size() != 0)
+       return fluid->is_implemented("Plim", list_propi_lim, tp) ;
+
+    int sz = splimprop.size() ;
+    vector<string>  list_propt_lim ;
+    for(int i=0; i<sz; i++)
+       list_propt_lim.push_back(splimprop[i].name) ;
+    return fluid->is_implemented("Plim", list_propt_lim, tp) ;
+  }
+
+
+  // position of a node on a lattice of 2^32 intervals of [xmin, xmax] : same key
+  // for a node whatever its number in the mesh or the rounding of its coordinates
+  static inline long long node_key(double x, double xmin, double xmax)
+  { return (xmax > xmin) ? llround((x - xmin) / (xmax - xmin) * 4294967296.e0) : 0 ;
+  }
+
+  // cache for a list of properties, values are kept while the list is unchanged
+  void EOS_IGen::set_cache(EOS_IGen_Cache& cache, const vector<string>& props)
+  { if (cache.props == props)  return ;
+    cache.props = props ;
+    cache.row.clear() ;
+    cache.val.clear() ;
+    cache.err.clear() ;
+    cache.lib.clear() ;
+  }
+
+/*
+ * EOS_IGen::clear_caches :
+ *              the node keys depend on pmin, pmax, hmin, hmax and the values on the
+ *              reference fluid : all the caches are emptied when one of them changes
+ */
+  void EOS_IGen::clear_caches()
+  { EOS_IGen_Cache empty ;
+    cache_ph  = empty ;
+    cache_sat = empty ;
+    cache_lim = empty ;
+    cache_qi.clear() ;
+  }
+
+
+/*
+ * EOS_IGen::compute_nodes :
+ *              property res of the reference fluid at nodes p (ph domain : p, h)
+ *              only the nodes not yet in cache are computed (for all the properties
+ *              of the cache), the other values are read from the cache
+ */
+  EOS_Error EOS_IGen::compute_nodes(EOS_IGen_Cache& cache, const EOS_Field& p, const EOS_Field* h,
+                                    EOS_Field& res, EOS_Error_Field& err)
+  { int nprop = cache.props.size() ;
+    int j = 0 ;
+    while (j < nprop && strcmp(cache.props[j].c_str(), res.get_property_name().aschar()) != 0)  j++ ;
+    if (j == nprop)
+       { // property not stored in cache
+         if (h)  return fluid->compute(p, *h, res, err) ;
+         return fluid->compute(p, res, err) ;
+       }
+
+    // rows of the nodes, new rows for the nodes not yet computed
+    int sz   = p.size() ;
+    int nrow = cache.row.size() ;
+    vector<int> rows(sz) ;
+    vector<int> inew ;
+    for (int i=0; i<sz; i++)
+       { std::pair<long long, long long> key(node_key(p[i], pmin, pmax),
+                                             h ? node_key((*h)[i], hmin, hmax) : 0) ;
+         std::pair<std::map<std::pair<long long, long long>, int>::iterator, bool> it
+            = cache.row.insert(std::make_pair(key, nrow + (int)inew.size())) ;
+         if (it.second)  inew.push_back(i) ;
+         rows[i] = it.first->second ;
+       }
+
+    int nb_new = inew.size() ;
+    if (nb_new > 0)
+       { ArrOfDouble pn(nb_new) ;
+         ArrOfDouble hn(h ? nb_new : 0) ;
+         for (int k=0; k<nb_new; k++)
+            { pn[k] = p[inew[k]] ;
+              if (h)  hn[k] = (*h)[inew[k]] ;
+            }
+         vector<ArrOfDouble> val ;
+         vector<ArrOfInt> ierr, lib ;
+         compute_new_nodes(cache, pn, h ? &hn : NULL, val, ierr, lib) ;
+
+         cache.val.resize((nrow+nb_new) * nprop) ;
+         cache.err.resize((nrow+nb_new) * nprop) ;
+         cache.lib.resize((nrow+nb_new) * nprop) ;
+         for (int k=0; k<nb_new; k++)
+            for (int jj=0; jj<nprop; jj++)
+               { cache.val[(nrow+k)*nprop + jj] = val[jj][k]  ;
+                 cache.err[(nrow+k)*nprop + jj] = ierr[jj][k] ;
+                 cache.lib[(nrow+k)*nprop + jj] = lib[jj][k]  ;
+               }
+       }
+
+    for (int i=0; i<sz; i++)
+       { int k = rows[i]*nprop + j ;
+         res[i] = cache.val[k] ;
+         err.set(i, EOS_Internal_Error(cache.err[k], cache.lib[k])) ;
+       }
+    return err.find_worst_error().generic_error() ;
+  }
+
+
+/*
+ * EOS_IGen::compute_new_nodes :
+ *              all the properties of the cache at the new nodes p (ph domain : p, h)
+ *              the nodes are split in nb_threads contiguous blocks, one reference EOS
+ *              object per block : the values do not depend on the number of threads
+ */
+  void EOS_IGen::compute_new_nodes(EOS_IGen_Cache& cache, const ArrOfDouble& p, const ArrOfDouble* h,
+                                   vector<ArrOfDouble>& val, vector<ArrOfInt>& err, vector<ArrOfInt>& lib)
+  { int nprop = cache.props.size() ;
+    int sz    = p.size() ;
+    val.assign(nprop, ArrOfDouble(sz)) ;
+    err.assign(nprop, ArrOfInt(sz)) ;
+    lib.assign(nprop, ArrOfInt(sz)) ;
+
+    int nthr = 1 ;
+#ifdef _OPENMP
+    nthr = (nb_threads < sz) ? nb_threads : sz ;
+#endif
+    while ((int)fluid_thr.size() < nthr-1)
+       fluid_thr.push_back(new EOS(method.aschar(), reference.aschar())) ;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr) schedule(static, 1)
+#endif
+    for (int t=0; t<nthr; t++)
+       { int beg = (int)(((long long)t * sz) / nthr) ;
+         int n   = (int)(((long long)(t+1) * sz) / nthr) - beg ;
+         EOS* eos = (t == 0) ? fluid : fluid_thr[t-1] ;
+
+         EOS_Field pt("p", "p", NEPTUNE::p, n, (double*)p.get_ptr() + beg) ;
+         ArrOfInt ie(n) ;
+         EOS_Error_Field et(ie) ;
+         for (int j=0; j<nprop; j++)
+            { const char *pprop = cache.props[j].c_str() ;
+              EOS_Field rt(pprop, pprop, n, (double*)val[j].get_ptr() + beg) ;
+              if (h)
+                 { EOS_Field ht("h", "h", NEPTUNE::h, n, (double*)h->get_ptr() + beg) ;
+                   eos->compute(pt, ht, rt, et) ;
+                 }
+              else
+                 eos->compute(pt, rt, et) ;
+              for (int k=0; k<n; k++)
+                 { err[j][beg+k] = et[k].get_code() ;
+                   lib[j][beg+k] = et[k].get_library_code() ;
+                 }
+            }
+       }
+  }
+
+
+/*
+ * EOS_IGen::make_obj_Ipp :
+ *              load in obj_Ipp the tables of the current meshes, same content as
+ *              make_properties but kept in memory : no temporary MED file is written
+ *              nor read back during the refinement loops
+ */
+  EOS_Error EOS_IGen::make_obj_Ipp()
+  { EOS_Error err ;
+    NEPTUNE_EOS::EOS_Ipp& ipp = dynamic_cast<NEPTUNE_EOS::EOS_Ipp&>(obj_Ipp->fluid()) ;
+    ipp.reset_tables() ;
+
+    // 2D diagram P-h
+    if (mesh_ph->get_exist())
+       { vector<string>  str_properties = properties_ph() ;
+
+         // connectivity as read in MED file, first index is 0
+         // (cf. EOS_Med::add_Connectivity_Refine_2D and add_Connectivity_NoRef_2D)
+         const vector<ArrOfInt>& med_to_node = mesh_ph->get_med_to_node() ;
+         int nb_cell = refine ? med_to_node.size() : mesh_ph->get_nb_mesh() ;
+         ArrOfInt index_conn(nb_cell+1) ;
+         ArrOfInt connect(4*nb_cell) ;
+         int nb_h = mesh_ph->get_nb_h() ;
+         int k = 0 ;
+         for (int j=0; j<nb_cell; j++)
+            { index_conn[j] = 4*j ;
+              if (refine)
+                 { connect[4*j]   = med_to_node[j][0] ;
+                   connect[4*j+1] = med_to_node[j][1] ;
+                   connect[4*j+2] = med_to_node[j][3] ;
+                   connect[4*j+3] = med_to_node[j][2] ;
+                 }
+              else
+                 { connect[4*j]   = k        ;
+                   connect[4*j+1] = k+1      ;
+                   connect[4*j+2] = k+1+nb_h ;
+                   connect[4*j+3] = k+nb_h   ;
+                   k++ ;
+                   if ((k+1)%nb_h == 0)  k++ ;
+                 }
+            }
+         index_conn[nb_cell] = 4*nb_cell ;
+         ipp.set_ph_nodes(mesh_ph->get_domain_continuity()[1],
+                          mesh_ph->get_domain_continuity()[0], index_conn, connect) ;
+
+         int nb_nc = mesh_ph->get_nb_node() + mesh_ph->get_nb_continuity() ;
+         ArrOfDouble x(nb_nc) ;
+         ArrOfInt nerr(nb_nc) ;
+         EOS_Error_Field err_field(nerr) ;
+
+         set_cache(cache_ph, str_properties) ;
+         int nb_sp = str_properties.size() ;
+         for (int i=0; i<nb_sp; i++)
+            { const char *pprop = str_properties[i].c_str() ;
+              EOS_Field field(pprop, pprop, x) ;
+
+              if (!refine)
+                 compute_nodes(cache_ph, mesh_ph->get_domain_continuity()[1], 
+                               &mesh_ph->get_domain_continuity()[0], field, err_field) ;
+              else
+                 compute_properties(field, err_field) ;
+              ipp.add_ph_prop(field, err_field) ;
+            }
+       }
+
+    // 1D curves
+    if (mesh_p->get_exist())
+       { const EOS_Field& p = mesh_p->get_domain()[0] ;
+         ipp.set_p_nodes(p) ;
+
+         ArrOfDouble x(mesh_p->get_nb_node()) ;
+         ArrOfInt nerr(mesh_p->get_nb_node()) ;
+         EOS_Error_Field err_field(nerr) ;
+         for (int sat_lim=0; sat_lim<2; sat_lim++)
+            { vector<string>  str_properties_p = (sat_lim == 0) ? properties_sat() : properties_lim() ;
+              EOS_IGen_Cache& cache = (sat_lim == 0) ? cache_sat : cache_lim ;
+              set_cache(cache, str_properties_p) ;
+              int nb_sp = str_properties_p.size() ;
+              for (int i=0; i<nb_sp; i++)
+                 { const char *pprop = str_properties_p[i].c_str() ;
+                   EOS_Field field(pprop, pprop, x) ;
+
+                   compute_nodes(cache, p, NULL, field, err_field) ;
+                   ipp.add_p_prop(field, err_field, sat_lim) ;
+                 }
+            }
+       }
+
+    double Tc, pc, hc ;
+    try
+       { fluid->get_T_crit(Tc) ;
+       }
+    catch (EOS_Std_Exception ex)
+       { Tc = -1.e0 ;
+       }
+    try
+       { fluid->get_p_crit(pc) ;
+       }
+    catch (EOS_Std_Exception ex)
+       { pc = -1.e0 ;
+       }
+    try
+       { fluid->get_h_crit(hc) ;
+       }
+    catch (EOS_Std_Exception ex)
+       { hc = -1.e0 ;
+       }
+
+    double dp = 0.e0 ;
+    double dh = 0.e0 ;
+    if (mesh_ph->get_exist())
+       { dp = mesh_ph->get_delta_p() ;
+         dh = mesh_ph->get_delta_h() ;
+       }
+    else if (mesh_p->get_exist())
+       dp = mesh_p->get_delta_p() ;
+
+    ipp.set_scalar("pmin", pmin) ;
+    ipp.set_scalar("pmax", pmax) ;
+    ipp.set_scalar("hmin", hmin) ;
+    ipp.set_scalar("hmax", hmax) ;
+    ipp.set_scalar("tmin", Tmin) ;
+    ipp.set_scalar("tmax", Tmax) ;
+    ipp.set_scalar("delta_p", dp) ;
+    ipp.set_scalar("delta_h", dh) ;
+    ipp.set_scalar("tcrit", Tc)  ;
+    ipp.set_scalar("pcrit", pc)  ;
+    ipp.set_scalar("hcrit", hc)  ;
+
+    err = ipp.init_tables() ;
+    return err ;
+  }
+
   EOS_Error EOS_IGen::compute_properties(EOS_Field& field, EOS_Error_Field& err_field)
   { int sz = mesh_ph->get_nb_node() + mesh_ph->get_nb_continuity() ;
     
 //     valable pour les noeuds réels et les noeuds de continuite au centre de mailles
-    fluid->compute(mesh_ph->get_domain_continuity()[1], 
-                   mesh_ph->get_domain_continuity()[0], field, err_field) ;
+    compute_nodes(cache_ph, mesh_ph->get_domain_continuity()[1], 
+                  &mesh_ph->get_domain_continuity()[0], field, err_field) ;
     
     int k = 0 ;
     for (int i=0; i<sz; i++)
@@ -781,7 +1076,7 @@ namespace NEPTUNE_EOS_IGEN
   *  Write in index.eos file (EOS/aata)
   *  EOS_Ipp ; EOS_Ipp_vapor: EOS_Ipp_liquid
   */
-  EOS_Error EOS_IGen::write_index(bool tempory)  
+  EOS_Error EOS_IGen::write_index(bool tempory, const char* const suffix)  
   { 
     const char *ref = reference.aschar() ;
 
@@ -805,9 +1100,10 @@ namespace NEPTUNE_EOS_IGEN
     else
        smed_file += file_med_name ;
 
-    // MED file 
+    // MED file (binary table : registered under its file name)
     AString med_file = smed_file ;
-    med_file += ".med" ;
+    med_file += suffix ;
+    if (strcmp(suffix, ".med") != 0)  smed_file = med_file ;
 
     // line to write in index.eos
     AString line = "Ipp " ;
@@ -866,8 +1162,11 @@ namespace NEPTUNE_EOS_IGEN
   { test_qualities = true ;
 
     int nb_q = qualities.size() ;
+    cache_qi.resize(nb_q) ;
     for (int i=0; i<nb_q; i++)
        { int prop = check_properties(qualities[i].get_property()) ;
+         // reference values at the quality nodes kept from one level to the next
+         set_cache(cache_qi[i], vector<string>(1, qualities[i].get_property().aschar())) ;
          if (prop == 0)
             { cerr << "Error EOS_IGen::compute_qualities :  quality property : " 
                    << qualities[i].get_property()
@@ -913,7 +1212,7 @@ namespace NEPTUNE_EOS_IGEN
               EOS_Error_Field err_eos(ierr) ;
 
               obj_Ipp->compute(nodes[1], nodes[0], res_ipp, err_ipp) ;
-              fluid->compute(nodes[1], nodes[0], res_eos, err_eos) ;
+              compute_nodes(cache_qi[i], nodes[1], &nodes[0], res_eos, err_eos) ;
               qualities[i].make_quality(res_ipp, res_eos, 
                                         mesh_ph->change_test_qualities_nodes()) ;
 
@@ -954,7 +1253,7 @@ namespace NEPTUNE_EOS_IGEN
               EOS_Error_Field err_eos(ierr) ;
               
               obj_Ipp->compute(nodes[0], res_ipp, err_ipp) ;
-              fluid->compute(nodes[0], res_eos, err_eos)   ;
+              compute_nodes(cache_qi[i], nodes[0], NULL, res_eos, err_eos) ;
                       
               qualities[i].make_quality(res_ipp, res_eos, mesh_p->change_test_qualities_nodes()) ;
               
@@ -999,14 +1298,11 @@ namespace NEPTUNE_EOS_IGEN
          
          if (test_level_p && test_level_ph)  break ;
          
-         err = write_tempory_med() ;
+         err = make_obj_Ipp() ;
          if (err != EOS_Error::good)
-            { cerr << "Error EOS_IGen::make_global_refine : no temporary MED file writed" <<endl ;
+            { cerr << "Error EOS_IGen::make_global_refine : interpolator not updated" <<endl ;
               return err ;
             }
-         
-         delete obj_Ipp ;
-         set_obj_Ipp() ;
 
          err = compute_qualities() ;
          if (err != good)
@@ -1049,14 +1345,11 @@ namespace NEPTUNE_EOS_IGEN
          
          if (test_level_p && test_level_ph)  break ;
          refine = true ;
-         err = write_tempory_med() ;
+         err = make_obj_Ipp() ;
          if (err != EOS_Error::good)
-            { cerr << "Error EOS_IGen::make_local_refine : no temporary MED file writed" <<endl ;
+            { cerr << "Error EOS_IGen::make_local_refine : interpolator not updated" <<endl ;
               return err ;
             }
-         
-         delete obj_Ipp ;
-         set_obj_Ipp() ;
 
          err = compute_qualities() ;
          if (err != EOS_Error::good)
@@ -34,12 +34,24 @@
 #include "EOS/API/EOS_Std_Error_Handler.hxx"
 #include "Common/func.hxx"
 #include <vector>
+#include <map>
 using std::vector;
 
 using namespace NEPTUNE;
 
 namespace NEPTUNE_EOS_IGEN
 {
+   //! values of the reference fluid at the nodes already computed
+   //! key : position of the node in the (p,h) domain, the numbering of the nodes
+   //! changes at each refinement of EOS_Mesh
+   struct EOS_IGen_Cache
+   { vector<string> props ;                                 // properties stored, in this order
+     std::map<std::pair<long long, long long>, int> row ;   // node -> row in val, err, lib
+     vector<double> val ;                                   // props.size() values per row
+     vector<int>    err ;
+     vector<int>    lib ;
+   } ;
+
    class EOS_IGen
    { public:
         EOS_IGen() ;
@@ -52,6 +64,9 @@ namespace NEPTUNE_EOS_IGEN
         
         void set_extremum(double p_min, double p_max, double T_min, double T_max) ;
         EOS_Error set_memory_max(int mmax) ;
+        //! number of threads used to compute the reference fluid at the new nodes
+        //! (one EOS object per thread, the reference model must allow it)
+        EOS_Error set_nb_threads(int nthr) ;
         
         void set_obj_Ipp() ;
         EOS* get_obj_Ipp() const;
@@ -84,10 +99,14 @@ namespace NEPTUNE_EOS_IGEN
         
         EOS_Error make_properties(EOS_Med& med) ;
         EOS_Error compute_properties(EOS_Field& field, EOS_Error_Field& error) ;
+        EOS_Error make_obj_Ipp() ;
         
         EOS_Error write_med()               ;
+        //! binary table (EOS_Ipp::save_bin) converted from the MED file of write_med,
+        //! registered in index.eos as <file med name>.bin
+        EOS_Error write_bin()               ;
         EOS_Error write_tempory_med()       ;
-        EOS_Error write_index(bool tempory) ;
+        EOS_Error write_index(bool tempory, const char* const suffix=".med") ;
         
         const AString& get_method() const    ;
         const AString& get_reference() const ;
@@ -109,6 +128,16 @@ namespace NEPTUNE_EOS_IGEN
 
 
      private:
+        void set_cache(EOS_IGen_Cache& cache, const vector<string>& props) ;
+        void clear_caches() ;
+        EOS_Error compute_nodes(EOS_IGen_Cache& cache, const EOS_Field& p, const EOS_Field* h,
+                                EOS_Field& res, EOS_Error_Field& err) ;
+        void compute_new_nodes(EOS_IGen_Cache& cache, const ArrOfDouble& p, const ArrOfDouble* h,
+                               vector<ArrOfDouble>& val, vector<ArrOfInt>& err, vector<ArrOfInt>& lib) ;
+        vector<string> properties_ph()  const ;
+        vector<string> properties_sat() const ;
+        vector<string> properties_lim() const ;
+
         AString method    ;
         AString reference ;
 
@@ -126,6 +155,13 @@ namespace NEPTUNE_EOS_IGEN
         
         EOS* fluid   ;
         EOS* obj_Ipp ;
+        int  nb_threads ;
+        vector<EOS*> fluid_thr ;   // reference fluid of threads 1..nb_threads-1
+
+        EOS_IGen_Cache cache_ph  ;
+        EOS_IGen_Cache cache_sat ;
+        EOS_IGen_Cache cache_lim ;
+        vector<EOS_IGen_Cache> cache_qi ;
         
         EOS_Std_Error_Handler IGen_handler ;
         
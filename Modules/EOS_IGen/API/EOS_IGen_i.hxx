@@ -46,6 +46,7 @@ namespace NEPTUNE_EOS_IGEN
          pmax = p_max ;
          Tmin = T_min ;
          Tmax = T_max ;
+         clear_caches() ;
        }
     else
        cerr<< "Error set_extremum : bad values of "
@@ -101,12 +102,25 @@ namespace NEPTUNE_EOS_IGEN
        }
   }
   
+  // interpolator filled in memory by make_obj_Ipp (no temporary MED file)
   inline void EOS_IGen::set_obj_Ipp()
-  { obj_Ipp = new EOS("EOS_Ipp",tempory_med_name.aschar()) ;
+  { obj_Ipp = new EOS("EOS_Ipp") ;
   }
   
+  inline EOS_Error EOS_IGen::set_nb_threads(int nthr)
+  { if (nthr > 0)
+       { nb_threads = nthr ;
+         return EOS_Error::good ;
+       }
+    else
+       { cerr << "Error set_nb_threads : bad negative or null number of threads" << endl ;
+         return EOS_Error::error ;
+       }
+  }
+
   inline void EOS_IGen::set_fluid()
   { fluid = new EOS(method.aschar(),reference.aschar()) ;
+    clear_caches() ;
   }
   
   inline void EOS_IGen::set_IGen_handler()
@@ -119,11 +133,13 @@ namespace NEPTUNE_EOS_IGEN
   
   inline void EOS_IGen::set_mesh_ph(int nb_node_p, int nb_node_h, int level_max)
   { delete mesh_ph ;
+    clear_caches() ;
     mesh_ph=new EOS_Mesh(nb_node_p, nb_node_h, pmin, pmax, hmin, hmax, level_max);
   }
   
   inline void EOS_IGen::set_mesh_p(int nb_node_p, int level_max)
   { delete mesh_p ;
+    clear_caches() ;
     mesh_p = new EOS_Mesh(nb_node_p, pmin, pmax, level_max) ;
   }
 
@@ -119,6 +119,13 @@ int main()
 	      cerr<<"Error to write med file"<<endl;
 	      exit(Err);
 	    }
+	    // same table in binary format (compared with the MED one in EOSTestIpp)
+	    Err = obj_igen.write_bin();
+	    if (Err!=good)
+	    {
+	      cerr<<"Error to write binary file"<<endl;
+	      exit(Err);
+	    }
 	    
 	  }
 // //  Avec raffinement global
@@ -18,98 +18,160 @@
 
 #include "Functions.hxx"
 #include "Functions/Src/UsersFunction.hxx"
+#include "Functions/Src/Program.hxx"
 
 using FUNCTION::Function;
+using FUNCTION::Program;
 namespace NEPTUNE
 {
   AFunction::
   AFunction(const AString& str, const AString& var)
   {
     func = new Function(str, var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const str, const AString& var)
   {
     func = new Function(AString(str), var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const str, const char* const var)
   {
     func = new Function(AString(str), AString(var));
+    prog = new Program(*func);
+    dprog = nullptr;
   }
 
   AFunction::
   AFunction(const AString& str, const Strings& var)
   {
     func = new Function(str, var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const str, const Strings& var)
   {
     func = new Function(AString(str), var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
 
   AFunction::
   AFunction(const AString& name, const AString& str, const AString& var)
   {
     func = new Function(name, str, var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const name, const AString& str, const AString& var)
   {
     func = new Function(AString(name), str, var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const name, const char* const str, const AString& var)
   {
     func = new Function(AString(name), AString(str), var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const name, const char* const str, const char* const var)
   {
     func = new Function(AString(name), AString(str), AString(var));
+    prog = new Program(*func);
+    dprog = nullptr;
   }
 
   AFunction::
   AFunction(const AString& name, const AString& str, const Strings& var)
   {
     func = new Function(name, str, var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const name, const AString& str, const Strings& var)
   {
     func = new Function(AString(name), str, var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
   AFunction::
   AFunction(const char* const name, const char* const str, const Strings& var)
   {
     func = new Function(AString(name), AString(str), var);
+    prog = new Program(*func);
+    dprog = nullptr;
   }
 
   AFunction::
   ~AFunction()
   {
+    delete dprog;
+    delete prog;
     delete func;
   }
   double AFunction::
   get_value(double x) const
   {
-    return func->get_value(x);
+    return prog->get_value(1, &x);
   }
   double AFunction::
   get_value(double x, double y) const
   {
-    return func->get_value(x,y);
+    double xx[2] = { x, y };
+    return prog->get_value(2, xx);
   }
   double AFunction::
   get_value(double x, double y, double z) const
   {
-    return func->get_value(x,y,z);
+    double xx[3] = { x, y, z };
+    return prog->get_value(3, xx);
   }
   double AFunction::
   get_value(double x, double y, double z, double t) const
   {
-    return func->get_value(x,y,z,t);
+    double xx[4] = { x, y, z, t };
+    return prog->get_value(4, xx);
+  }
+  void AFunction::
+  compute(int n, const double* const* x, double* y) const
+  {
+    prog->compute(n, x, y);
+  }
+  const Program& AFunction::
+  derivatives_program() const
+  {
+    std::call_once(dprog_once, [this] { dprog = new Program(*func, 1); });
+    return *dprog;
+  }
+  double AFunction::
+  get_derivatives(const double* x, double* df) const
+  {
+    const Program& dprog = derivatives_program();
+    std::vector<double> y(dprog.nb_outputs());
+    dprog.get_values(dprog.nb_variables(), x, &y[0]);
+    for (int i=1; i<(int)y.size(); i++)
+      df[i-1] = y[i];
+    return y[0];
+  }
+  void AFunction::
+  compute_derivatives(int n, const double* const* x, double* y, double* const* dy) const
+  {
+    const Program& dprog = derivatives_program();
+    std::vector<double*> yy(dprog.nb_outputs());
+    yy[0] = y;
+    for (int i=1; i<(int)yy.size(); i++)
+      yy[i] = dy[i-1];
+    dprog.compute_values(n, x, &yy[0]);
   }
   void AFunction::
   print_All_Known_Functions()
@@ -21,10 +21,12 @@
 namespace FUNCTION
 {
   class Function;
+  class Program;
 }
 #include "Language/API/Language.hxx"
 
 #include <iostream>
+#include <mutex>
 namespace NEPTUNE
 {
   class AFunction
@@ -58,6 +60,12 @@ namespace NEPTUNE
     double get_value(double x, double y) const;
     double get_value(double x, double y, double z) const;
     double get_value(double x, double y, double z, double t) const;
+    //! y[k] = f(x[0][k], x[1][k], ...) for k<n, one array per main variable
+    void compute(int n, const double* const* x, double* y) const;
+    //! returns f(x) and df[i] = df/dx_i, x and df sized as the main variables
+    double get_derivatives(const double* x, double* df) const;
+    //! y[k] = f(x[.][k]) and dy[i][k] = df/dx_i(x[.][k]) for k<n
+    void compute_derivatives(int n, const double* const* x, double* y, double* const* dy) const;
     static void print_All_Known_Functions();
     AString asString() const;
     AString derivative(int) const;
@@ -65,6 +73,13 @@ namespace NEPTUNE
   private :
     static int self_test();
     FUNCTION::Function *func;
+    //! compiled form of func, used for the evaluations
+    FUNCTION::Program *prog;
+    //! f and its derivatives with respect to all the main variables,
+    //! built at the first get_derivatives/compute_derivatives call
+    mutable FUNCTION::Program *dprog;
+    mutable std::once_flag dprog_once;
+    const FUNCTION::Program& derivatives_program() const;
   };
 }
 // M.F. #include "Functions_i.hxx"
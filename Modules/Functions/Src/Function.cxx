@@ -17,6 +17,7 @@
 
 #include "PredefinedFunctions.hxx"
 #include "UsersFunction.hxx"
+#include "Program.hxx"
 #include <sstream>
 #include <string.h>
 #define __BLOCSZ__ 512
@@ -976,6 +977,37 @@ namespace FUNCTION
       }
     return 0;
   }
+  int Function::compile(Program& prog) const
+  { assert(test()) ;
+    switch(operation_id)
+      { case VAR :
+          return prog.variable(var_id) ;
+        case FINAL :
+          return prog.constant(value) ;
+        case COMP :
+          return left->compile(prog) ;
+        case ADD :
+        case SUBSTRACT :
+        case DIVIDE :
+        case MULTIPLY :
+        case POWER :
+        case LT :
+        case GT :
+        case LE :
+        case GE :
+        case MOD :
+          { int a = left->compile(prog) ;
+            int b = right->compile(prog) ;
+            return prog.binary(operation_id, a, b) ;
+          }
+        case ARG :
+        case ERR :
+        default :
+          assert(0) ;
+      }
+    return -1 ;
+  }
+
   int Function::Variable_id(const char* const str) const
   { if (str[0]=='(')
        { NEPTUNE::AString tmp(str);
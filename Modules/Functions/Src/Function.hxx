@@ -43,6 +43,8 @@ enum operation
 
 namespace FUNCTION
 {
+  class Program ;
+
   class Function 
   {
   public :
@@ -74,6 +76,8 @@ namespace FUNCTION
     virtual AString asString() const;
     virtual AString derivative(int) const;
     const Strings& get_main_variables() const;
+    //! lowers the tree in prog, returns the register of the result
+    virtual int compile(Program& prog) const;
   protected :
     int is_root() const;
     Function(int n, Function* mo);
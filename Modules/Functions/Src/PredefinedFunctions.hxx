@@ -33,6 +33,7 @@
     virtual std::istream&				\
       read_On (std::istream& stream=std::cin);		\
     virtual NEPTUNE::AString derivative(int) const;	\
+    virtual int compile(Program& prog) const;		\
   private :						\
     mutable double old_var;				\
   };
@@ -19,6 +19,7 @@
 #define PREDEFFUNCTION_I_HH 1
 
 #include <random>
+#include "Program.hxx"
 
 #define implemente(_TYPE_, STR_TYPE_)                                   \
   inline _TYPE_::_TYPE_(const NEPTUNE::AString& str, Function* mo)      \
@@ -43,6 +44,10 @@
   }                                                                     \
   inline std::istream& _TYPE_::read_On(std::istream &stream)  {         \
     return stream ;                                                     \
+  }                                                                     \
+  inline int _TYPE_::compile(Program& prog) const {                     \
+    assert(left);                                                       \
+    return prog.unary(I##_TYPE_, left->compile(prog));                  \
   }
 
 
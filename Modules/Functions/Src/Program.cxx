@@ -0,0 +1,414 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+#include "Program.hxx"
+#include "PredefinedFunctions.hxx"
+#include <random>
+#include <algorithm>
+
+namespace FUNCTION
+{
+  Program::Program(const Function& f, int derivatives)
+    : nvar(f.get_main_variables().size()), ntmp(0)
+  { int res = f.compile(*this) ;
+    outputs.push_back(res) ;
+    if (derivatives)  differentiate(res) ;
+    allocate() ;
+    known.clear() ;
+  }
+
+  int Program::variable(int i)
+  { if (args.empty())
+       { assert(i>=0 && i<nvar) ;
+         return i ;
+       }
+    // inlined users function : the argument, or 0 when it is not given
+    const std::vector<int>& regs = args.back() ;
+    if (i < (int)regs.size())  return regs[i] ;
+    return constant(0) ;
+  }
+
+  int Program::constant(double c)
+  { for (size_t i=0; i<constants.size(); i++)
+       if (constants[i] == c)  return -(int)i - 1 ;
+    constants.push_back(c) ;
+    return -(int)constants.size() ;
+  }
+
+  int Program::is_constant(int r, double c) const
+  { return r < 0 && constants[-r-1] == c ;
+  }
+
+  double Program::eval(int c, double a, double b)
+  { switch(c)
+       { case C_ADD :  return a + b ;
+         case C_SUB :  return a - b ;
+         case C_MUL :  return a * b ;
+         case C_DIV :  return a / b ;
+         case C_POW :  return pow(a, b) ;
+         case C_LT :   return a <  b ;
+         case C_GT :   return a >  b ;
+         case C_LE :   return a <= b ;
+         case C_GE :   return a >= b ;
+         case C_MOD :  return int(a) % int(b) ;
+         case C_SIN :  return sin(a)  ;
+         case C_COS :  return cos(a)  ;
+         case C_TAN :  return tan(a)  ;
+         case C_LN :   return log(a)  ;
+         case C_EXP :  return exp(a)  ;
+         case C_SQRT : return sqrt(a) ;
+         case C_INT :  return int(a)  ;
+         case C_ERF :  return erf(a)  ;
+         case C_COSH : return cosh(a) ;
+         case C_SINH : return sinh(a) ;
+         case C_TANH : return tanh(a) ;
+         default :
+            assert(0) ;
+       }
+    return 0 ;
+  }
+
+  // unary instructions have b == a
+  // every instruction writes a new temporary (nvar + its rank) until allocate()
+  int Program::emit(int c, int a, int b)
+  { // constant operands : computed now
+    if (a < 0 && b < 0 && !(c == C_MOD && int(constants[-b-1]) == 0))
+       return constant(eval(c, constants[-a-1], constants[-b-1])) ;
+    if ((c == C_ADD || c == C_MUL) && b < a)  std::swap(a, b) ;
+    std::vector<int> key(3) ;
+    key[0] = c ;
+    key[1] = a ;
+    key[2] = b ;
+    std::map<std::vector<int>, int>::const_iterator it = known.find(key) ;
+    if (it != known.end())  return it->second ;
+    int dst = nvar + (int)code_list.size() ;
+    instruction ins = { c, dst, a, b } ;
+    code_list.push_back(ins) ;
+    known[key] = dst ;
+    return dst ;
+  }
+
+  int Program::unary(int id, int a)
+  { switch(id)
+       { case ISIN :   return emit(C_SIN,  a, a) ;
+         case ICOS :   return emit(C_COS,  a, a) ;
+         case ITAN :   return emit(C_TAN,  a, a) ;
+         case ILN :    return emit(C_LN,   a, a) ;
+         case IEXP :   return emit(C_EXP,  a, a) ;
+         case ISQRT :  return emit(C_SQRT, a, a) ;
+         case IINT :   return emit(C_INT,  a, a) ;
+         case IERF :   return emit(C_ERF,  a, a) ;
+         case ICOSH :  return emit(C_COSH, a, a) ;
+         case ISINH :  return emit(C_SINH, a, a) ;
+         case ITANH :  return emit(C_TANH, a, a) ;
+         case IRND :
+            { // RND::compute_value draws from a new default engine : always the same factor
+              std::uniform_real_distribution<double> unif(0.,1.) ;
+              std::default_random_engine re ;
+              return emit(C_MUL, a, constant(unif(re))) ;
+            }
+         default :
+            assert(0) ;
+       }
+    return -1 ;
+  }
+
+  int Program::binary(operation op, int a, int b)
+  { switch(op)
+       { case ADD :        return emit(C_ADD, a, b) ;
+         case SUBSTRACT :  return emit(C_SUB, a, b) ;
+         case MULTIPLY :   return emit(C_MUL, a, b) ;
+         case DIVIDE :     return emit(C_DIV, a, b) ;
+         case POWER :      return emit(C_POW, a, b) ;
+         case LT :         return emit(C_LT,  a, b) ;
+         case GT :         return emit(C_GT,  a, b) ;
+         case LE :         return emit(C_LE,  a, b) ;
+         case GE :         return emit(C_GE,  a, b) ;
+         case MOD :        return emit(C_MOD, a, b) ;
+         default :
+            assert(0) ;
+       }
+    return -1 ;
+  }
+
+  void Program::push_args(const std::vector<int>& regs)
+  { args.push_back(regs) ;
+  }
+
+  void Program::pop_args()
+  { args.pop_back() ;
+  }
+
+  // derivatives : 0 and 1 are simplified away
+  int Program::d_add(int a, int b)
+  { if (is_constant(a, 0))  return b ;
+    if (is_constant(b, 0))  return a ;
+    return emit(C_ADD, a, b) ;
+  }
+
+  int Program::d_sub(int a, int b)
+  { if (is_constant(b, 0))  return a ;
+    return emit(C_SUB, a, b) ;
+  }
+
+  int Program::d_mul(int a, int b)
+  { if (is_constant(a, 0) || is_constant(b, 0))  return constant(0) ;
+    if (is_constant(a, 1))  return b ;
+    if (is_constant(b, 1))  return a ;
+    return emit(C_MUL, a, b) ;
+  }
+
+  int Program::d_div(int a, int b)
+  { if (is_constant(a, 0) || is_constant(b, 1))  return a ;
+    return emit(C_DIV, a, b) ;
+  }
+
+  // forward differentiation of the instructions of f, one variable at a time ;
+  // the values needed by the derivatives are shared with f through emit
+  void Program::differentiate(int f)
+  { int nval = (int)code_list.size() ;
+    int zero = constant(0) ;
+    int one  = constant(1) ;
+    std::vector<int> d(nvar+nval) ;
+    for (int j=0; j<nvar; j++)
+       { for (int i=0; i<nvar; i++)  d[i] = (i == j) ? one : zero ;
+         for (int i=0; i<nval; i++)
+            { instruction ins = code_list[i] ;   // copy : emit appends to code_list
+              int v  = ins.dst ;
+              int a  = ins.a ;
+              int b  = ins.b ;
+              int da = (a < 0) ? zero : d[a] ;
+              int db = (b < 0) ? zero : d[b] ;
+              int dv = zero ;
+              if (!is_constant(da, 0) || !is_constant(db, 0))
+                 switch(ins.code)
+                    { case C_ADD :
+                         dv = d_add(da, db) ;
+                         break ;
+                      case C_SUB :
+                         dv = d_sub(da, db) ;
+                         break ;
+                      case C_MUL :
+                         dv = d_add(d_mul(da, b), d_mul(a, db)) ;
+                         break ;
+                      case C_DIV :   // (da - v.db) / b
+                         dv = d_div(d_sub(da, d_mul(v, db)), b) ;
+                         break ;
+                      case C_POW :
+                         if (is_constant(db, 0))   // b.a^(b-1).da
+                            { int e = emit(C_SUB, b, one) ;
+                              int p = is_constant(e, 1) ? a : emit(C_POW, a, e) ;
+                              dv = d_mul(d_mul(b, p), da) ;
+                            }
+                         else                      // v.(db.ln(a) + b.da/a)
+                            dv = d_mul(v, d_add(d_mul(db, emit(C_LN, a, a)),
+                                                d_div(d_mul(b, da), a))) ;
+                         break ;
+                      case C_LT :
+                      case C_GT :
+                      case C_LE :
+                      case C_GE :
+                      case C_MOD :
+                      case C_INT :   // piecewise constant
+                         break ;
+                      case C_SIN :
+                         dv = d_mul(da, emit(C_COS, a, a)) ;
+                         break ;
+                      case C_COS :
+                         dv = d_sub(zero, d_mul(da, emit(C_SIN, a, a))) ;
+                         break ;
+                      case C_TAN :
+                         { int c = emit(C_COS, a, a) ;
+                           dv = d_div(da, emit(C_MUL, c, c)) ;
+                         }
+                         break ;
+                      case C_LN :
+                         dv = d_div(da, a) ;
+                         break ;
+                      case C_EXP :
+                         dv = d_mul(da, v) ;
+                         break ;
+                      case C_SQRT :
+                         dv = d_div(da, emit(C_MUL, constant(2), v)) ;
+                         break ;
+                      case C_ERF :   // 2/sqrt(pi).exp(-a^2).da
+                         { int m = emit(C_SUB, zero, emit(C_MUL, a, a)) ;
+                           int e = emit(C_EXP, m, m) ;
+                           dv = d_mul(da, emit(C_MUL, constant(2/sqrt(M_PI)), e)) ;
+                         }
+                         break ;
+                      case C_COSH :
+                         dv = d_mul(da, emit(C_SINH, a, a)) ;
+                         break ;
+                      case C_SINH :
+                         dv = d_mul(da, emit(C_COSH, a, a)) ;
+                         break ;
+                      case C_TANH :
+                         dv = d_mul(da, emit(C_SUB, one, emit(C_MUL, v, v))) ;
+                         break ;
+                      default :
+                         assert(0) ;
+                    }
+              d[v] = dv ;
+            }
+         outputs.push_back((f < 0) ? zero : d[f]) ;
+       }
+  }
+
+  // dead instructions are dropped and the temporaries renumbered :
+  // a register is reused as soon as its last reader has run
+  void Program::allocate()
+  { int n = (int)code_list.size() ;
+    std::vector<int> live(n, 0) ;
+    std::vector<int> last(n, -1) ;
+    for (size_t j=0; j<outputs.size(); j++)
+       if (outputs[j] >= nvar)
+          { live[outputs[j]-nvar] = 1 ;
+            last[outputs[j]-nvar] = n ;
+          }
+    for (int i=n-1; i>=0; i--)
+       if (live[i])
+          { const instruction& ins = code_list[i] ;
+            if (ins.a >= nvar)
+               { live[ins.a-nvar] = 1 ;
+                 if (last[ins.a-nvar] < 0)  last[ins.a-nvar] = i ;
+               }
+            if (ins.b >= nvar)
+               { live[ins.b-nvar] = 1 ;
+                 if (last[ins.b-nvar] < 0)  last[ins.b-nvar] = i ;
+               }
+          }
+    std::vector<int> reg(n, -1) ;
+    std::vector<int> free_tmp ;
+    std::vector<instruction> kept ;
+    ntmp = 0 ;
+    for (int i=0; i<n; i++)
+       if (live[i])
+          { instruction ins = code_list[i] ;
+            int a = ins.a ;
+            int b = ins.b ;
+            if (a >= nvar)  ins.a = reg[a-nvar] ;
+            if (b >= nvar)  ins.b = reg[b-nvar] ;
+            // d[k] = a[k] op b[k] : the destination may be an operand
+            if (a >= nvar && last[a-nvar] == i)  free_tmp.push_back(reg[a-nvar]) ;
+            if (b >= nvar && b != a && last[b-nvar] == i)  free_tmp.push_back(reg[b-nvar]) ;
+            if (free_tmp.empty())
+               ins.dst = nvar + ntmp++ ;
+            else
+               { ins.dst = free_tmp.back() ;
+                 free_tmp.pop_back() ;
+               }
+            reg[i] = ins.dst ;
+            kept.push_back(ins) ;
+          }
+    code_list.swap(kept) ;
+    for (size_t j=0; j<outputs.size(); j++)
+       { int r = outputs[j] ;
+         if (r >= nvar)  r = reg[r-nvar] ;
+         outputs[j] = index(r) ;
+       }
+    // registers numbering : variables, constants, temporaries
+    for (size_t i=0; i<code_list.size(); i++)
+       { instruction& ins = code_list[i] ;
+         ins.dst = index(ins.dst) ;
+         ins.a   = index(ins.a)   ;
+         ins.b   = index(ins.b)   ;
+       }
+  }
+
+  void Program::run(int m, double* reg, int stride) const
+  { for (size_t i=0; i<code_list.size(); i++)
+       { const instruction& ins = code_list[i] ;
+         double* d = reg + ins.dst*stride ;
+         const double* a = reg + ins.a*stride ;
+         const double* b = reg + ins.b*stride ;
+         switch(ins.code)
+            { case C_ADD :  for (int k=0; k<m; k++)  d[k] = a[k] + b[k] ; break ;
+              case C_SUB :  for (int k=0; k<m; k++)  d[k] = a[k] - b[k] ; break ;
+              case C_MUL :  for (int k=0; k<m; k++)  d[k] = a[k] * b[k] ; break ;
+              case C_DIV :  for (int k=0; k<m; k++)  d[k] = a[k] / b[k] ; break ;
+              case C_POW :  for (int k=0; k<m; k++)  d[k] = pow(a[k], b[k]) ; break ;
+              case C_LT :   for (int k=0; k<m; k++)  d[k] = a[k] <  b[k] ; break ;
+              case C_GT :   for (int k=0; k<m; k++)  d[k] = a[k] >  b[k] ; break ;
+              case C_LE :   for (int k=0; k<m; k++)  d[k] = a[k] <= b[k] ; break ;
+              case C_GE :   for (int k=0; k<m; k++)  d[k] = a[k] >= b[k] ; break ;
+              case C_MOD :  for (int k=0; k<m; k++)  d[k] = int(a[k]) % int(b[k]) ; break ;
+              case C_SIN :  for (int k=0; k<m; k++)  d[k] = sin(a[k])  ; break ;
+              case C_COS :  for (int k=0; k<m; k++)  d[k] = cos(a[k])  ; break ;
+              case C_TAN :  for (int k=0; k<m; k++)  d[k] = tan(a[k])  ; break ;
+              case C_LN :   for (int k=0; k<m; k++)  d[k] = log(a[k])  ; break ;
+              case C_EXP :  for (int k=0; k<m; k++)  d[k] = exp(a[k])  ; break ;
+              case C_SQRT : for (int k=0; k<m; k++)  d[k] = sqrt(a[k]) ; break ;
+              case C_INT :  for (int k=0; k<m; k++)  d[k] = int(a[k])  ; break ;
+              case C_ERF :  for (int k=0; k<m; k++)  d[k] = erf(a[k])  ; break ;
+              case C_COSH : for (int k=0; k<m; k++)  d[k] = cosh(a[k]) ; break ;
+              case C_SINH : for (int k=0; k<m; k++)  d[k] = sinh(a[k]) ; break ;
+              case C_TANH : for (int k=0; k<m; k++)  d[k] = tanh(a[k]) ; break ;
+              default :
+                 assert(0) ;
+            }
+       }
+  }
+
+  double Program::get_value(int nx, const double* x) const
+  { if (outputs.size() == 1)
+       { double y ;
+         get_values(nx, x, &y) ;
+         return y ;
+       }
+    std::vector<double> y(outputs.size()) ;
+    get_values(nx, x, &y[0]) ;
+    return y[0] ;
+  }
+
+  void Program::get_values(int nx, const double* x, double* y) const
+  { double small[64] ;
+    std::vector<double> big ;
+    int nreg = nb_registers() ;
+    double* reg = small ;
+    if (nreg > 64)
+       { big.resize(nreg) ;
+         reg = &big[0] ;
+       }
+    for (int i=0; i<nvar; i++)  reg[i] = (i < nx) ? x[i] : 0 ;
+    for (size_t i=0; i<constants.size(); i++)  reg[nvar+i] = constants[i] ;
+    run(1, reg, 1) ;
+    for (size_t j=0; j<outputs.size(); j++)  y[j] = reg[outputs[j]] ;
+  }
+
+  void Program::compute(int n, const double* const* x, double* y) const
+  { std::vector<double*> yy(outputs.size(), (double*)0) ;
+    yy[0] = y ;
+    compute_values(n, x, &yy[0]) ;
+  }
+
+  void Program::compute_values(int n, const double* const* x, double* const* y) const
+  { const int block = 64 ;
+    std::vector<double> reg(nb_registers()*block) ;
+    for (size_t i=0; i<constants.size(); i++)
+       for (int k=0; k<block; k++)  reg[(nvar+i)*block+k] = constants[i] ;
+    for (int start=0; start<n; start+=block)
+       { int m = (n-start < block) ? n-start : block ;
+         for (int i=0; i<nvar; i++)
+            for (int k=0; k<m; k++)  reg[i*block+k] = x[i][start+k] ;
+         run(m, &reg[0], block) ;
+         for (size_t j=0; j<outputs.size(); j++)
+            if (y[j])
+               for (int k=0; k<m; k++)  y[j][start+k] = reg[outputs[j]*block+k] ;
+       }
+  }
+}
@@ -0,0 +1,98 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+#ifndef PROGRAM_HH
+#define PROGRAM_HH 1
+
+#include "Function.hxx"
+#include <vector>
+#include <map>
+
+namespace FUNCTION
+{
+  //! Flat, register based, form of a Function tree
+  /*!
+   * The tree is lowered once into a list of instructions. The evaluation
+   * only reads the Program and works on registers owned by the caller,
+   * so that one Program can be run by several threads at a time.
+   * Registers are the variables, then the constants, then the temporaries.
+   * Users functions are inlined, their variables being their arguments.
+   * Identical instructions are computed once (common subexpressions).
+   *
+   * With derivatives, the outputs are f, df/dx0, df/dx1, ... for all the
+   * main variables ; the derivatives reuse the values computed for f.
+   */
+  class Program
+  {
+  public :
+    Program(const Function& f, int derivatives=0);
+    int nb_variables() const;
+    int nb_registers() const;
+    int nb_instructions() const;
+    int nb_outputs() const;
+    //! f(x[0],...,x[nx-1],0,...,0)
+    double get_value(int nx, const double* x) const;
+    //! y[j] : output j at x[0],...,x[nx-1],0,...,0 (nb_outputs() values)
+    void get_values(int nx, const double* x, double* y) const;
+    //! y[k] = f(x[0][k], x[1][k], ...) for k<n (nb_variables() arrays in x)
+    void compute(int n, const double* const* x, double* y) const;
+    //! y[j][k] : output j at x[0][k], x[1][k], ... (nb_outputs() arrays in y, null ones skipped)
+    void compute_values(int n, const double* const* x, double* const* y) const;
+
+    //! Used by Function::compile : registers of the tree leaves
+    int variable(int i);
+    int constant(double c);
+    //! Used by Function::compile : instructions, return the result register
+    int unary(int id, int a);        // id : Function_ID
+    int binary(operation op, int a, int b);
+    //! Used by Function::compile : variables of an inlined users function
+    void push_args(const std::vector<int>& regs);
+    void pop_args();
+
+  private :
+    enum code
+      { C_ADD, C_SUB, C_MUL, C_DIV, C_POW, C_LT, C_GT, C_LE, C_GE, C_MOD,
+        C_SIN, C_COS, C_TAN, C_LN, C_EXP, C_SQRT, C_INT, C_ERF,
+        C_COSH, C_SINH, C_TANH
+      };
+    struct instruction
+    { int code, dst, a, b ;
+    };
+    static double eval(int c, double a, double b);
+    int emit(int c, int a, int b);
+    int is_constant(int r, double c) const;
+    int d_add(int a, int b);
+    int d_sub(int a, int b);
+    int d_mul(int a, int b);
+    int d_div(int a, int b);
+    void differentiate(int f);
+    void allocate();
+    int index(int r) const;
+    void run(int m, double* reg, int stride) const;
+
+    int nvar ;
+    int ntmp ;
+    std::vector<int> outputs ;
+    std::vector<double> constants ;
+    std::vector<instruction> code_list ;
+    // compilation only
+    std::map<std::vector<int>, int> known ;
+    std::vector< std::vector<int> > args ;
+  };
+}
+#include "Program_i.hxx"
+#endif
@@ -0,0 +1,47 @@
+/****************************************************************************
+* Copyright (c) 2023, CEA
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice, this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following disclaimer in the documentation and/or other materials provided with the distribution.
+* 3. Neither the name of the copyright holder nor the names of its contributors may be used to endorse or promote products derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+* OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+*****************************************************************************/
+
+
+
+#ifndef PROGRAM_I_HH
+#define PROGRAM_I_HH 1
+
+namespace FUNCTION
+{
+  inline int Program::nb_variables() const
+  { return nvar ;
+  }
+
+  inline int Program::nb_registers() const
+  { return nvar + (int)constants.size() + ntmp ;
+  }
+
+  inline int Program::nb_instructions() const
+  { return (int)code_list.size() ;
+  }
+
+  inline int Program::nb_outputs() const
+  { return (int)outputs.size() ;
+  }
+
+  // during the compilation, constants are numbered -1, -2, ... and
+  // temporaries from nvar ; they are put after the constants at the end
+  inline int Program::index(int r) const
+  { if (r < 0)     return nvar - r - 1 ;
+    if (r < nvar)  return r ;
+    return r + (int)constants.size() ;
+  }
+}
+#endif
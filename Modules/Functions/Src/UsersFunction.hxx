@@ -19,6 +19,7 @@
 #define USERSFUNCTION_HH 1
 
 #include "Function.hxx"
+#include "Program.hxx"
 
 namespace FUNCTION
 {
@@ -28,6 +29,8 @@ namespace FUNCTION
     Arg(const NEPTUNE::AString&, Function* );
     ~Arg();
     double arg(int ) const;
+    //! compiles the arguments, appends their registers to regs
+    void compile_args(Program& prog, std::vector<int>& regs) const;
     int nb;
     virtual std::ostream&                                             
     print_On (std::ostream& stream=std::cout) const; 
@@ -44,6 +47,7 @@ namespace FUNCTION
     virtual std::ostream&                                             
     print_On (std::ostream& stream=std::cout) const; 
     virtual NEPTUNE::AString derivative(int) const;           
+    virtual int compile(Program& prog) const;
   private :	
     NEPTUNE::AString name;
     Function* f; 
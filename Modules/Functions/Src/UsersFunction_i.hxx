@@ -109,6 +109,12 @@ namespace FUNCTION
     else
       return static_cast<Arg*>(right)->arg(--i);
   }
+  inline void Arg::compile_args(Program& prog, std::vector<int>& regs) const
+  {
+    regs.push_back(left->compile(prog));
+    if(right)
+      static_cast<Arg*>(right)->compile_args(prog, regs);
+  }
   inline Arg::
   Arg()
   {
@@ -154,6 +160,17 @@ namespace FUNCTION
     double x=static_cast<Arg&>(*left).arg(0);
     return f->get_value(x);
   }
+  // f is inlined, its variables being the arguments
+  inline int UsersFunction::
+  compile(Program& prog) const
+  {
+    std::vector<int> regs;
+    static_cast<Arg&>(*left).compile_args(prog, regs);
+    prog.push_args(regs);
+    int res=f->compile(prog);
+    prog.pop_args();
+    return res;
+  }
   inline std::ostream& UsersFunction::
   print_On (std::ostream& stream) const
   {
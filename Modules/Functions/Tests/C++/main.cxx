@@ -20,7 +20,8 @@ int main()
 {
   var[0]="x";
   var[1]="y";
-  test();
+  if (!test())
+    return 1;
   AFunction pi("pi", "3.14159265358979323846", "t");
   std::ofstream fic_psi("psi.gnu");
   std::ofstream fic_u("u.gnu");
@@ -17,8 +17,11 @@
 
 #include "Language/API/Language.hxx"
 #include "Functions/API/Functions.hxx"
+#include "Functions/Src/Function.hxx"
 
 #include <fstream>
+#include <cmath>
+#include <algorithm>
 
 using namespace NEPTUNE;
 
@@ -174,5 +177,62 @@ inline int test()
   std::cout << div_str << std::endl;
   AFunction div(div_str, var);
   std::cout << div.asString() << std::endl;
+  const int n = 100;
+  double x[n], y[n], r[n];
+  for (int i=0; i<n; i++)
+    {
+      x[i] = 0.01*i;
+      y[i] = 1.-0.02*i;
+    }
+  const double* xy[2] = { x, y };
+  div.compute(n, xy, r);
+  // reference : evaluation by the expression tree, and analytic value
+  FUNCTION::Function div_tree(div_str, var);
+  double ecart_tree = 0., ecart_exact = 0.;
+  for (int i=0; i<n; i++)
+    {
+      ecart_tree  = std::max(ecart_tree,  std::fabs(r[i] - div_tree.get_value(x[i], y[i])));
+      ecart_exact = std::max(ecart_exact, std::fabs(r[i] - (sin(x[i])-cos(y[i]))));
+    }
+  std::cout << "div compute : max ecart arbre " << ecart_tree
+            << " max ecart exact " << ecart_exact << std::endl;
+  if (ecart_tree > 1.e-14 || ecart_exact > 1.e-12)
+    {
+      std::cout << "ERROR : div compute" << std::endl;
+      return 0;
+    }
+  AFunction g("x*EXP(x*y)+SQRT(y+2)", var);
+  double gx[n], gy[n];
+  double* dg[2] = { gx, gy };
+  g.compute_derivatives(n, xy, r, dg);
+  // reference : expression tree of g, derivatives by centered differences on the tree
+  FUNCTION::Function g_tree("x*EXP(x*y)+SQRT(y+2)", var);
+  const double eps = 1.e-6;
+  double ecart_point = 0., ecart_diff = 0.;
+  ecart_tree = ecart_exact = 0.;
+  for (int i=0; i<n; i++)
+    {
+      double e = exp(x[i]*y[i]);
+      double xi[2] = { x[i], y[i] };
+      double df[2];
+      double gi = g.get_derivatives(xi, df);
+      ecart_point = std::max(ecart_point, std::fabs(gi - r[i]));
+      ecart_point = std::max(ecart_point, std::max(std::fabs(df[0] - gx[i]), std::fabs(df[1] - gy[i])));
+      ecart_tree = std::max(ecart_tree, std::fabs(r[i] - g_tree.get_value(x[i], y[i])));
+      double dx = (g_tree.get_value(x[i]+eps, y[i]) - g_tree.get_value(x[i]-eps, y[i])) / (2*eps);
+      double dy = (g_tree.get_value(x[i], y[i]+eps) - g_tree.get_value(x[i], y[i]-eps)) / (2*eps);
+      ecart_diff = std::max(ecart_diff, std::max(std::fabs(gx[i] - dx), std::fabs(gy[i] - dy)));
+      ecart_exact = std::max(ecart_exact, std::fabs(gx[i] - (e + x[i]*y[i]*e)));
+      ecart_exact = std::max(ecart_exact, std::fabs(gy[i] - (x[i]*x[i]*e + 0.5/sqrt(y[i]+2))));
+    }
+  std::cout << "gradient : max ecart point/tableau " << ecart_point
+            << " max ecart arbre " << ecart_tree
+            << " max ecart differences " << ecart_diff
+            << " max ecart exact " << ecart_exact << std::endl;
+  if (ecart_point != 0. || ecart_tree > 1.e-14 || ecart_diff > 1.e-6 || ecart_exact > 1.e-12)
+    {
+      std::cout << "ERROR : gradient" << std::endl;
+      return 0;
+    }
   return 1;
 }
@@ -32,12 +32,15 @@ namespace NEPTUNE
   public:
 
     ArrOfDouble (const ArrOfDouble &right) ;
+    ArrOfDouble (ArrOfDouble &&right) noexcept ;
     ArrOfDouble (int nsz=0, const double& x=0) ;
     ArrOfDouble (int nsz, const double* ptr) ;
+    ArrOfDouble (int nsz, LANGUAGE_KERNEL::ArrOf_uninitialized) ;
 
     virtual ~ArrOfDouble();
 
     ArrOfDouble & operator=(const ArrOfDouble &right);
+    ArrOfDouble & operator=(ArrOfDouble &&right) noexcept;
     ArrOfDouble & operator=(const double& );
     ArrOfDouble & operator+=(const double& );
     ArrOfDouble & operator+=(const ArrOfDouble& );
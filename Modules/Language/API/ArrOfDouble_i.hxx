@@ -30,11 +30,26 @@ namespace NEPTUNE
   {
   }
 
+  inline ArrOfDouble::ArrOfDouble (int nsz, LANGUAGE_KERNEL::ArrOf_uninitialized u)
+    : LANGUAGE_KERNEL::ArrOf<double>(nsz, u)
+  {
+  }
+
   inline ArrOfDouble& ArrOfDouble::operator=(const ArrOfDouble& x)
   { LANGUAGE_KERNEL::ArrOf<double>::operator=(x) ;
     return *this ;
   }
 
+  inline ArrOfDouble::ArrOfDouble (ArrOfDouble &&right) noexcept
+    : UObject(), LANGUAGE_KERNEL::ArrOf<double>(std::move(right))
+  {
+  }
+
+  inline ArrOfDouble& ArrOfDouble::operator=(ArrOfDouble&& x) noexcept
+  { LANGUAGE_KERNEL::ArrOf<double>::operator=(std::move(x)) ;
+    return *this ;
+  }
+
   inline ArrOfDouble& ArrOfDouble::operator=(const double& x)
   { LANGUAGE_KERNEL::ArrOf<double>::operator=(x) ;
     return *this ;
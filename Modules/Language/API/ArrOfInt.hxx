@@ -33,12 +33,15 @@ namespace NEPTUNE
   public:
 
     ArrOfInt (const ArrOfInt &right);
+    ArrOfInt (ArrOfInt &&right) noexcept;
     ArrOfInt (int nsz=0, const int& x=0);
     ArrOfInt (int nsz, const int* ptr);
+    ArrOfInt (int nsz, LANGUAGE_KERNEL::ArrOf_uninitialized);
 
     virtual ~ArrOfInt();
 
     ArrOfInt & operator=(const ArrOfInt &right);
+    ArrOfInt & operator=(ArrOfInt &&right) noexcept;
     ArrOfInt & operator=(const int& );
     ArrOfInt & operator+=(const int& );
     ArrOfInt & operator+=(const ArrOfInt& );
@@ -32,11 +32,26 @@ namespace NEPTUNE
   {
   }
 
+  inline ArrOfInt::ArrOfInt (int nsz, LANGUAGE_KERNEL::ArrOf_uninitialized u)
+    : LANGUAGE_KERNEL::ArrOf<int>(nsz, u)
+  {
+  }
+
   inline ArrOfInt& ArrOfInt::operator=(const ArrOfInt& x)
   { LANGUAGE_KERNEL::ArrOf<int>::operator=(x) ;
     return *this ;
   }
 
+  inline ArrOfInt::ArrOfInt (ArrOfInt &&right) noexcept
+    : UObject(), LANGUAGE_KERNEL::ArrOf<int>(std::move(right))
+  {
+  }
+
+  inline ArrOfInt& ArrOfInt::operator=(ArrOfInt&& x) noexcept
+  { LANGUAGE_KERNEL::ArrOf<int>::operator=(std::move(x)) ;
+    return *this ;
+  }
+
   inline ArrOfInt& ArrOfInt::operator=(const int& x)
   { LANGUAGE_KERNEL::ArrOf<int>::operator=(x) ;
     return *this ;
@@ -18,25 +18,91 @@
 #ifndef ArrOfT_h
 #define ArrOfT_h 1
 
+#include <stddef.h>
+#include <atomic>
+
 namespace LANGUAGE_KERNEL
 {
+  //! tag of the constructors leaving the data uninitialized :
+  //!   ArrOfDouble x(n, LANGUAGE_KERNEL::uninitialized) ;
+  struct ArrOf_uninitialized {} ;
+  static const ArrOf_uninitialized uninitialized = ArrOf_uninitialized() ;
+
+  //! Memory blocks of the arrays : 64 bytes aligned, the small ones
+  //! (up to 256 bytes, header included) are recycled by a per thread pool.
+  //! Define ARROF_NO_POOL to always use the system allocator.
+  class ArrOf_memory
+  {
+  public :
+    static const size_t align = 64 ;
+    static void* allocate(size_t size) ;
+    static void  release(void* ptr, size_t size) ;
+  private :
+    static const int nb_classes = 3 ;    // 64, 128, 256 bytes
+    static const int max_free   = 1024 ; // blocks kept per class and thread
+    struct Pool
+    { void* head[nb_classes] ;
+      int   nb[nb_classes] ;
+      Pool() ;
+      ~Pool() ;
+      static bool& closed() ;
+    } ;
+    static int size_class(size_t size) ;
+    //! pool of the calling thread, 0 once it has been destroyed
+    static Pool* pool() ;
+  } ;
+
+  //! Header of an array, followed by its data in the same block
+  //! when the array owns them. The reference count is atomic : arrays
+  //! sharing a block (attach) may be copied and destroyed by several threads.
   template <class T> 
   class Vdata
   {
   public :
-    Vdata();
-    Vdata(int);
-    Vdata(int, const T* );
-    ~Vdata();
+    //! header and sz uninitialized data in one block
+    static Vdata<T>* create(int sz) ;
+    //! header only, on data owned by the caller
+    static Vdata<T>* create_view(int sz, const T* ptr) ;
+    //! empty block shared by all the empty arrays left by a move or clear(),
+    //! never freed (its own reference is never given back)
+    static Vdata<T>* empty() noexcept ;
+    //! free the block of p
+    static void destroy(Vdata<T>* p) ;
     int add_one_ref();
     int supr_one_ref();
     int   sz;
     T* data;
-    int   ref_count;
+    std::atomic<int> ref_count;
     int owner;
+  private :
+    //! offset of the data in the block (keeps them aligned)
+    static size_t header_size() ;
+    Vdata(int, T*, int, size_t) ;
+    size_t block ;   // size of the block
+  };
+
+  //! Read-only view on (a sub-range of) an array : pointer and size only.
+  //! Never touches the reference count nor the memory, so that sub-ranges
+  //! of a shared array can be given to threads without copy. The view
+  //! must not outlive the array it comes from.
+  template <class T> class ArrOfView
+  {
+  public :
+    ArrOfView();
+    ArrOfView(int n, const T* ptr);
+    const T& operator[](int i) const ;
+    int size() const;
+    const T* get_ptr() const;
+    //! n values from begin, up to the end when n < 0
+    ArrOfView<T> sub(int begin, int n=-1) const;
+  private :
+    const T* data;
+    int sz;
   };
 
-  
+  //! Copy and assignment copy the values, attach() shares the block.
+  //! Moves steal the block (the target gives back its own one, it no
+  //! longer aliases what it was attached to), the source is left empty.
   template <class T> class ArrOf 
   {
   public :
@@ -44,8 +110,11 @@ namespace LANGUAGE_KERNEL
     ArrOf(int n=0, const T& x=0);
     ArrOf(const T* ptr, int n, const T& x=0);
     ArrOf(int n, const T* ptr);
+    ArrOf(int n, ArrOf_uninitialized);
     ArrOf(const ArrOf<T>& );
+    ArrOf(ArrOf<T>&& ) noexcept;
     ArrOf<T>& operator=(const ArrOf<T>&);
+    ArrOf<T>& operator=(ArrOf<T>&& A) noexcept;
     ArrOf<T>& operator=(const T& x);
     
     T& operator[](int i);
@@ -79,8 +148,13 @@ namespace LANGUAGE_KERNEL
     ArrOf<T>& inject(const ArrOf<T>&);
     ArrOf<T>& copy(const ArrOf<T>&);
     void attach(const ArrOf<T>&);
+    //! releases the reference, the array is unusable until attach or resize
     int detach();
-    void clear();  // clear memory of the ArrOf
+    void swap(ArrOf<T>&);
+    //! see ArrOfView
+    ArrOfView<T> view(int begin=0, int n=-1) const;
+    //! gives back the block (freed with its last reference), the array is left empty
+    void clear();
   protected :
     Vdata<T>* p;
     T* data;
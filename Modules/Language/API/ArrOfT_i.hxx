@@ -19,65 +19,187 @@
 #ifndef ArrOfT_inlines
 #define ArrOfT_inlines 1
 #include <string.h>
+#include <stdlib.h>
+#include <new>
+#include <utility>
 
 namespace LANGUAGE_KERNEL
 {
-  template <class T> 
-  inline Vdata<T>::
-  Vdata() : 
-    sz(0), 
-    data(0), 
-    ref_count(1), 
-    owner(1)
+  inline ArrOf_memory::Pool::Pool()
   {
+    for (int i=0; i<nb_classes; i++)
+      {
+        head[i] = 0;
+        nb[i] = 0;
+      }
   }
-  template <class T> 
-  inline Vdata<T>::
-  Vdata(int s) : 
-    sz(s), 
-    ref_count(1), 
-    owner(1)
+  inline ArrOf_memory::Pool::~Pool()
+  {
+    for (int i=0; i<nb_classes; i++)
+      while (head[i])
+        {
+          void* next = *(void**) head[i];
+          free(head[i]);
+          head[i] = next;
+        }
+    closed() = true;
+  }
+  inline bool& ArrOf_memory::Pool::closed()
+  {
+    // trivially destructible : still valid after ~Pool at thread exit
+    static thread_local bool is_closed = false;
+    return is_closed;
+  }
+  inline int ArrOf_memory::size_class(size_t size)
+  {
+#ifdef ARROF_NO_POOL
+    (void) size;
+    return -1;
+#else
+    if (size <= align)   return 0;
+    if (size <= 2*align) return 1;
+    if (size <= 4*align) return 2;
+    return -1;
+#endif
+  }
+  inline ArrOf_memory::Pool* ArrOf_memory::pool()
   {
-    if (s <= 0)
-      data = 0;
-    else
-      try {
-        data = new T[s];
-        // test
-        for (int i=0;i<s;i++) data[i]=0;
-        // test
+    static thread_local Pool thread_pool;
+    return Pool::closed() ? 0 : &thread_pool;
+  }
+  inline void* ArrOf_memory::allocate(size_t size)
+  {
+    int c = size_class(size);
+    if (c >= 0)
+      {
+        Pool* fl = pool();
+        if (fl && fl->head[c])
+          {
+            void* ptr = fl->head[c];
+            fl->head[c] = *(void**) ptr;
+            fl->nb[c]--;
+            return ptr;
+          }
+        size = align << c;
       }
-      catch(...) {
+    void* ptr = 0;
+    if (posix_memalign(&ptr, align, size) != 0)
+      {
         cerr << "Not enough memory." << endl;
         assert(0);
         exit(-1);
       }
+    return ptr;
+  }
+  inline void ArrOf_memory::release(void* ptr, size_t size)
+  {
+    int c = size_class(size);
+    if (c >= 0)
+      {
+        // blocks freed by another thread join the pool of this one
+        Pool* fl = pool();
+        if (fl && fl->nb[c] < max_free)
+          {
+            *(void**) ptr = fl->head[c];
+            fl->head[c] = ptr;
+            fl->nb[c]++;
+            return;
+          }
+      }
+    free(ptr);
+  }
+
+  template <class T> 
+  inline size_t Vdata<T>::header_size()
+  {
+    return (sizeof(Vdata<T>) + ArrOf_memory::align - 1) / ArrOf_memory::align * ArrOf_memory::align;
   }
   template <class T> 
   inline Vdata<T>::
-  Vdata(int s, const T* ptr) : 
+  Vdata(int s, T* ptr, int own, size_t blk) : 
     sz(s), 
-    data((T*) ptr),
+    data(ptr), 
     ref_count(1), 
-    owner(0)
+    owner(own),
+    block(blk)
   {
   }
   template <class T> 
-  inline Vdata<T>::
-  ~Vdata() 
+  inline Vdata<T>* Vdata<T>::create(int s)
+  {
+    if (s <= 0)
+      s = 0;
+    size_t blk = header_size() + s*sizeof(T);
+    char* mem = (char*) ArrOf_memory::allocate(blk);
+    T* ptr = (s > 0) ? (T*) (mem + header_size()) : 0;
+    return new (mem) Vdata<T>(s, ptr, 1, blk);
+  }
+  template <class T> 
+  inline Vdata<T>* Vdata<T>::create_view(int s, const T* ptr)
+  {
+    size_t blk = header_size();
+    void* mem = ArrOf_memory::allocate(blk);
+    return new (mem) Vdata<T>(s, (T*) ptr, 0, blk);
+  }
+  template <class T> 
+  inline Vdata<T>* Vdata<T>::empty() noexcept
   {
-    if(owner && data)
-      delete[] data;
+    // trivially destructible : still valid for the arrays destroyed at exit
+    static Vdata<T> empty_block(0, 0, 0, 0);
+    return &empty_block;
+  }
+  template <class T> 
+  inline void Vdata<T>::destroy(Vdata<T>* p)
+  {
+    size_t blk = p->block;
+    p->~Vdata<T>();
+    ArrOf_memory::release(p, blk);
   }
   template <class T> 
   inline int Vdata<T>::add_one_ref()
   {
-    return ++ref_count;
+    return ref_count.fetch_add(1, std::memory_order_relaxed) + 1;
   }
   template <class T> 
   inline int Vdata<T>::supr_one_ref()
   {
-    return (--ref_count) ;
+    // acq_rel : the last owner sees all the writes before destroying
+    return ref_count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+  }
+  template <class T> 
+  inline ArrOfView<T>::ArrOfView() :
+    data(0), sz(0)
+  {
+  }
+  template <class T> 
+  inline ArrOfView<T>::ArrOfView(int n, const T* ptr) :
+    data(ptr), sz(n)
+  {
+  }
+  template <class T> 
+  inline const T& ArrOfView<T>::operator[](int i) const
+  {
+    assert(i<sz);
+    assert(i >= 0);
+    return data[i];
+  }
+  template <class T> 
+  inline int ArrOfView<T>::size() const
+  {
+    return sz;
+  }
+  template <class T> 
+  inline const T* ArrOfView<T>::get_ptr() const
+  {
+    return data;
+  }
+  template <class T> 
+  inline ArrOfView<T> ArrOfView<T>::sub(int begin, int n) const
+  {
+    assert(begin >= 0 && begin <= sz);
+    if (n < 0) n = sz - begin;
+    assert(begin + n <= sz);
+    return ArrOfView<T>(n, data + begin);
   }
   template <class T> 
   inline ArrOf<T>::
@@ -88,31 +210,46 @@ namespace LANGUAGE_KERNEL
   template <class T> 
   inline ArrOf<T>::
   ArrOf(int n, const T& x) :
-    p(new Vdata<T>(n)), data(p->data)
+    p(Vdata<T>::create(n)), data(p->data)
   {
     *this = x;
   }
   template <class T> 
   inline ArrOf<T>::
+  ArrOf(int n, ArrOf_uninitialized) :
+    p(Vdata<T>::create(n)), data(p->data)
+  {
+  }
+  template <class T> 
+  inline ArrOf<T>::
   ArrOf(const T* ptr, int n, const T& x) :
-    p(new Vdata<T>(n,ptr)), data(p->data)
+    p(Vdata<T>::create_view(n,ptr)), data(p->data)
   {
     *this = x;
   }
   template <class T> 
   inline ArrOf<T>::
   ArrOf(int n, const T* ptr) :
-    p(new Vdata<T>(n,ptr)), data(p->data)
+    p(Vdata<T>::create_view(n,ptr)), data(p->data)
   {
   }
   template <class T> 
   inline ArrOf<T>::
   ArrOf(const ArrOf<T>& A):
-    p(new Vdata<T>(A.size())), data(p->data)
+    p(Vdata<T>::create(A.size())), data(p->data)
   {
     copy(A);
   }
   template <class T> 
+  inline ArrOf<T>::
+  ArrOf(ArrOf<T>&& A) noexcept :
+    p(A.p), data(A.data)
+  {
+    A.p = Vdata<T>::empty();
+    A.p->add_one_ref();
+    A.data = 0;
+  }
+  template <class T> 
   inline ArrOf<T>& ArrOf<T>::
   copy(const ArrOf<T>& A)
   {
@@ -136,6 +273,19 @@ namespace LANGUAGE_KERNEL
   }
   template <class T> 
   inline ArrOf<T>& ArrOf<T>::
+  operator=(ArrOf<T>&& A) noexcept
+  {
+    if (this == &A) return *this;
+    detach();
+    p = A.p;
+    data = A.data;
+    A.p = Vdata<T>::empty();
+    A.p->add_one_ref();
+    A.data = 0;
+    return *this;
+  }
+  template <class T> 
+  inline ArrOf<T>& ArrOf<T>::
   operator=(const T& x)
   {
     if (data) {
@@ -200,7 +350,7 @@ namespace LANGUAGE_KERNEL
     assert(p);
     assert(n>=0);
     if(size()==n) return *this;
-    Vdata<T>* np=new Vdata<T>(n);
+    Vdata<T>* np=Vdata<T>::create(n);
     data=np->data;
     int oldsz=size();
     int m= ((n) < (oldsz) ? (n) : (oldsz));
@@ -218,6 +368,7 @@ namespace LANGUAGE_KERNEL
       }
     detach();
     p=np;
+    data=np->data;
     assert(p);
     return *this;
   }
@@ -225,7 +376,7 @@ namespace LANGUAGE_KERNEL
   inline int ArrOf<T>::
   ref_count() const
   {
-    return p->ref_count;
+    return p->ref_count.load(std::memory_order_relaxed);
   }
   template <class T> 
   inline ArrOf<T>& ArrOf<T>::
@@ -311,16 +462,36 @@ namespace LANGUAGE_KERNEL
     if(p)
       if ((p->supr_one_ref()) == 0)
 	{
-	  delete p;
-	  p = 0;
+	  Vdata<T>::destroy(p);
 	  retour = 1;
 	}
+    // the reference is given back : never released twice
+    p = 0;
+    data = 0;
     return retour;
   }
   template <class T> 
   inline void ArrOf<T>::
+  swap(ArrOf<T>& A)
+  {
+    Vdata<T>* q = p;
+    p = A.p;
+    A.p = q;
+    T* d = data;
+    data = A.data;
+    A.data = d;
+  }
+  template <class T> 
+  inline ArrOfView<T> ArrOf<T>::
+  view(int begin, int n) const
+  {
+    return ArrOfView<T>(size(), data).sub(begin, n);
+  }
+  template <class T> 
+  inline void ArrOf<T>::
   attach(const ArrOf<T>& m)
   {
+    if (m.p == p) return;
     detach();
     m.add_one_ref();
     p = m.p;
@@ -349,16 +520,10 @@ namespace LANGUAGE_KERNEL
   template <class T> 
   inline void ArrOf<T>::clear()
   {
-    if (p)
-    {
-      if (p->owner && p->data)
-        delete[] p->data;  
-
-      p->data = nullptr;
-      p->sz = 0;
-      p->ref_count = 1; 
-      p->owner = 1;
-    }
+    // the other arrays sharing the block keep it
+    detach();
+    p = Vdata<T>::empty();
+    p->add_one_ref();
   }
 }
 #endif
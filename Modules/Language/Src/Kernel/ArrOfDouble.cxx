@@ -54,7 +54,7 @@ namespace NEPTUNE
   }
 
   istream & operator>>(istream &stream, ArrOfDouble &object)
-  { object.detach();
+  { object.attach(LANGUAGE_KERNEL::ArrOf<double>());
     int nsz;
     stream >> nsz;
     object.resize(nsz);
@@ -49,7 +49,7 @@ namespace NEPTUNE
   }
 
   istream & operator>>(istream &stream, ArrOfInt &object)
-  { object.detach();
+  { object.attach(LANGUAGE_KERNEL::ArrOf<int>());
     int nsz ;
     stream >> nsz ;
     object.resize(nsz) ;
@@ -17,6 +17,9 @@
 
 #include "Language/API/Language.hxx"
 
+#include <vector>
+#include <type_traits>
+
 using namespace NEPTUNE;
 
 int main()
@@ -41,6 +44,67 @@ int main()
     strings.print_On();
 
   }
+  {
+    // ArrOf storage : aligned blocks, uninitialized construction, views
+    ArrOfDouble a(3, 1.5);
+    ArrOfDouble b(1000, LANGUAGE_KERNEL::uninitialized);
+    ArrOfDouble v(3, a.get_ptr());
+    b = 2.e0;
+    double v0 = v[0];
+    a.resize(5);
+    if (   ((size_t) b.get_ptr()) % 64 != 0
+        || v0 != 1.5 || a[2] != 1.5 || a[4] != 0.e0 || b[999] != 2.e0)
+      {
+        std::cout << "ArrOf storage test failed" << std::endl;
+        return 1;
+      }
+  }
+  {
+    // ArrOf sharing : reference counts, moves, read-only views
+    ArrOfDouble a(4, 3.e0);
+    ArrOfDouble s;
+    s.attach(a);
+    int shared = a.ref_count();
+    ArrOfDouble m(std::move(a));
+    LANGUAGE_KERNEL::ArrOfView<double> w = m.view(1, 2);
+    if (   shared != 2 || m.ref_count() != 2 || a.size() != 0
+        || w.size() != 2 || w.get_ptr() != s.get_ptr() + 1 || w[1] != 3.e0)
+      {
+        std::cout << "ArrOf sharing test failed" << std::endl;
+        return 1;
+      }
+  }
+  {
+    // ArrOf moves : the target steals the block, the source is left empty,
+    // nothing is copied when a vector of arrays grows ; clear() leaves the
+    // other arrays sharing the block untouched
+    static_assert(std::is_nothrow_move_constructible<ArrOfDouble>::value, "ArrOfDouble move");
+    static_assert(std::is_nothrow_move_assignable<ArrOfDouble>::value, "ArrOfDouble move");
+    ArrOfDouble t(3, 1.e0);
+    ArrOfDouble u;
+    u.attach(t);
+    ArrOfDouble x(3, 2.e0);
+    const double* px = x.get_ptr();
+    t = std::move(x);
+    bool moved = (t.get_ptr() == px && t[0] == 2.e0 && x.size() == 0
+                  && u[0] == 1.e0 && u.ref_count() == 1);
+    std::vector<ArrOfDouble> vec;
+    vec.emplace_back(100, 1.e0);
+    const double* pv = vec[0].get_ptr();
+    for (int i=0; i<100; i++)
+      vec.emplace_back(10);
+    bool no_copy = (vec[0].get_ptr() == pv);
+    ArrOfDouble c(5, 4.e0);
+    ArrOfDouble d;
+    d.attach(c);
+    c.clear();
+    bool cleared = (c.size() == 0 && d.size() == 5 && d[4] == 4.e0 && d.ref_count() == 1);
+    if (!moved || !no_copy || !cleared)
+      {
+        std::cout << "ArrOf move test failed " << moved << no_copy << cleared << std::endl;
+        return 1;
+      }
+  }
   Language_finalize();
   return 0;
 }